@@ -30,10 +30,12 @@
 
 #include "HoudiniApi.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineString.h"
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniEngineScheduler.h"
 #include "HoudiniEngineManager.h"
+#include "HoudiniParameterTranslator.h"
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniEngineTask.h"
@@ -68,8 +70,6 @@ FHoudiniEngine::HoudiniEngineInstance = nullptr;
 
 FHoudiniEngine::FHoudiniEngine()
 	: LicenseType(HAPI_LICENSE_NONE)
-	, HoudiniEngineSchedulerThread(nullptr)
-	, HoudiniEngineScheduler(nullptr)
 	, HoudiniEngineManagerThread(nullptr)
 	, HoudiniEngineManager(nullptr)
 	//, bHAPIVersionMismatch(false)
@@ -202,10 +202,9 @@ FHoudiniEngine::StartupModule()
 	// We do not automatically try to start a session when starting up the module now.
 	bFirstSessionCreated = false;
 
-	// Create HAPI scheduler and processing thread.
-	HoudiniEngineScheduler = new FHoudiniEngineScheduler();
-	HoudiniEngineSchedulerThread = FRunnableThread::Create(
-		HoudiniEngineScheduler, TEXT("HoudiniSchedulerThread"), 0, TPri_Normal);
+	// Create the main HAPI scheduler and processing thread.
+	// Additional lanes are created on demand when more sessions are available.
+	GetOrCreateSchedulerLane(0);
 
 	// Create Houdini Asset Manager
 	HoudiniEngineManager = new FHoudiniEngineManager();
@@ -314,23 +313,33 @@ FHoudiniEngine::ShutdownModule()
 	FUnrealObjectInputManager::DestroySingleton();
 
 	// Do scheduler and thread clean up.
-	if (HoudiniEngineScheduler)
-		HoudiniEngineScheduler->Stop();
-
-	if (HoudiniEngineSchedulerThread)
+	for (FHoudiniEngineScheduler* Scheduler : HoudiniEngineSchedulers)
 	{
-		//HoudiniEngineSchedulerThread->Kill( true );
-		HoudiniEngineSchedulerThread->WaitForCompletion();
+		if (Scheduler)
+			Scheduler->Stop();
+	}
 
-		delete HoudiniEngineSchedulerThread;
-		HoudiniEngineSchedulerThread = nullptr;
+	for (FRunnableThread* SchedulerThread : HoudiniEngineSchedulerThreads)
+	{
+		if (SchedulerThread)
+		{
+			SchedulerThread->WaitForCompletion();
+			delete SchedulerThread;
+		}
 	}
+	HoudiniEngineSchedulerThreads.Empty();
 
-	if ( HoudiniEngineScheduler )
+	for (FHoudiniEngineScheduler* Scheduler : HoudiniEngineSchedulers)
 	{
-		delete HoudiniEngineScheduler;
-		HoudiniEngineScheduler = nullptr;
+		if (Scheduler)
+			delete Scheduler;
 	}
+	HoudiniEngineSchedulers.Empty();
+
+	TaskLanes.Empty();
+	NodeLanes.Empty();
+	LaneTaskCounts.Empty();
+	PendingLaneTasks.Empty();
 
 	// Do manager clean up.
 	if (HoudiniEngineManager)
@@ -353,51 +362,261 @@ FHoudiniEngine::ShutdownModule()
 		SessionStatus = EHoudiniSessionStatus::Invalid;
 	}
 
+	FHoudiniEngineString::InvalidateStringCache();
+
 	FHoudiniApi::FinalizeHAPI();
 
 	FHoudiniEngine::HoudiniEngineInstance = nullptr;
 }
 
-void
-FHoudiniEngine::AddTask(const FHoudiniEngineTask & InTask)
+FHoudiniEngineScheduler*
+FHoudiniEngine::GetOrCreateSchedulerLane(int32 InLane)
 {
-	if ( HoudiniEngineScheduler )
-		HoudiniEngineScheduler->AddTask(InTask);
+	if (InLane < 0)
+		return nullptr;
 
 	FScopeLock ScopeLock(&CriticalSection);
-	FHoudiniEngineTaskInfo TaskInfo;
-	TaskInfo.TaskType = InTask.TaskType;
-	TaskInfo.TaskState = EHoudiniEngineTaskState::Working;
+	while (HoudiniEngineSchedulers.Num() <= InLane)
+	{
+		const int32 NewLane = HoudiniEngineSchedulers.Num();
+		const FString ThreadName = NewLane == 0
+			? FString(TEXT("HoudiniSchedulerThread"))
+			: FString::Printf(TEXT("HoudiniSchedulerThread%d"), NewLane);
+
+		FHoudiniEngineScheduler* Scheduler = new FHoudiniEngineScheduler(NewLane);
+		FRunnableThread* SchedulerThread = FRunnableThread::Create(
+			Scheduler, *ThreadName, 0, TPri_Normal);
+
+		HoudiniEngineSchedulers.Add(Scheduler);
+		HoudiniEngineSchedulerThreads.Add(SchedulerThread);
+	}
+
+	return HoudiniEngineSchedulers[InLane];
+}
+
+// Returns the valid node ids a task is touching
+static void
+GetTaskNodeIds(const FHoudiniEngineTask& InTask, TArray<HAPI_NodeId>& OutNodeIds)
+{
+	OutNodeIds.Reset(1 + InTask.OtherNodeIds.Num() + InTask.DependencyNodeIds.Num());
+	if (InTask.AssetId >= 0)
+		OutNodeIds.Add(InTask.AssetId);
+	for (const HAPI_NodeId& NodeId : InTask.OtherNodeIds)
+	{
+		if (NodeId >= 0)
+			OutNodeIds.AddUnique(NodeId);
+	}
+	for (const HAPI_NodeId& NodeId : InTask.DependencyNodeIds)
+	{
+		if (NodeId >= 0)
+			OutNodeIds.AddUnique(NodeId);
+	}
+}
+
+int32
+FHoudiniEngine::AssignSchedulerLane(const FHoudiniEngineTask& InTask, int32 InNumPendingTasks)
+{
+	// One lane per session. Sessions all connect to the same Houdini server,
+	// so node ids are valid on every lane, but two tasks touching the same node
+	// must stay on the same lane to keep their relative ordering.
+	const int32 NumLanes = GetMaxSchedulerLanes();
+
+	TArray<HAPI_NodeId> NodeIds;
+	GetTaskNodeIds(InTask, NodeIds);
 
-	TaskInfos.Add(InTask.HapiGUID, TaskInfo);
+	// Don't overtake a pending task using the same nodes
+	TArray<HAPI_NodeId> PendingNodeIds;
+	for (int32 PendingIdx = 0; PendingIdx < InNumPendingTasks && PendingIdx < PendingLaneTasks.Num(); ++PendingIdx)
+	{
+		GetTaskNodeIds(PendingLaneTasks[PendingIdx], PendingNodeIds);
+		for (const HAPI_NodeId& NodeId : NodeIds)
+		{
+			if (PendingNodeIds.Contains(NodeId))
+				return INDEX_NONE;
+		}
+	}
+
+	if (NumLanes <= 1)
+		return 0;
+
+	// Follow the lane of the nodes that already have work in flight.
+	// If they are in flight on several lanes, wait until only one of them is left.
+	int32 Lane = INDEX_NONE;
+	for (const HAPI_NodeId& NodeId : NodeIds)
+	{
+		if (const TPair<int32, int32>* NodeLane = NodeLanes.Find(NodeId))
+		{
+			if (Lane != INDEX_NONE && Lane != NodeLane->Key)
+				return INDEX_NONE;
+
+			Lane = NodeLane->Key;
+		}
+	}
+
+	// Deletions only need to be ordered after the tasks already using the node
+	if (InTask.TaskType == EHoudiniEngineTaskType::AssetDeletion)
+		return Lane != INDEX_NONE && Lane < NumLanes ? Lane : 0;
+
+	if (LaneTaskCounts.Num() < NumLanes)
+		LaneTaskCounts.SetNumZeroed(NumLanes);
+
+	// Otherwise, use the least loaded lane
+	if (Lane == INDEX_NONE || Lane >= NumLanes)
+	{
+		Lane = 0;
+		for (int32 Idx = 1; Idx < NumLanes; ++Idx)
+		{
+			if (LaneTaskCounts[Idx] < LaneTaskCounts[Lane])
+				Lane = Idx;
+		}
+	}
+
+	for (const HAPI_NodeId& NodeId : NodeIds)
+	{
+		TPair<int32, int32>& NodeLane = NodeLanes.FindOrAdd(NodeId, TPair<int32, int32>(Lane, 0));
+		NodeLane.Value++;
+	}
+	LaneTaskCounts[Lane]++;
+
+	FHoudiniEngineTaskLane& TaskLane = TaskLanes.Add(InTask.HapiGUID);
+	TaskLane.Lane = Lane;
+	TaskLane.NodeIds = MoveTemp(NodeIds);
+
+	return Lane;
 }
 
 void
-FHoudiniEngine::AddTaskInfo(const FGuid& InHapiGUID, const FHoudiniEngineTaskInfo & InTaskInfo)
+FHoudiniEngine::AddTask(const FHoudiniEngineTask & InTask)
 {
-	FScopeLock ScopeLock(&CriticalSection);
-	TaskInfos.Add(InHapiGUID, InTaskInfo);
+	int32 Lane = 0;
+	{
+		// Register the task info before queuing the task, so the scheduler's responses can find it
+		FScopeLock ScopeLock(&CriticalSection);
+		FHoudiniEngineTaskInfo TaskInfo;
+		TaskInfo.TaskType = InTask.TaskType;
+		TaskInfo.TaskState = EHoudiniEngineTaskState::Working;
+
+		TaskInfos.Add(InTask.HapiGUID, TaskInfo);
+
+		Lane = AssignSchedulerLane(InTask, PendingLaneTasks.Num());
+		if (Lane == INDEX_NONE)
+		{
+			// Queued by DispatchPendingLaneTasks() once the lanes it depends on are done with its nodes
+			PendingLaneTasks.Add(InTask);
+			return;
+		}
+	}
+
+	// Queue outside of the lock, AddTask can wait for the scheduler when its queue is full
+	if (FHoudiniEngineScheduler* Scheduler = GetOrCreateSchedulerLane(Lane))
+		Scheduler->AddTask(InTask);
 }
 
 void
 FHoudiniEngine::RemoveTaskInfo(const FGuid& InHapiGUID)
 {
-	FScopeLock ScopeLock(&CriticalSection);
-	TaskInfos.Remove(InHapiGUID);
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+		TaskInfos.Remove(InHapiGUID);
+
+		ReleaseSchedulerLane(InHapiGUID);
+	}
+
+	DispatchPendingLaneTasks();
+}
+
+void
+FHoudiniEngine::DispatchPendingLaneTasks()
+{
+	TArray<TPair<int32, FHoudiniEngineTask>> TasksToQueue;
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+		for (int32 PendingIdx = 0; PendingIdx < PendingLaneTasks.Num();)
+		{
+			const int32 Lane = AssignSchedulerLane(PendingLaneTasks[PendingIdx], PendingIdx);
+			if (Lane == INDEX_NONE)
+			{
+				++PendingIdx;
+				continue;
+			}
+
+			TasksToQueue.Emplace(Lane, PendingLaneTasks[PendingIdx]);
+			PendingLaneTasks.RemoveAt(PendingIdx);
+		}
+	}
+
+	// Queue outside of the lock, as AddTask() does
+	for (const TPair<int32, FHoudiniEngineTask>& TaskToQueue : TasksToQueue)
+	{
+		if (FHoudiniEngineScheduler* Scheduler = GetOrCreateSchedulerLane(TaskToQueue.Key))
+			Scheduler->AddTask(TaskToQueue.Value);
+	}
+}
+
+void
+FHoudiniEngine::ReleaseSchedulerLane(const FGuid& InHapiGUID)
+{
+	// Release the task's lane and node affinity
+	FHoudiniEngineTaskLane TaskLane;
+	if (!TaskLanes.RemoveAndCopyValue(InHapiGUID, TaskLane))
+		return;
+
+	if (LaneTaskCounts.IsValidIndex(TaskLane.Lane))
+		LaneTaskCounts[TaskLane.Lane] = FMath::Max(0, LaneTaskCounts[TaskLane.Lane] - 1);
+
+	for (const HAPI_NodeId& NodeId : TaskLane.NodeIds)
+	{
+		TPair<int32, int32>* NodeLane = NodeLanes.Find(NodeId);
+		if (NodeLane && --NodeLane->Value <= 0)
+			NodeLanes.Remove(NodeId);
+	}
 }
 
 bool
 FHoudiniEngine::RetrieveTaskInfo(const FGuid& InHapiGUID, FHoudiniEngineTaskInfo & OutTaskInfo)
 {
-	FScopeLock ScopeLock(&CriticalSection);
-
-	if (TaskInfos.Contains(InHapiGUID))
+	bool bFound = false;
+	bool bReleasedLanes = false;
 	{
-		OutTaskInfo = TaskInfos[InHapiGUID];
-		return true;
+		FScopeLock ScopeLock(&CriticalSection);
+
+		// Apply the responses posted by the scheduler thread since the last call.
+		// The scheduler never takes this lock, so the only contention left is between game thread callers.
+		FGuid ResponseGUID;
+		FHoudiniEngineTaskInfo ResponseTaskInfo;
+		for (FHoudiniEngineScheduler* Scheduler : HoudiniEngineSchedulers)
+		{
+			if (!Scheduler)
+				continue;
+
+			while (Scheduler->DequeueResponseTaskInfo(ResponseGUID, ResponseTaskInfo))
+			{
+				// Ignore responses for tasks that have already been removed
+				if (FHoudiniEngineTaskInfo* FoundTaskInfo = TaskInfos.Find(ResponseGUID))
+					*FoundTaskInfo = ResponseTaskInfo;
+
+				// Failed or aborted tasks are not always removed, release their lane now that the scheduler is done with them
+				if (ResponseTaskInfo.TaskState == EHoudiniEngineTaskState::FinishedWithError
+					|| ResponseTaskInfo.TaskState == EHoudiniEngineTaskState::FinishedWithFatalError
+					|| ResponseTaskInfo.TaskState == EHoudiniEngineTaskState::Aborted)
+				{
+					ReleaseSchedulerLane(ResponseGUID);
+					bReleasedLanes = true;
+				}
+			}
+		}
+
+		if (const FHoudiniEngineTaskInfo* FoundTaskInfo = TaskInfos.Find(InHapiGUID))
+		{
+			OutTaskInfo = *FoundTaskInfo;
+			bFound = true;
+		}
 	}
 
-	return false;
+	if (bReleasedLanes)
+		DispatchPendingLaneTasks();
+
+	return bFound;
 }
 
 /*
@@ -1143,6 +1362,12 @@ FHoudiniEngine::StopSession()
 	SetSessionStatus(EHoudiniSessionStatus::Stopped);
 	bEnableSessionSync = false;
 
+	// Definitions may be edited live in the next session, without their library being saved
+	FHoudiniParameterTranslator::ClearParameterSchemaCache();
+
+	// String handles are only valid in the session that created them
+	FHoudiniEngineString::InvalidateStringCache();
+
 	HoudiniEngineManager->StopHoudiniTicking();
 
 	return true;
@@ -178,12 +178,19 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 		// Register task for execution.
 		virtual void AddTask(const FHoudiniEngineTask & InTask);
-		// Register task info.
-		virtual void AddTaskInfo(const FGuid& InHapiGUID, const FHoudiniEngineTaskInfo & InTaskInfo);
 		// Remove task info.
 		virtual void RemoveTaskInfo(const FGuid& InHapiGUID);
-		// Remove task info.
+		// Retrieve task info.
 		virtual bool RetrieveTaskInfo(const FGuid& InHapiGUID, FHoudiniEngineTaskInfo & OutTaskInfo);
+		// Number of scheduler lanes currently running tasks
+		int32 GetNumSchedulerLanes() const { return HoudiniEngineSchedulers.Num(); }
+		// Maximum number of scheduler lanes, each running on the session with the same index.
+		// Only the first half of the sessions are used by the lanes, the others are left to the attribute accessors.
+		int32 GetMaxSchedulerLanes() const { return FMath::Max(1, GetNumSessions() / 2); }
+		// Sessions the attribute accessors can use at the same time: the main session, followed by the sessions
+		// no scheduler lane runs on.
+		int32 GetNumAccessorSessions() const { return FMath::Max(1, GetNumSessions() - GetMaxSchedulerLanes() + 1); }
+		const HAPI_Session* GetAccessorSession(int32 Index) const { return GetSession(Index == 0 ? 0 : Index + GetMaxSchedulerLanes() - 1); }
 		// Register asset to the manager
 		//virtual void AddHoudiniAssetComponent(UHoudiniAssetComponent* HAC);
 
@@ -278,6 +285,19 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 	private:
 
+		// Picks the scheduler lane a task should run on and records its node affinity.
+		// Returns INDEX_NONE if the task has to wait: its nodes are in flight on more than one lane,
+		// or one of the first InNumPendingTasks pending tasks is using them.
+		// Must be called with CriticalSection held.
+		int32 AssignSchedulerLane(const FHoudiniEngineTask& InTask, int32 InNumPendingTasks);
+		// Queues the pending tasks that no longer need to wait, in order.
+		void DispatchPendingLaneTasks();
+		// Releases the lane and node affinity of a task, once it has failed or been removed.
+		// Must be called with CriticalSection held.
+		void ReleaseSchedulerLane(const FGuid& InHapiGUID);
+		// Returns the scheduler for the given lane, creating it and its thread if needed
+		FHoudiniEngineScheduler* GetOrCreateSchedulerLane(int32 InLane);
+
 		// Singleton instance of Houdini Engine.
 		static FHoudiniEngine * HoudiniEngineInstance;
 
@@ -298,10 +318,27 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Map of task statuses.
 		TMap<FGuid, FHoudiniEngineTaskInfo> TaskInfos;
 
-		// Thread used to execute the scheduler.
-		FRunnableThread * HoudiniEngineSchedulerThread;
-		// Scheduler used to schedule HAPI instantiation and cook tasks. 
-		FHoudiniEngineScheduler * HoudiniEngineScheduler;
+		// Threads used to execute the schedulers, one per scheduler.
+		TArray<FRunnableThread*> HoudiniEngineSchedulerThreads;
+		// Schedulers used to schedule HAPI instantiation and cook tasks.
+		// Each scheduler is a lane running its tasks on the session with the same index,
+		// lane 0 always exists, the others are created on demand up to GetMaxSchedulerLanes().
+		TArray<FHoudiniEngineScheduler*> HoudiniEngineSchedulers;
+
+		// Lane assignment of a queued task and the nodes it is touching
+		struct FHoudiniEngineTaskLane
+		{
+			int32 Lane = 0;
+			TArray<HAPI_NodeId> NodeIds;
+		};
+		// Lane of each in-flight task, released when the task fails, is aborted or is removed
+		TMap<FGuid, FHoudiniEngineTaskLane> TaskLanes;
+		// Lane currently owning a node, with the number of in-flight tasks touching it
+		TMap<HAPI_NodeId, TPair<int32, int32>> NodeLanes;
+		// Number of in-flight tasks per lane
+		TArray<int32> LaneTaskCounts;
+		// Tasks waiting for their nodes to be in flight on a single lane, in submission order
+		TArray<FHoudiniEngineTask> PendingLaneTasks;
 
 		// Thread used to execute the manager.
 		FRunnableThread * HoudiniEngineManagerThread;
@@ -298,7 +298,8 @@ int FHoudiniHapiAccessor::CalculateNumberOfSessions(const HAPI_AttributeInfo& At
 	if (AttributeInfo.storage == HAPI_STORAGETYPE_STRING || IsHapiArrayType(AttributeInfo.storage))
 		return 1;
 
-	int NumSessions = FHoudiniEngine::Get().GetNumSessions();
+	// Sessions used by the scheduler lanes can't be shared with the accessor's tasks
+	int NumSessions = FHoudiniEngine::Get().GetNumAccessorSessions();
 
 	if (!bAllowMultiThreading)
 		NumSessions = 1;
@@ -445,7 +446,7 @@ bool FHoudiniHapiAccessor::ExecuteTasksWithSessions(TArray<TaskType> & Tasks, in
 
 	for (int Session = 0; Session < NumSessions; Session++)
 	{
-		const HAPI_Session* SessionToAdd = FHoudiniEngine::Get().GetSession(Session);
+		const HAPI_Session* SessionToAdd = FHoudiniEngine::Get().GetAccessorSession(Session);
 		AvailableSessions.Add(SessionToAdd);
 	}
 
@@ -527,7 +528,7 @@ bool FHoudiniHapiAccessor::GetHeightFieldData(TArray<float>& Results, int IndexC
 	H_SCOPED_FUNCTION_TIMER();
 
 	int64 TotalSize = Results.Num() * sizeof(Results[0]);
-	int64 NumSessions = bAllowMultiThreading ? FHoudiniEngine::Get().GetNumSessions() : 1;
+	int64 NumSessions = bAllowMultiThreading ? FHoudiniEngine::Get().GetNumAccessorSessions() : 1;
 	int NumTasks = CalculateNumberOfTasks(TotalSize, NumSessions);
 	// Task array.
 	TArray<FAsyncTask<FHoudiniHeightFieldGetTask>> Tasks;
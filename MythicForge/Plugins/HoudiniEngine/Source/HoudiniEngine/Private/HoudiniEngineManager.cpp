@@ -39,6 +39,8 @@
 #include "HoudiniNodeSyncComponent.h"
 #include "HoudiniOutputTranslator.h"
 #include "HoudiniHandleTranslator.h"
+#include "HoudiniHandleComponent.h"
+#include "HoudiniInput.h"
 #include "HoudiniLandscapeRuntimeUtils.h"
 
 #include "Misc/MessageDialog.h"
@@ -47,6 +49,7 @@
 #include "HAL/IConsoleManager.h"
 #if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION > 0)
 	#include "LevelInstance/LevelInstanceInterface.h"
+	#include "LevelInstance/LevelInstanceSubsystem.h"
 #endif
 
 #if WITH_EDITOR
@@ -58,6 +61,7 @@
 	#include "UnrealEdGlobals.h"
 	#include "Editor/UnrealEdEngine.h"
 	#include "IPackageAutoSaver.h"
+	#include "Selection.h"
 #endif
 
 static TAutoConsoleVariable<float> CVarHoudiniEngineTickTimeLimit(
@@ -79,6 +83,10 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineLiveSyncTickTime(
 FHoudiniEngineManager::FHoudiniEngineManager()
 	: CurrentIndex(0)
 	, ComponentCount(0)
+	, LastEditingLevelInstance(nullptr)
+	, bWasCookingEnabled(true)
+	, LastSessionSyncCookCount(-1)
+	, LastSessionSyncCookCountTime(0.0)
 	, bMustStopTicking(false)
 	, SyncedHoudiniViewportPivotPosition(FVector::ZeroVector)
 	, SyncedHoudiniViewportQuat(FQuat::Identity)
@@ -106,6 +114,15 @@ FHoudiniEngineManager::StartHoudiniTicking()
 		// We use the ticker manager so we get ticked once per frame, no more.
 		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FHoudiniEngineManager::Tick));		
 
+#if WITH_EDITOR
+		// Selected HACs are always processed, so we need to know when the selection changes
+		SelectionChangedHandle = USelection::SelectionChangedEvent.AddRaw(this, &FHoudiniEngineManager::OnEditorSelectionChanged);
+#endif
+
+		// Make sure every registered component is looked at once after (re)starting
+		if (FHoudiniEngineRuntime::IsInitialized())
+			FHoudiniEngineRuntime::Get().MarkAllRegisteredHoudiniComponentsDirty();
+
 		// Grab current time for delayed notification.
 		FHoudiniEngine::Get().SetHapiNotificationStartedTime(FPlatformTime::Seconds());
 	}
@@ -121,6 +138,13 @@ FHoudiniEngineManager::StopHoudiniTicking()
 			FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);			
 			TickerHandle.Reset();
 
+#if WITH_EDITOR
+			USelection::SelectionChangedEvent.Remove(SelectionChangedHandle);
+			SelectionChangedHandle.Reset();
+#endif
+			ActiveComponents.Empty();
+			DormantComponents.Empty();
+
 			// Reset time for delayed notification.
 			FHoudiniEngine::Get().SetHapiNotificationStartedTime(0.0);
 
@@ -158,96 +182,11 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 	}
 
 	// Build a set of components that need to be processed
-	// 1 - selected HACs
-	// 2 - "Active" HACs
-	// 3 - The "next" inactive HAC
+	// 1 - "Active" HACs (selected, or with work to do)
+	// 2 - HACs that have been marked dirty since the last tick
+	// 3 - The "next" registered HAC
 	TArray<UHoudiniAssetComponent*> ComponentsToProcess;
-	if (FHoudiniEngineRuntime::IsInitialized())
-	{
-		FHoudiniEngineRuntime::Get().CleanUpRegisteredHoudiniComponents();
-
-		//FScopeLock ScopeLock(&CriticalSection);
-		ComponentCount = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
-
-		// Wrap around if needed
-		if (CurrentIndex >= ComponentCount)
-			CurrentIndex = 0;
-
-		for (uint32 nIdx = 0; nIdx < ComponentCount; nIdx++)
-		{
-			UHoudiniAssetComponent * CurrentComponent = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(nIdx);
-			if (!CurrentComponent || !CurrentComponent->IsValidLowLevelFast())
-			{
-				// Invalid component, do not process
-				continue;
-			}
-			else if (!IsValid(CurrentComponent) || CurrentComponent->GetAssetState() == EHoudiniAssetState::Deleting)
-			{
-				// Component being deleted, do not process
-				continue;
-			}
-			
-			{
-				UWorld* World = CurrentComponent->GetHACWorld();
-				if (World && (World->IsPlayingReplay() || World->IsPlayInEditor()))
-				{
-					if (!CurrentComponent->IsPlayInEditorRefinementAllowed())
-					{
-						// This component's world is current in PIE and this HDA is NOT allowed to cook / refine in PIE.
-						continue;
-					}
-				}
-			}
-
-			if (!CurrentComponent->IsFullyLoaded())
-			{
-				// Let the component figure out whether it's fully loaded or not.
-				CurrentComponent->HoudiniEngineTick();
-				if (!CurrentComponent->IsFullyLoaded())
-					continue; // We need to wait some more.
-			}
-
-			if (!CurrentComponent->IsValidComponent())
-			{
-				// This component is no longer valid. Prevent it from being processed, and remove it.
-				FHoudiniEngineRuntime::Get().UnRegisterHoudiniComponent(CurrentComponent);
-				continue;
-			}
-
-			AActor* Owner = CurrentComponent->GetOwner();
-			if (Owner && Owner->IsSelectedInEditor())
-			{
-				// 1. Add selected HACs
-				// If the component's owner is selected, add it to the set
-				ComponentsToProcess.Add(CurrentComponent);
-			}
-			else if (CurrentComponent->GetAssetState() != EHoudiniAssetState::NeedInstantiation
-				&& CurrentComponent->GetAssetState() != EHoudiniAssetState::None)
-			{
-				// 2. Add "Active" HACs, the only two non-active states are:
-				// NeedInstantiation (loaded, not instantiated in H yet, not modified)
-				// None (no processing currently)
-				ComponentsToProcess.Add(CurrentComponent);
-			}
-			else if(nIdx == CurrentIndex)
-			{
-				// 3. Add the "Current" HAC
-				ComponentsToProcess.Add(CurrentComponent);
-			}
-			if (CurrentComponent->GetAssetState() == EHoudiniAssetState::Dormant)
-			{
-				CurrentComponent->UpdateDormantStatus();
-			}
-			// Set the LastTickTime on the "current" HAC to 0 to ensure it's treated first
-			if (nIdx == CurrentIndex)
-			{
-				CurrentComponent->LastTickTime = 0.0;
-			}
-		}
-
-		// Increment the current index for the next tick
-		CurrentIndex++;
-	}
+	GatherComponentsToProcess(ComponentsToProcess);
 
 	// Sort the components by last tick time
 	ComponentsToProcess.Sort([](const UHoudiniAssetComponent& A, const UHoudiniAssetComponent& B) { return A.LastTickTime < B.LastTickTime; });
@@ -280,6 +219,7 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 				// TODO: Replace this polling mechanism with an "On Asset Closed" event if we
 				// can find one that actually works.
 				FHoudiniEngineRuntime::Get().UnRegisterHoudiniComponent(CurrentComponent);
+				ActiveComponents.Remove(CurrentComponent);
 				continue;
 			}
 
@@ -371,6 +311,10 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 			CurrentComponent->bNeedToUpdateEditorProperties = false;
 		}
 #endif
+
+		// Idle components stop being ticked until they are marked dirty again
+		if (!NeedsToStayActive(CurrentComponent))
+			ActiveComponents.Remove(CurrentComponent);
 	}
 
 	// Handle Asset delete
@@ -399,6 +343,9 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 	{
 		// See if the session sync settings have changed on the houdini side, update ours if they did
 		FHoudiniEngine::Get().UpdateSessionSyncInfoFromHoudini();
+
+		// Wake the idle HACs up if something was cooked in Houdini
+		UpdateSessionSyncCookCount();
 #if WITH_EDITOR
 		// Update the Houdini viewport from unreal if needed
 		if (FHoudiniEngine::Get().IsSyncViewportEnabled())
@@ -421,11 +368,268 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		
 		if (bOffsetZeroed)
 			bOffsetZeroed = false;
+
+		LastSessionSyncCookCount = -1;
 	}
 
 	return true;
 }
 
+void
+FHoudiniEngineManager::GatherComponentsToProcess(TArray<UHoudiniAssetComponent*>& OutComponentsToProcess)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineManager::GatherComponentsToProcess);
+
+	OutComponentsToProcess.Reset();
+	if (!FHoudiniEngineRuntime::IsInitialized())
+		return;
+
+	FHoudiniEngineRuntime& Runtime = FHoudiniEngineRuntime::Get();
+
+	// Pausing/resuming cooking requires every component to be processed once (UI refresh / pending changes)
+	const bool bCookingEnabled = FHoudiniEngine::Get().IsCookingEnabled();
+	if (bCookingEnabled != bWasCookingEnabled)
+	{
+		Runtime.MarkAllRegisteredHoudiniComponentsDirty();
+		bWasCookingEnabled = bCookingEnabled;
+	}
+
+	// Add the components that have been modified since the last tick
+	TArray<TWeakObjectPtr<UHoudiniAssetComponent>> DirtyComponents;
+	Runtime.ConsumeDirtyHoudiniComponents(DirtyComponents);
+	for (const TWeakObjectPtr<UHoudiniAssetComponent>& DirtyComponent : DirtyComponents)
+	{
+		DormantComponents.Remove(DirtyComponent);
+		ActiveComponents.Add(DirtyComponent);
+	}
+
+	UpdateDormantComponents();
+
+	// Also visit a single registered component per tick, in a round robin fashion.
+	// This is only a safety net for changes that were not notified to the runtime.
+	UHoudiniAssetComponent* RoundRobinComponent = nullptr;
+	ComponentCount = Runtime.GetRegisteredHoudiniComponentCount();
+
+	// Wrap around if needed
+	if (CurrentIndex >= ComponentCount)
+		CurrentIndex = 0;
+
+	if (ComponentCount > 0)
+	{
+		RoundRobinComponent = Runtime.GetRegisteredHoudiniComponentAt(CurrentIndex);
+		if (RoundRobinComponent)
+			ActiveComponents.Add(RoundRobinComponent);
+		else
+			Runtime.CleanUpRegisteredHoudiniComponents();
+	}
+
+	// Increment the current index for the next tick
+	CurrentIndex++;
+
+	for (auto Iter = ActiveComponents.CreateIterator(); Iter; ++Iter)
+	{
+		UHoudiniAssetComponent* CurrentComponent = Iter->Get();
+		if (!CurrentComponent || !CurrentComponent->IsValidLowLevelFast())
+		{
+			// Invalid component, do not process
+			Iter.RemoveCurrent();
+			continue;
+		}
+		else if (!IsValid(CurrentComponent) || CurrentComponent->GetAssetState() == EHoudiniAssetState::Deleting)
+		{
+			// Component being deleted, do not process
+			Iter.RemoveCurrent();
+			continue;
+		}
+		else if (!Runtime.IsComponentRegistered(CurrentComponent))
+		{
+			// Unregistered components are not processed by the manager
+			Iter.RemoveCurrent();
+			continue;
+		}
+
+		{
+			UWorld* World = CurrentComponent->GetHACWorld();
+			if (World && (World->IsPlayingReplay() || World->IsPlayInEditor()))
+			{
+				if (!CurrentComponent->IsPlayInEditorRefinementAllowed())
+				{
+					// This component's world is current in PIE and this HDA is NOT allowed to cook / refine in PIE.
+					// Keep it active so it gets processed once PIE ends.
+					continue;
+				}
+			}
+		}
+
+		if (!CurrentComponent->IsFullyLoaded())
+		{
+			// Let the component figure out whether it's fully loaded or not.
+			CurrentComponent->HoudiniEngineTick();
+			if (!CurrentComponent->IsFullyLoaded())
+				continue; // We need to wait some more.
+		}
+
+		if (!CurrentComponent->IsValidComponent())
+		{
+			// This component is no longer valid. Prevent it from being processed, and remove it.
+			Runtime.UnRegisterHoudiniComponent(CurrentComponent);
+			Iter.RemoveCurrent();
+			continue;
+		}
+
+		if (CurrentComponent->GetAssetState() == EHoudiniAssetState::Dormant)
+		{
+			CurrentComponent->UpdateDormantStatus();
+			if (CurrentComponent->GetAssetState() == EHoudiniAssetState::Dormant && !CurrentComponent->IsOwnerSelected())
+			{
+				// Dormant components are only revisited when the edited level instance changes
+				DormantComponents.Add(*Iter);
+				Iter.RemoveCurrent();
+				continue;
+			}
+		}
+
+		OutComponentsToProcess.Add(CurrentComponent);
+
+		// Set the LastTickTime on the "current" HAC to 0 to ensure it's treated first
+		if (CurrentComponent == RoundRobinComponent)
+			CurrentComponent->LastTickTime = 0.0;
+	}
+}
+
+bool
+FHoudiniEngineManager::NeedsToStayActive(UHoudiniAssetComponent* HAC) const
+{
+	if (!IsValid(HAC))
+		return false;
+
+	// The only non-active states are:
+	// NeedInstantiation (loaded, not instantiated in H yet, not modified)
+	// None (no processing currently)
+	const EHoudiniAssetState State = HAC->GetAssetState();
+	if (State != EHoudiniAssetState::NeedInstantiation && State != EHoudiniAssetState::None)
+		return true;
+
+	// Selected HACs are always processed
+	if (HAC->IsOwnerSelected())
+		return true;
+
+	// Still has pending changes (cooking paused, waiting for upstream HDAs...)
+	if (HAC->NeedUpdate() || HAC->NeedOutputUpdate())
+		return true;
+
+#if WITH_EDITORONLY_DATA
+	if (HAC->bNeedToUpdateEditorProperties)
+		return true;
+#endif
+
+	if (State == EHoudiniAssetState::None)
+	{
+		// World inputs don't need to be polled, the HAC is queued again when their actors change
+
+		// Handles that have moved are waiting for their update timer
+		for (const UHoudiniHandleComponent* CurrentHandle : HAC->HandleComponents)
+		{
+			if (IsValid(CurrentHandle) && CurrentHandle->HasPendingTransformUpdate())
+				return true;
+		}
+
+		// Live synced node sync components need to poll their node's cook count to catch the changes made in Houdini.
+		// Session synced HACs are queued again by UpdateSessionSyncCookCount() instead.
+		if (UHoudiniNodeSyncComponent* HNSC = Cast<UHoudiniNodeSyncComponent>(HAC))
+		{
+			if (HNSC->GetLiveSyncEnabled())
+				return true;
+		}
+	}
+
+	return false;
+}
+
+void
+FHoudiniEngineManager::UpdateDormantComponents()
+{
+#if WITH_EDITOR && (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION > 0)
+	// Dormant HDAs can only wake up when a level instance enters/leaves edit mode
+	const ILevelInstanceInterface* EditingLevelInstance = nullptr;
+	UWorld* EditorWorld = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	ULevelInstanceSubsystem* LevelInstanceSubsystem = EditorWorld ? EditorWorld->GetSubsystem<ULevelInstanceSubsystem>() : nullptr;
+	if (LevelInstanceSubsystem)
+		EditingLevelInstance = LevelInstanceSubsystem->GetEditingLevelInstance();
+
+	if (EditingLevelInstance == LastEditingLevelInstance)
+		return;
+
+	LastEditingLevelInstance = EditingLevelInstance;
+	ActiveComponents.Append(DormantComponents);
+	DormantComponents.Empty();
+#endif
+}
+
+void
+FHoudiniEngineManager::UpdateSessionSyncCookCount()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineManager::UpdateSessionSyncCookCount);
+
+	if (!FHoudiniEngine::Get().IsSyncWithHoudiniCookEnabled() || !FHoudiniEngineRuntime::IsInitialized())
+	{
+		LastSessionSyncCookCount = -1;
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if ((Now - LastSessionSyncCookCountTime) <= CVarHoudiniEngineLiveSyncTickTime.GetValueOnAnyThread())
+		return;
+
+	LastSessionSyncCookCountTime = Now;
+
+	// Houdini doesn't notify us of its cooks, so a single count for the whole /obj network
+	// replaces polling the cook count of every HAC on every tick
+	HAPI_NodeId ObjNodeId = INDEX_NONE;
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetManagerNodeId(FHoudiniEngine::Get().GetSession(), HAPI_NODETYPE_OBJ, &ObjNodeId))
+		return;
+
+	const int32 CookCount = FHoudiniEngineUtils::HapiGetCookCount(ObjNodeId);
+	if (CookCount < 0 || CookCount == LastSessionSyncCookCount)
+		return;
+
+	LastSessionSyncCookCount = CookCount;
+
+	// Something cooked: let every HAC compare its own cook count on its next update.
+	// Our own cooks also change the count, which only costs the HACs one extra check.
+	FHoudiniEngineRuntime& Runtime = FHoudiniEngineRuntime::Get();
+	for (int32 Idx = 0; Idx < Runtime.GetRegisteredHoudiniComponentCount(); Idx++)
+	{
+		UHoudiniAssetComponent* HAC = Runtime.GetRegisteredHoudiniComponentAt(Idx);
+		if (!IsValid(HAC) || HAC->IsA<UHoudiniNodeSyncComponent>())
+			continue;
+
+		HAC->LastLiveSyncPingTime = 0.0;
+		Runtime.MarkHoudiniComponentDirty(HAC);
+	}
+}
+
+void
+FHoudiniEngineManager::OnEditorSelectionChanged(UObject* InObject)
+{
+#if WITH_EDITOR
+	if (!GEditor || !FHoudiniEngineRuntime::IsInitialized())
+		return;
+
+	// Newly selected HACs need to be processed, deselected ones will drop out of the active set on their own
+	for (FSelectionIterator It(GEditor->GetSelectedActorIterator()); It; ++It)
+	{
+		AActor* SelectedActor = Cast<AActor>(*It);
+		if (!IsValid(SelectedActor))
+			continue;
+
+		TInlineComponentArray<UHoudiniAssetComponent*> HACs(SelectedActor);
+		for (UHoudiniAssetComponent* HAC : HACs)
+			FHoudiniEngineRuntime::Get().MarkHoudiniComponentDirty(HAC);
+	}
+#endif
+}
+
 void
 FHoudiniEngineManager::AutoStartFirstSessionIfNeeded(UHoudiniAssetComponent* InCurrentHAC)
 {
@@ -665,6 +869,10 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 				FHoudiniEngineUtils::GatherAllAssetOutputs(HAC->GetAssetId(), HAC->bUseOutputNodes, HAC->bOutputTemplateGeos, HAC->bEnableCurveEditing, OutputNodes);
 				HAC->SetOutputNodeIds(OutputNodes);
 				
+				// Gather the nodes read by this cook so it gets scheduled after other cooks using them
+				TArray<HAPI_NodeId> DependencyNodeIds;
+				GatherCookDependencyNodeIds(HAC, DependencyNodeIds);
+
 				FGuid TaskGUID = HAC->GetHapiGUID();
 				if ( StartTaskAssetCooking(
 					HAC->GetAssetId(),
@@ -672,7 +880,8 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 					HAC->GetDisplayName(),
 					HAC->bUseOutputNodes,
 					HAC->bOutputTemplateGeos,
-					TaskGUID) )
+					TaskGUID,
+					DependencyNodeIds) )
 				{
 					// Updates the HAC's state
 					HAC->SetAssetState(EHoudiniAssetState::Cooking);
@@ -1136,7 +1345,8 @@ FHoudiniEngineManager::StartTaskAssetCooking(
 	const FString& DisplayName,
 	bool bUseOutputNodes,
 	bool bOutputTemplateGeos,
-	FGuid& OutTaskGUID)
+	FGuid& OutTaskGUID,
+	const TArray<HAPI_NodeId>& DependencyNodeIds)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineManager::StartTaskAssetCooking);
 
@@ -1163,6 +1373,7 @@ FHoudiniEngineManager::StartTaskAssetCooking(
 	if (NodeIdsToCook.Num() > 0)
 		Task.OtherNodeIds = NodeIdsToCook;
 
+	Task.DependencyNodeIds = DependencyNodeIds;
 	Task.bUseOutputNodes = bUseOutputNodes;
 	Task.bOutputTemplateGeos = bOutputTemplateGeos;
 
@@ -1171,6 +1382,40 @@ FHoudiniEngineManager::StartTaskAssetCooking(
 	return true;
 }
 
+void
+FHoudiniEngineManager::GatherCookDependencyNodeIds(UHoudiniAssetComponent* HAC, TArray<HAPI_NodeId>& OutNodeIds)
+{
+	if (!IsValid(HAC))
+		return;
+
+	for (int32 InputIdx = 0; InputIdx < HAC->GetNumInputs(); ++InputIdx)
+	{
+		const UHoudiniInput* CurrentInput = HAC->GetInputAt(InputIdx);
+		if (!IsValid(CurrentInput))
+			continue;
+
+		if (CurrentInput->GetInputNodeId() >= 0)
+			OutNodeIds.AddUnique(CurrentInput->GetInputNodeId());
+
+		const TArray<TObjectPtr<UHoudiniInputObject>>* ObjectArray = CurrentInput->GetHoudiniInputObjectArray(CurrentInput->GetInputType());
+		if (!ObjectArray)
+			continue;
+
+		for (const TObjectPtr<UHoudiniInputObject>& CurrentInputObject : *ObjectArray)
+		{
+			if (!IsValid(CurrentInputObject))
+				continue;
+
+			// Upstream HDAs are keyed by their asset node so their own cooks and ours share a lane
+			const UHoudiniAssetComponent* InputHAC = Cast<UHoudiniAssetComponent>(CurrentInputObject->GetObject());
+			if (IsValid(InputHAC) && InputHAC->GetAssetId() >= 0)
+				OutNodeIds.AddUnique(InputHAC->GetAssetId());
+			else if (CurrentInputObject->GetInputObjectNodeId() >= 0)
+				OutNodeIds.AddUnique(CurrentInputObject->GetInputObjectNodeId());
+		}
+	}
+}
+
 bool
 FHoudiniEngineManager::UpdateCooking(UHoudiniAssetComponent* HAC, EHoudiniAssetState& NewState)
 {
@@ -38,6 +38,7 @@
 
 class UHoudiniAsset;
 class UHoudiniAssetComponent;
+class ILevelInstanceInterface;
 
 struct FHoudiniEngineTaskInfo;
 struct FGuid;
@@ -115,7 +116,14 @@ protected:
 		const FString& DisplayName,
 		bool bUseOutputNodes,
 		bool bOutputTemplateGeos,
-		FGuid& OutTaskGUID);
+		FGuid& OutTaskGUID,
+		const TArray<HAPI_NodeId>& DependencyNodeIds = TArray<HAPI_NodeId>());
+
+	// Gathers the input and upstream HDA nodes read by the HAC's cook,
+	// used to schedule cooks sharing inputs on the same session
+	static void GatherCookDependencyNodeIds(
+		UHoudiniAssetComponent* HAC,
+		TArray<HAPI_NodeId>& OutNodeIds);
 
 	// Updates progress of the cooking task
 	// Returns true if a state change should be made
@@ -170,6 +178,24 @@ protected:
 	// Automatically try to start the First HE session if needed
 	void AutoStartFirstSessionIfNeeded(UHoudiniAssetComponent* InCurrentHAC);
 
+	// Gathers the components that need to be processed this tick from the active set,
+	// the runtime's dirty queue and the round robin component.
+	void GatherComponentsToProcess(TArray<UHoudiniAssetComponent*>& OutComponentsToProcess);
+
+	// Returns true if an idle HAC still needs to be looked at on the next tick
+	// (selected, waiting for an update, or with handles waiting for their update timer)
+	bool NeedsToStayActive(UHoudiniAssetComponent* HAC) const;
+
+	// Reactivates the dormant components when the level instance being edited changes
+	void UpdateDormantComponents();
+
+	// Queues the HACs of the currently selected actors for processing
+	void OnEditorSelectionChanged(UObject* InObject);
+
+	// With Session Sync's "sync with Houdini cook", polls the total cook count of the Houdini scene
+	// and queues every HAC once when it changes, so they can look for their own changes.
+	void UpdateSessionSyncCookCount();
+
 private:
 
 	// Ticker handle, used for processing HAC.
@@ -181,6 +207,26 @@ private:
 	// Current number of components in the array
 	uint32 ComponentCount;
 
+	// Components that have work to do or are selected, and are processed every tick.
+	// Idle components are removed from this set and only come back when marked dirty.
+	TSet<TWeakObjectPtr<UHoudiniAssetComponent>> ActiveComponents;
+
+	// Dormant components (in an uneditable level instance), waiting for a level instance edit change
+	TSet<TWeakObjectPtr<UHoudiniAssetComponent>> DormantComponents;
+
+	// The level instance being edited when the dormant components were last checked
+	const ILevelInstanceInterface* LastEditingLevelInstance;
+
+	// Cooking enabled state on the previous tick, used to refresh all components when pausing/resuming
+	bool bWasCookingEnabled;
+
+	// Total cook count of the Houdini scene when it was last polled for Session Sync, and when it was polled
+	int32 LastSessionSyncCookCount;
+	double LastSessionSyncCookCountTime;
+
+	// Handle to the editor's selection changed delegate
+	FDelegateHandle SelectionChangedHandle;
+
 	// Stopping flag. 
 	// Indicates that we should stop ticking asap
 	bool bMustStopTicking;
@@ -377,6 +377,7 @@
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_OBJECT               TEXT( "HoudiniGeneratedObject" )
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_NAME                 TEXT( "HoudiniGeneratedName" )
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_TYPE         TEXT( "HoudiniGeneratedTextureType" )
+#define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH         TEXT( "HoudiniGeneratedTextureHash" )
 #define HAPI_UNREAL_PACKAGE_META_NODE_PATH                      TEXT( "HoudiniNodePath" )
 #define HAPI_UNREAL_PACKAGE_META_BAKE_COUNTER                   TEXT( "HoudiniPackageBakeCounter" )
 #define HAPI_UNREAL_PACKAGE_META_BAKED_OBJECT					TEXT( "HoudiniBakedObject" )
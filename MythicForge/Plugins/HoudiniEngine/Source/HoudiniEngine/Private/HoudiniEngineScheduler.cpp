@@ -32,42 +32,30 @@
 #include "HoudiniEngine.h"
 
 const uint32
-FHoudiniEngineScheduler::InitialTaskSize = 256u;
+FHoudiniEngineScheduler::TaskQueueCapacity = 16384u;
 
-// Update frequency in (ms) for polling the scheduler
+// Time (in s) between two polls of a cook's status
 const float
 FHoudiniEngineScheduler::UpdateFrequency = 0.1f;
 
-FHoudiniEngineScheduler::FHoudiniEngineScheduler()
-	: WakeUpEvent(FEventRef(EEventMode::AutoReset))
-	, Tasks(nullptr)
-	, PositionWrite(0u)
-	, PositionRead(0u)
+FHoudiniEngineScheduler::FHoudiniEngineScheduler(int32 InSessionIndex)
+	: SessionIndex(InSessionIndex)
+	, WakeUpEvent(FEventRef(EEventMode::AutoReset))
+	, Tasks(FHoudiniEngineScheduler::TaskQueueCapacity)
 	, bStopping(false)
 {
-	//  Make sure size is power of two.
-	TaskCount = FPlatformMath::RoundUpToPowerOfTwo(FHoudiniEngineScheduler::InitialTaskSize);
-
-	if (TaskCount)
-	{
-		// Allocate buffer to store all tasks.
-		Tasks = static_cast<FHoudiniEngineTask *>(FMemory::Malloc(TaskCount * sizeof(FHoudiniEngineTask)));
-
-		if (Tasks)
-		{
-			// Zero memory.
-			FMemory::Memset(Tasks, 0x0, TaskCount * sizeof(FHoudiniEngineTask));
-		}
-	}
 }
 
 FHoudiniEngineScheduler::~FHoudiniEngineScheduler()
 {
-	if (TaskCount)
-	{
-		FMemory::Free(Tasks);
-		Tasks = nullptr;
-	}
+}
+
+const HAPI_Session*
+FHoudiniEngineScheduler::GetSession() const
+{
+	// Fall back to the main session if the pool has shrunk since this scheduler was created
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession(SessionIndex);
+	return Session ? Session : FHoudiniEngine::Get().GetSession();
 }
 
 void
@@ -169,7 +157,7 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 
 	// We instantiate without cooking.
 	Result = FHoudiniApi::CreateNode(
-		FHoudiniEngine::Get().GetSession(), -1, &AssetNameString[0], nullptr, false, &AssetId);
+		GetSession(), -1, &AssetNameString[0], nullptr, false, &AssetId);
 	if (Result != HAPI_RESULT_SUCCESS)
 	{
 		AddResponseMessageTaskInfo(
@@ -189,18 +177,21 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 
 	//TaskInfo.bLoadedComponent = Task.bLoadedComponent;
 	TaskDescription(TaskInfo, Task.ActorName, TEXT("Started Instantiation"));
-	FHoudiniEngine::Get().AddTaskInfo(Task.HapiGUID, TaskInfo);
+	ResponseTaskInfos.Enqueue(Task.HapiGUID, TaskInfo);
 
 	// We need to spin until instantiation is finished.
 	while (true)
 	{
 		int Status = HAPI_STATE_STARTING_COOK;
 		HOUDINI_CHECK_ERROR_GET(&Result, FHoudiniApi::GetStatus(
-			FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status));
+			GetSession(), HAPI_STATUS_COOK_STATE, &Status));
 
 		if (Status == HAPI_STATE_READY)
 		{
 			// Cooking has been successful.
+			// Instantiation cooks the asset, strings resolved meanwhile can use stale handles.
+			FHoudiniEngineString::InvalidateStringCache();
+
 			AddResponseMessageTaskInfo(
 				HAPI_RESULT_SUCCESS, 
 				EHoudiniEngineTaskType::AssetInstantiation,
@@ -212,9 +203,11 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 		else if (Status == HAPI_STATE_READY_WITH_FATAL_ERRORS || Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
 		{
 			// There was an error while instantiating.
-			FString CookResultString = FHoudiniEngineUtils::GetCookResult();
+			FHoudiniEngineString::InvalidateStringCache();
+
+			FString CookResultString = FHoudiniEngineUtils::GetCookResult(GetSession());
 			int32 CookResult = static_cast<int32>(HAPI_RESULT_SUCCESS);
-			FHoudiniApi::GetStatus(FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_RESULT, &CookResult);
+			FHoudiniApi::GetStatus(GetSession(), HAPI_STATUS_COOK_RESULT, &CookResult);
 
 			EHoudiniEngineTaskState TaskStateResult = EHoudiniEngineTaskState::FinishedWithFatalError;
 			if (Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
@@ -253,7 +246,7 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 		{
 			// Reset update time.
 			LastUpdateTime = FPlatformTime::Seconds();
-			const FString& CookStateMessage = FHoudiniEngineUtils::GetCookState();
+			const FString& CookStateMessage = FHoudiniEngineUtils::GetCookState(GetSession());
 
 			AddResponseMessageTaskInfo(
 				HAPI_RESULT_SUCCESS,
@@ -263,7 +256,7 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 		}
 
 		// We want to yield.
-		FPlatformProcess::SleepNoStats(UpdateFrequency);
+		WaitBeforeNextPoll();
 	}
 }
 
@@ -325,7 +318,7 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 	EHoudiniEngineTaskState GlobalTaskResult = EHoudiniEngineTaskState::Success;
 	for (auto& CurrentNodeId : NodesToCook)
 	{
-		Result = FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentNodeId, &CookOptions);
+		Result = FHoudiniEngineUtils::HapiStartCookNode(CurrentNodeId, &CookOptions, GetSession());
 		if (Result != HAPI_RESULT_SUCCESS)
 		{
 			AddResponseMessageTaskInfo(
@@ -354,16 +347,21 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 		{
 			int32 Status = HAPI_STATE_STARTING_COOK;
 			HOUDINI_CHECK_ERROR_GET(&Result, FHoudiniApi::GetStatus(
-				FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status));
+				GetSession(), HAPI_STATUS_COOK_STATE, &Status));
 
 			if (Status == HAPI_STATE_READY)
 			{
 				// Cooking has been successful.
+				// Strings resolved during the cook can use stale handles.
+				FHoudiniEngineString::InvalidateStringCache();
+
 				// Break to process the next node
 				break;
 			}
 			else if (Status == HAPI_STATE_READY_WITH_FATAL_ERRORS || Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
 			{
+				FHoudiniEngineString::InvalidateStringCache();
+
 				GlobalTaskResult = EHoudiniEngineTaskState::FinishedWithFatalError;
 
 				if (Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
@@ -398,7 +396,7 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 				LastUpdateTime = FPlatformTime::Seconds();
 
 				// Retrieve status string.
-				const FString & CookStateMessage = FHoudiniEngineUtils::GetCookState();
+				const FString & CookStateMessage = FHoudiniEngineUtils::GetCookState(GetSession());
 
 				AddResponseMessageTaskInfo(
 					HAPI_RESULT_SUCCESS,
@@ -408,7 +406,7 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 			}
 
 			// We want to yield.
-			FPlatformProcess::SleepNoStats(UpdateFrequency);
+			WaitBeforeNextPoll();
 		}
 	}	
 
@@ -484,7 +482,7 @@ FHoudiniEngineScheduler::AddResponseTaskInfo(
 	//TaskInfo.bLoadedComponent = Task.bLoadedComponent;
 
 	TaskDescription(TaskInfo, Task.ActorName, StatusString);
-	FHoudiniEngine::Get().AddTaskInfo(Task.HapiGUID, TaskInfo);
+	ResponseTaskInfos.Enqueue(Task.HapiGUID, TaskInfo);
 }
 
 void
@@ -497,7 +495,19 @@ FHoudiniEngineScheduler::AddResponseMessageTaskInfo(
 	//TaskInfo.bLoadedComponent = Task.bLoadedComponent;
 
 	TaskDescription(TaskInfo, Task.ActorName, ErrorMessage);
-	FHoudiniEngine::Get().AddTaskInfo(Task.HapiGUID, TaskInfo);
+	ResponseTaskInfos.Enqueue(Task.HapiGUID, TaskInfo);
+}
+
+bool
+FHoudiniEngineScheduler::DequeueResponseTaskInfo(FGuid& OutHapiGUID, FHoudiniEngineTaskInfo& OutTaskInfo)
+{
+	TOptional<TPair<FGuid, FHoudiniEngineTaskInfo>> Response = ResponseTaskInfos.Dequeue();
+	if (!Response.IsSet())
+		return false;
+
+	OutHapiGUID = Response->Key;
+	OutTaskInfo = Response->Value;
+	return true;
 }
 
 void
@@ -507,22 +517,10 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 	{
 		while (true)
 		{
+			// Retrieve task, stop if we have no tasks left.
 			FHoudiniEngineTask Task;
-
-			{
-				FScopeLock ScopeLock(&CriticalSection);
-
-				// We have no tasks left.
-				if (PositionWrite == PositionRead)
-					break;
-
-				// Retrieve task.
-				Task = Tasks[PositionRead];
-				PositionRead++;
-
-				// Wrap around if required.
-				PositionRead &= (TaskCount - 1);
-			}
+			if (!Tasks.TryDequeue(Task))
+				break;
 
 			bool bTaskProcessed = true;
 
@@ -565,8 +563,9 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 
 		if (FPlatformProcess::SupportsMultithreading())
 		{
-			// We want to yield for a bit.
-			WakeUpEvent->Wait(UpdateFrequency * 1000.0f);
+			// Sleep until a new task is added (or we are asked to stop).
+			// The event is auto reset, so a trigger happening after the queue was drained is not lost.
+			WakeUpEvent->Wait();
 		}
 		else
 		{
@@ -628,67 +627,50 @@ FHoudiniEngineScheduler::TaskProccessAsset(const FHoudiniEngineTask & Task)
 	// TODO: Process results!
 }
 
+void
+FHoudiniEngineScheduler::WaitBeforeNextPoll()
+{
+	if (!FPlatformProcess::SupportsMultithreading())
+	{
+		FPlatformProcess::SleepNoStats(UpdateFrequency);
+		return;
+	}
+
+	// Wait on the wake-up event, like the task loop, so Stop() doesn't have to wait for a full polling interval.
+	// Consuming a trigger from AddTask() here is fine: the queue is drained again once the current task is done.
+	WakeUpEvent->Wait(FMath::Max(1u, (uint32)(UpdateFrequency * 1000.0f)));
+}
+
 bool FHoudiniEngineScheduler::HasPendingTasks()
 {
-	FScopeLock ScopeLock(&CriticalSection);
-	return (PositionWrite != PositionRead);
+	return !Tasks.IsEmpty();
 }
 
 void
 FHoudiniEngineScheduler::AddTask(const FHoudiniEngineTask & Task)
 {
-	FScopeLock ScopeLock(&CriticalSection);
-
-	// Check if we need to grow our circular buffer.
-	if (PositionWrite + 1 == PositionRead)
+	// The queue is bounded, if it is full wait for the scheduler thread to make some room.
+	bool bWarned = false;
+	while (!Tasks.TryEnqueue(Task))
 	{
-		// Calculate next size (next power of two).
-		uint32 NextTaskCount = FPlatformMath::RoundUpToPowerOfTwo(TaskCount + 1);
-
-		// Allocate new buffer.
-		FHoudiniEngineTask * Buffer = static_cast<FHoudiniEngineTask *>(
-			FMemory::Malloc(NextTaskCount * sizeof(FHoudiniEngineTask)));
-
-		if (!Buffer)
-			return;
-
-		// Zero memory.
-		FMemory::Memset(Buffer, 0x0, NextTaskCount * sizeof(FHoudiniEngineTask));
-
-		// Copy elements from old buffer to new one.
-		if (PositionRead < PositionWrite)
+		if (!bWarned)
 		{
-			FMemory::Memcpy(Buffer, Tasks + PositionRead, sizeof(FHoudiniEngineTask) * (PositionWrite - PositionRead));
+			HOUDINI_LOG_WARNING(TEXT("Houdini Engine Scheduler: task queue is full (%d tasks), waiting for room."), Tasks.GetCapacity());
+			bWarned = true;
+		}
 
-			// Update index positions.
-			PositionRead = 0;
-			PositionWrite = PositionWrite - PositionRead;
+		WakeUpEvent->Trigger();
+		if (!FPlatformProcess::SupportsMultithreading())
+		{
+			// No scheduler thread to drain the queue, process the tasks now
+			Tick();
 		}
 		else
 		{
-			FMemory::Memcpy(Buffer, Tasks + PositionRead, sizeof(FHoudiniEngineTask) * (TaskCount - PositionRead));
-			FMemory::Memcpy(Buffer + TaskCount - PositionRead, Tasks, sizeof(FHoudiniEngineTask) * PositionWrite);
-
-			// Update index positions.
-			PositionRead = 0;
-			PositionWrite = TaskCount - PositionRead + PositionWrite;
+			FPlatformProcess::Yield();
 		}
-
-		// Deallocate old buffer.
-		FMemory::Free(Tasks);
-
-		// Bookkeeping.
-		Tasks = Buffer;
-		TaskCount = NextTaskCount;
 	}
 
-	// Store task.
-	Tasks[PositionWrite] = Task;
-	PositionWrite++;
-
-	// Wrap around if required.
-	PositionWrite &= (TaskCount - 1);
-
 	// Wake up the thread to process the task.
 	WakeUpEvent->Trigger();
 }
@@ -704,6 +686,9 @@ void
 FHoudiniEngineScheduler::Stop()
 {
 	bStopping = true;
+
+	// The scheduler thread might be waiting for tasks
+	WakeUpEvent->Trigger();
 }
 
 void
@@ -28,6 +28,8 @@
 
 #include "HoudiniEngineTask.h"
 #include "HoudiniEngineTaskInfo.h"
+#include "HoudiniEngineTaskQueue.h"
+#include "Containers/SpscQueue.h"
 #include "HAL/Event.h"
 #include "HAL/Runnable.h"
 #include "HAL/RunnableThread.h"
@@ -37,7 +39,8 @@ class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
 {
 public:
 
-	FHoudiniEngineScheduler();
+	// Each scheduler runs its tasks on the session at InSessionIndex in FHoudiniEngine's session pool
+	FHoudiniEngineScheduler(int32 InSessionIndex = 0);
 	virtual ~FHoudiniEngineScheduler();
 
 	// FRunnable methods.
@@ -50,9 +53,16 @@ public:
 
 	bool HasPendingTasks();
 
-	// Adds a task.
+	// Index of the session used by this scheduler in the session pool
+	int32 GetSessionIndex() const { return SessionIndex; }
+
+	// Adds a task. Can be called from any thread.
 	void AddTask(const FHoudiniEngineTask & Task);
 
+	// Retrieves the oldest task info response posted by the scheduler thread.
+	// Must only be called from a single consumer thread (the game thread).
+	bool DequeueResponseTaskInfo(FGuid& OutHapiGUID, FHoudiniEngineTaskInfo& OutTaskInfo);
+
 	// Adds instantiation response task info.
 	void AddResponseTaskInfo(
 		HAPI_Result Result, 
@@ -71,6 +81,9 @@ public:
 
 protected:
 
+	// The session used to run this scheduler's tasks
+	const HAPI_Session* GetSession() const;
+
 	// Process queued tasks. 
 	void ProcessQueuedTasks();
 
@@ -92,32 +105,29 @@ protected:
 	// Process the result of a sucesfull cook
 	void TaskProccessAsset(const FHoudiniEngineTask & Task);
 
+	// Waits UpdateFrequency between two polls of a cook's status, or less if the scheduler is woken up
+	void WaitBeforeNextPoll();
+
 private:
 
-	// Initial number of tasks in our circular queue. 
-	static const uint32 InitialTaskSize;
+	// Maximum number of tasks waiting in the queue.
+	static const uint32 TaskQueueCapacity;
 
-	// Frequency update (sleep time between each update)
+	// Time (in s) between two polls of a cook's status
 	static const float UpdateFrequency;
 
-	// Synchronization primitive. 
-	FCriticalSection CriticalSection;
+	// Index of the session used by this scheduler
+	int32 SessionIndex;
 
 	// Event to wake up thread when tasks become available. 
 	FEventRef WakeUpEvent;
 
-	// List of scheduled tasks. 
-	FHoudiniEngineTask* Tasks;
-
-	// Head of the circular queue. 
-	uint32 PositionWrite;
-
-	// Tail of the circular queue. 
-	uint32 PositionRead;
+	// Scheduled tasks, filled by any thread and consumed by the scheduler thread.
+	THoudiniBoundedMpscQueue<FHoudiniEngineTask> Tasks;
 
-	// Size of the circular queue. 
-	uint32 TaskCount;
+	// Task info responses, filled by the scheduler thread and consumed by the game thread.
+	TSpscQueue<TPair<FGuid, FHoudiniEngineTaskInfo>> ResponseTaskInfos;
 
 	// Stopping flag. 
-	bool bStopping;
+	std::atomic<bool> bStopping;
 };
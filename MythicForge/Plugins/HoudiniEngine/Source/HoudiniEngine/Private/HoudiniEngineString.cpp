@@ -30,9 +30,141 @@
 #include "HoudiniEngine.h"
 #include "HoudiniEnginePrivatePCH.h"
 
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeRWLock.h"
+
 #include <vector>
 
-FCriticalSection FHoudiniEngineString::GetStringCriticalSection;
+static TAutoConsoleVariable<int32> CVarHoudiniEngineStringHandleCache(
+	TEXT("HoudiniEngine.StringHandleCache"),
+	1,
+	TEXT("Caches the strings resolved from HAPI string handles until the next cook.\n")
+	TEXT("0: Always resolve string handles with HAPI\n")
+	TEXT("1: Reuse the strings resolved since the last cook: Default\n")
+);
+
+// Strings resolved on a given session, valid until the next cook on that session.
+struct FHoudiniSessionStringCache
+{
+	// We can only get one string batch at a time on a session. Otherwise another thread
+	// could clear the string table data before we actually get to retrieve it.
+	FCriticalSection BatchLock;
+
+	// Protects Strings and Generation
+	FRWLock StringsLock;
+	TMap<HAPI_StringHandle, FString> Strings;
+
+	// Incremented on every invalidation, so strings fetched before a cook are not added after it
+	uint32 Generation = 0;
+};
+
+static FCriticalSection HoudiniSessionStringCachesLock;
+static TMap<const HAPI_Session*, TSharedPtr<FHoudiniSessionStringCache, ESPMode::ThreadSafe>> HoudiniSessionStringCaches;
+
+// Returns the string cache of the given session, creating it if needed
+static TSharedPtr<FHoudiniSessionStringCache, ESPMode::ThreadSafe>
+FindOrAddSessionStringCache(const HAPI_Session* InSession)
+{
+	FScopeLock ScopeLock(&HoudiniSessionStringCachesLock);
+	TSharedPtr<FHoudiniSessionStringCache, ESPMode::ThreadSafe>& Cache = HoudiniSessionStringCaches.FindOrAdd(InSession);
+	if (!Cache.IsValid())
+		Cache = MakeShared<FHoudiniSessionStringCache, ESPMode::ThreadSafe>();
+
+	return Cache;
+}
+
+// Fills OutStrings with the strings of the unique handles InUniqueHandles.
+// Cached strings are reused, and the missing ones are fetched with a single string batch.
+static bool
+ResolveUniqueStringHandles(
+	const TArray<int32>& InUniqueHandles,
+	FString* OutStrings,
+	const HAPI_Session* InSession)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ResolveUniqueStringHandles);
+
+	const bool bUseCache = CVarHoudiniEngineStringHandleCache.GetValueOnAnyThread() != 0;
+	TSharedPtr<FHoudiniSessionStringCache, ESPMode::ThreadSafe> Cache = FindOrAddSessionStringCache(InSession);
+
+	// Only fetch the handles that haven't been resolved since the last cook
+	TArray<int32> MissingHandles;
+	TArray<int32> MissingIndices;
+	uint32 Generation = 0;
+	if (bUseCache)
+	{
+		FReadScopeLock ReadLock(Cache->StringsLock);
+		Generation = Cache->Generation;
+		for (int32 Idx = 0; Idx < InUniqueHandles.Num(); Idx++)
+		{
+			if (const FString* CachedString = Cache->Strings.Find(InUniqueHandles[Idx]))
+			{
+				OutStrings[Idx] = *CachedString;
+			}
+			else
+			{
+				MissingHandles.Add(InUniqueHandles[Idx]);
+				MissingIndices.Add(Idx);
+			}
+		}
+	}
+	else
+	{
+		MissingHandles = InUniqueHandles;
+		MissingIndices.SetNumUninitialized(InUniqueHandles.Num());
+		for (int32 Idx = 0; Idx < InUniqueHandles.Num(); Idx++)
+			MissingIndices[Idx] = Idx;
+	}
+
+	if (MissingHandles.Num() <= 0)
+		return true;
+
+	int32 BufferSize = 0;
+	TArray<char> Buffer;
+	{
+		FScopeLock GetStringDataScopeLock(&Cache->BatchLock);
+
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatchSize(
+			InSession, MissingHandles.GetData(), MissingHandles.Num(), &BufferSize))
+			return false;
+
+		if (BufferSize <= 0)
+			return false;
+
+		Buffer.SetNumZeroed(BufferSize);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatch(InSession, &Buffer[0], BufferSize))
+			return false;
+	}
+
+	// Parse the buffer, the strings are in the same order as the handles
+	int32 Index = 0;
+	int32 StringOffset = 0;
+	while (StringOffset < BufferSize && Index < MissingHandles.Num())
+	{
+		OutStrings[MissingIndices[Index]] = UTF8_TO_TCHAR(&Buffer[StringOffset]);
+
+		// Move on to next indexed string
+		Index++;
+		while (StringOffset < BufferSize && Buffer[StringOffset] != 0)
+			StringOffset++;
+
+		StringOffset++;
+	}
+
+	if (Index != MissingHandles.Num())
+		return false;
+
+	if (bUseCache)
+	{
+		FWriteScopeLock WriteLock(Cache->StringsLock);
+		if (Cache->Generation == Generation)
+		{
+			for (int32 Idx = 0; Idx < MissingHandles.Num(); Idx++)
+				Cache->Strings.Add(MissingHandles[Idx], OutStrings[MissingIndices[Idx]]);
+		}
+	}
+
+	return true;
+}
 
 FHoudiniEngineString::FHoudiniEngineString()
 	: StringId(-1)
@@ -134,15 +266,41 @@ bool
 FHoudiniEngineString::ToFString(FString& String, const HAPI_Session* InSession) const
 {
 	String = TEXT("");
+	if (StringId <= 0)
+		return false;
+
+	const HAPI_Session* Session = InSession ? InSession : FHoudiniEngine::Get().GetSession();
+	const bool bUseCache = CVarHoudiniEngineStringHandleCache.GetValueOnAnyThread() != 0;
+	TSharedPtr<FHoudiniSessionStringCache, ESPMode::ThreadSafe> Cache;
+	uint32 Generation = 0;
+	if (bUseCache)
+	{
+		Cache = FindOrAddSessionStringCache(Session);
+
+		FReadScopeLock ReadLock(Cache->StringsLock);
+		if (const FString* CachedString = Cache->Strings.Find(StringId))
+		{
+			String = *CachedString;
+			return true;
+		}
+
+		Generation = Cache->Generation;
+	}
+
 	std::string NamePlain = "";
+	if (!ToStdString(NamePlain, Session))
+		return false;
 
-	if (ToStdString(NamePlain, InSession))
+	String = UTF8_TO_TCHAR(NamePlain.c_str());
+
+	if (Cache.IsValid())
 	{
-		String = UTF8_TO_TCHAR(NamePlain.c_str());
-		return true;
+		FWriteScopeLock WriteLock(Cache->StringsLock);
+		if (Cache->Generation == Generation)
+			Cache->Strings.Add(StringId, String);
 	}
 
-	return false;
+	return true;
 }
 
 bool
@@ -236,64 +394,69 @@ FHoudiniEngineString::SHArrayToFStringArray_Batch(
 	FString* OutStringArray,
 	const HAPI_Session* InSession)
 {
-    bool bReturn = true;
-
-    TSet<int32> UniqueSH;
-    for (const auto& CurrentSH : InStringIdArray)
-    {
-        UniqueSH.Add(CurrentSH);
-    }
-
-    TArray<int32> UniqueSHArray = UniqueSH.Array();
+	TArray<FString> UniqueStrings;
+	TArray<int32> Indices;
+	if (!SHArrayToUniqueStrings(InStringIdArray, UniqueStrings, Indices, InSession))
+		return false;
 
-	int32 BufferSize = 0;
-	TArray<char> Buffer;
+	// Fill the output array using the unique strings
+	for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
 	{
-		// We can only get one string batch at a time. Otherwise another thread could clear the 
-		// string table data before actually get to retrieve it.
-		FScopeLock GetStringDataScopeLock(&GetStringCriticalSection);
-
-		if (HAPI_RESULT_SUCCESS
-			!= FHoudiniApi::GetStringBatchSize(InSession ? InSession : FHoudiniEngine::Get().GetSession(), UniqueSHArray.GetData(),
-											   UniqueSHArray.Num(), &BufferSize))
-			return false;
-
-		if (BufferSize <= 0)
-			return false;
-
-		Buffer.SetNumZeroed(BufferSize);
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatch(InSession ? InSession : FHoudiniEngine::Get().GetSession(), &Buffer[0], BufferSize))
-			return false;
+		OutStringArray[IdxSH] = UniqueStrings[Indices[IdxSH]];
 	}
 
-    // Parse the buffer to a string array
-    TMap<int, FString> StringMap;
-    int Index = 0;
-    int StringOffset = 0;
-    while (StringOffset < BufferSize)
-    {
-        // Add the current string to our dictionary.
-        FString StringValue = UTF8_TO_TCHAR(& Buffer[StringOffset]);
-        StringMap.Add(UniqueSHArray[Index], StringValue);
+	return true;
+}
 
-        // Move on to next indexed string
-        Index++;
-        while (Buffer[StringOffset] != 0 && StringOffset < BufferSize)
-            StringOffset++;
+bool
+FHoudiniEngineString::SHArrayToUniqueStrings(
+	const TArray<int32>& InStringIdArray,
+	TArray<FString>& OutUniqueStrings,
+	TArray<int32>& OutIndices,
+	const HAPI_Session* InSession)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineString::SHArrayToUniqueStrings);
 
-        StringOffset++;
-    }
+	OutUniqueStrings.Empty();
+	OutIndices.SetNumUninitialized(InStringIdArray.Num());
 
-    if (StringMap.Num() != UniqueSH.Num())
-        return false;
+	// Attributes usually only hold a handful of unique handles
+	TArray<int32> UniqueSHArray;
+	TMap<int32, int32> UniqueSHToIndex;
+	for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
+	{
+		const int32 CurrentSH = InStringIdArray[IdxSH];
+		const int32* FoundIndex = UniqueSHToIndex.Find(CurrentSH);
+		if (FoundIndex)
+		{
+			OutIndices[IdxSH] = *FoundIndex;
+		}
+		else
+		{
+			const int32 NewIndex = UniqueSHArray.Add(CurrentSH);
+			UniqueSHToIndex.Add(CurrentSH, NewIndex);
+			OutIndices[IdxSH] = NewIndex;
+		}
+	}
 
-    // Fill the output array using the map
-    for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
-    {
-        OutStringArray[IdxSH] = StringMap[InStringIdArray[IdxSH]];
-    }
+	if (UniqueSHArray.Num() <= 0)
+		return true;
 
-    return true;
+	OutUniqueStrings.SetNum(UniqueSHArray.Num());
+	return ResolveUniqueStringHandles(
+		UniqueSHArray, OutUniqueStrings.GetData(), InSession ? InSession : FHoudiniEngine::Get().GetSession());
+}
+
+void
+FHoudiniEngineString::InvalidateStringCache()
+{
+	FScopeLock ScopeLock(&HoudiniSessionStringCachesLock);
+	for (auto& CurrentCache : HoudiniSessionStringCaches)
+	{
+		FWriteScopeLock WriteLock(CurrentCache.Value->StringsLock);
+		CurrentCache.Value->Strings.Empty();
+		CurrentCache.Value->Generation++;
+	}
 }
 
 bool
@@ -411,6 +574,40 @@ void FHoudiniEngineIndexedStringMap::InitializeFromStringHandles(const TArray<HA
 	Strings.Empty();
 	StringToId.Empty();
 
+	// Resolve each unique handle once, and only index the unique strings
+	TArray<FString> UniqueStrings;
+	TArray<int32> Indices;
+	if (FHoudiniEngineString::SHArrayToUniqueStrings(StringHandles, UniqueStrings, Indices, Session))
+	{
+		// Different handles can still hold the same string
+		TArray<StringId> UniqueIds;
+		UniqueIds.SetNumUninitialized(UniqueStrings.Num());
+		Strings.Reserve(UniqueStrings.Num());
+		for (int UniqueIndex = 0; UniqueIndex < UniqueStrings.Num(); UniqueIndex++)
+		{
+			const StringId* Found = StringToId.Find(UniqueStrings[UniqueIndex]);
+			if (Found != nullptr)
+			{
+				UniqueIds[UniqueIndex] = *Found;
+			}
+			else
+			{
+				const StringId Id = Strings.Num();
+				StringToId.Add(UniqueStrings[UniqueIndex], Id);
+				Strings.Add(MoveTemp(UniqueStrings[UniqueIndex]));
+				UniqueIds[UniqueIndex] = Id;
+			}
+		}
+
+		for (int StringHandleIndex = 0; StringHandleIndex < StringHandles.Num(); StringHandleIndex++)
+			Ids[StringHandleIndex] = UniqueIds[Indices[StringHandleIndex]];
+
+		return;
+	}
+
+	// The batch failed, resolve the handles one by one
+	Strings.Empty();
+	StringToId.Empty();
 	for (int StringHandleIndex = 0; StringHandleIndex < StringHandles.Num(); StringHandleIndex++)
 	{
 		FString NewString;
@@ -88,6 +88,20 @@ class HOUDINIENGINE_API FHoudiniEngineString
 			FString*  OutStringArray,
 			const HAPI_Session* InSession = nullptr);
 
+		// Resolves the unique handles of InStringIdArray with a single string batch.
+		// OutUniqueStrings receives each unique string once, and OutIndices the index
+		// in OutUniqueStrings of every entry of InStringIdArray.
+		static bool SHArrayToUniqueStrings(
+			const TArray<int32>& InStringIdArray,
+			TArray<FString>& OutUniqueStrings,
+			TArray<int32>& OutIndices,
+			const HAPI_Session* InSession = nullptr);
+
+		// Clears the resolved strings cached for all the sessions: the pooled sessions connect to
+		// the same server and share its nodes, so a cook on any of them can reuse string handles.
+		// Called by FHoudiniEngineUtils::HapiStartCookNode, when cooks complete and on session changes.
+		static void InvalidateStringCache();
+
 		// Return id of this string.
 		int32 GetId() const;
 
@@ -98,12 +112,6 @@ class HOUDINIENGINE_API FHoudiniEngineString
 
 		// Id of the underlying Houdini Engine string.
 		int32 StringId;
-
-	private:
-
-		// Needed to lock the HAPI string table, otherwise it may get cleared by a HAPI call from
-		// another thread.
-		static FCriticalSection GetStringCriticalSection;
 };
 
 class FHoudiniEngineRawStrings
@@ -92,6 +92,11 @@ struct HOUDINIENGINE_API FHoudiniEngineTask
 	// Additional Node Id for the task
 	// Can be used to apply a task to multiple nodes in the same HDA
 	TArray<HAPI_NodeId> OtherNodeIds;
+
+	// Upstream nodes this task reads from (inputs, upstream HDAs).
+	// Used to keep tasks sharing nodes on the same scheduler lane.
+	TArray<HAPI_NodeId> DependencyNodeIds;
+
 	// Cook results for each output node.
 	TMap<HAPI_NodeId, bool> CookResults;
 
@@ -0,0 +1,151 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+/**
+ * Bounded lock-free queue supporting multiple producers and a single consumer.
+ *
+ * Each cell of the ring carries a sequence number telling producers whether the cell is free
+ * for the current lap, and telling the consumer whether the cell has been published.
+ * Producers only contend on a single atomic increment, and never on the consumer.
+ */
+template<typename ElementType>
+class THoudiniBoundedMpscQueue
+{
+public:
+
+	explicit THoudiniBoundedMpscQueue(uint32 InCapacity)
+	{
+		// Make sure the capacity is a power of two so we can mask the positions.
+		Capacity = FPlatformMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, 2u));
+		Mask = Capacity - 1;
+
+		Cells = new FCell[Capacity];
+		for (uint32 Idx = 0; Idx < Capacity; Idx++)
+			Cells[Idx].Sequence.store(Idx, std::memory_order_relaxed);
+
+		EnqueuePos.store(0, std::memory_order_relaxed);
+		DequeuePos.store(0, std::memory_order_relaxed);
+	}
+
+	~THoudiniBoundedMpscQueue()
+	{
+		delete[] Cells;
+		Cells = nullptr;
+	}
+
+	THoudiniBoundedMpscQueue(const THoudiniBoundedMpscQueue&) = delete;
+	THoudiniBoundedMpscQueue& operator=(const THoudiniBoundedMpscQueue&) = delete;
+
+	// Adds an element to the queue. Can be called from any thread.
+	// Returns false if the queue is full.
+	bool TryEnqueue(const ElementType& InElement)
+	{
+		ElementType Copy(InElement);
+		return TryEnqueue(MoveTemp(Copy));
+	}
+
+	bool TryEnqueue(ElementType&& InElement)
+	{
+		FCell* Cell = nullptr;
+		uint32 Pos = EnqueuePos.load(std::memory_order_relaxed);
+		while (true)
+		{
+			Cell = &Cells[Pos & Mask];
+			const uint32 Sequence = Cell->Sequence.load(std::memory_order_acquire);
+			const int32 Diff = static_cast<int32>(Sequence - Pos);
+			if (Diff == 0)
+			{
+				// The cell is free for this lap, try to claim it
+				if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (Diff < 0)
+			{
+				// The consumer hasn't freed this cell yet: the queue is full
+				return false;
+			}
+			else
+			{
+				// Another producer claimed the cell, reload the position
+				Pos = EnqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+
+		Cell->Value = MoveTemp(InElement);
+
+		// Publish the cell to the consumer
+		Cell->Sequence.store(Pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Removes the oldest element from the queue.
+	// Must only be called from the consumer thread. Returns false if the queue is empty.
+	bool TryDequeue(ElementType& OutElement)
+	{
+		const uint32 Pos = DequeuePos.load(std::memory_order_relaxed);
+		FCell& Cell = Cells[Pos & Mask];
+		const uint32 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+		if (static_cast<int32>(Sequence - (Pos + 1)) < 0)
+			return false;
+
+		OutElement = MoveTemp(Cell.Value);
+
+		// Free the cell for the producers' next lap
+		Cell.Sequence.store(Pos + Capacity, std::memory_order_release);
+		DequeuePos.store(Pos + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	// Approximate check, the result can be outdated as soon as it is returned.
+	bool IsEmpty() const
+	{
+		return EnqueuePos.load(std::memory_order_relaxed) == DequeuePos.load(std::memory_order_relaxed);
+	}
+
+	uint32 GetCapacity() const { return Capacity; }
+
+private:
+
+	struct FCell
+	{
+		std::atomic<uint32> Sequence;
+		ElementType Value;
+	};
+
+	FCell* Cells = nullptr;
+	uint32 Capacity = 0;
+	uint32 Mask = 0;
+
+	// Producers and consumer positions live on separate cache lines to avoid false sharing
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> EnqueuePos;
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> DequeuePos;
+};
@@ -264,9 +264,9 @@ FHoudiniEngineUtils::GetErrorDescription(HAPI_Result Result)
 }
 
 const FString
-FHoudiniEngineUtils::GetStatusString(HAPI_StatusType status_type, HAPI_StatusVerbosity verbosity)
+FHoudiniEngineUtils::GetStatusString(HAPI_StatusType status_type, HAPI_StatusVerbosity verbosity, const HAPI_Session* InSession)
 {
-	const HAPI_Session* SessionPtr = FHoudiniEngine::Get().GetSession();
+	const HAPI_Session* SessionPtr = InSession ? InSession : FHoudiniEngine::Get().GetSession();
 	if (!SessionPtr)
 	{
 		// No valid session
@@ -323,15 +323,15 @@ FHoudiniEngineUtils::HapiGetString(int32 StringHandle)
 
 
 const FString
-FHoudiniEngineUtils::GetCookResult()
+FHoudiniEngineUtils::GetCookResult(const HAPI_Session* InSession)
 {
-	return FHoudiniEngineUtils::GetStatusString(HAPI_STATUS_COOK_RESULT, HAPI_STATUSVERBOSITY_MESSAGES);
+	return FHoudiniEngineUtils::GetStatusString(HAPI_STATUS_COOK_RESULT, HAPI_STATUSVERBOSITY_MESSAGES, InSession);
 }
 
 const FString
-FHoudiniEngineUtils::GetCookState()
+FHoudiniEngineUtils::GetCookState(const HAPI_Session* InSession)
 {
-	return FHoudiniEngineUtils::GetStatusString(HAPI_STATUS_COOK_STATE, HAPI_STATUSVERBOSITY_ERRORS);
+	return FHoudiniEngineUtils::GetStatusString(HAPI_STATUS_COOK_STATE, HAPI_STATUSVERBOSITY_ERRORS, InSession);
 }
 
 const FString
@@ -7804,14 +7804,12 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 	{
 		// Use the default cook options
 		HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookNode(
-			FHoudiniEngine::Get().GetSession(), InNodeId, &CookOptions), false);
+		HOUDINI_CHECK_ERROR_RETURN(HapiStartCookNode(InNodeId, &CookOptions), false);
 	}
 	else
 	{
 		// Use the provided CookOptions
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookNode(
-			FHoudiniEngine::Get().GetSession(), InNodeId, InCookOptions), false);
+		HOUDINI_CHECK_ERROR_RETURN(HapiStartCookNode(InNodeId, InCookOptions), false);
 	}
 
 	// If we don't need to wait for completion, return now
@@ -7830,10 +7828,14 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 		if (Status == HAPI_STATE_READY)
 		{
 			// The cook has been successful.
+			// Strings resolved during the cook can use stale handles.
+			FHoudiniEngineString::InvalidateStringCache();
 			return true;
 		}
 		else if (Status == HAPI_STATE_READY_WITH_FATAL_ERRORS || Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
 		{
+			FHoudiniEngineString::InvalidateStringCache();
+
 			// There was an error while cooking the node.
 			//FString CookResultString = FHoudiniEngineUtils::GetCookResult();
 			//HOUDINI_LOG_ERROR();
@@ -7845,6 +7847,24 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 	}
 }
 
+HAPI_Result
+FHoudiniEngineUtils::HapiStartCookNode(const HAPI_NodeId& InNodeId, const HAPI_CookOptions* InCookOptions, const HAPI_Session* InSession)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineUtils::HapiStartCookNode);
+
+	const HAPI_Session* Session = InSession ? InSession : FHoudiniEngine::Get().GetSession();
+
+	// The cook can reuse the string handles we've already resolved, on any session
+	FHoudiniEngineString::InvalidateStringCache();
+	const HAPI_Result Result = FHoudiniApi::CookNode(Session, InNodeId, InCookOptions);
+
+	// Without a cooking thread, the cook is already done: drop what was resolved meanwhile.
+	// Threaded cooks are invalidated again when their completion is polled.
+	FHoudiniEngineString::InvalidateStringCache();
+
+	return Result;
+}
+
 
 HAPI_Result
 FHoudiniEngineUtils::CreateInputNode(const FString& InNodeLabel, HAPI_NodeId& OutNodeId, const int32 InParentNodeId)
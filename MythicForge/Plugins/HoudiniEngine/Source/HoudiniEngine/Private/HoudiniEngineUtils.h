@@ -98,20 +98,27 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		// if bWaitForCompletion is true, this call will be blocking until the cook is finished
 		static bool HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions* InCookOptions = nullptr, const bool& bWaitForCompletion = false);
 
+		// Starts cooking the specified node on the given session (the main session if null), without waiting for it.
+		// All cooks must go through this function (or HapiCookNode): it invalidates the cached strings,
+		// as the cook can reuse the string handles that were already resolved.
+		static HAPI_Result HapiStartCookNode(const HAPI_NodeId& InNodeId, const HAPI_CookOptions* InCookOptions, const HAPI_Session* InSession = nullptr);
+
 		// Wrapper for CommitGeo - adds a profiler scope wrapper
 		static HAPI_Result HapiCommitGeo(const HAPI_NodeId& InNodeId);
 
 		// Return a specified HAPI status string.
-		static const FString GetStatusString(HAPI_StatusType status_type, HAPI_StatusVerbosity verbosity);
+		static const FString GetStatusString(HAPI_StatusType status_type, HAPI_StatusVerbosity verbosity, const HAPI_Session* InSession = nullptr);
 
 		// HAPI : Return the string that corresponds to the given string handle.
 		static FString HapiGetString(int32 StringHandle);
 
 		// Return a string representing cooking result.
-		static const FString GetCookResult();
+		// Uses the main session if InSession is null.
+		static const FString GetCookResult(const HAPI_Session* InSession = nullptr);
 
 		// Return a string indicating cook state.
-		static const FString GetCookState();
+		// Uses the main session if InSession is null.
+		static const FString GetCookState(const HAPI_Session* InSession = nullptr);
 
 		// Return a string error description.
 		static const FString GetErrorDescription();
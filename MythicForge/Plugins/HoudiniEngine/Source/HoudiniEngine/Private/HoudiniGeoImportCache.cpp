@@ -0,0 +1,330 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniGeoImportCache.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniPackageParams.h"
+#include "HoudiniRuntimeSettings.h"
+
+#include "Engine/EngineTypes.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/SoftObjectPath.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineGeoImportCache(
+	TEXT("HoudiniEngine.GeoImportCache"),
+	1,
+	TEXT("Reuse the objects of previous bgeo imports when the file and the import settings haven't changed.\n")
+	TEXT("0: Disabled\n")
+	TEXT("1: Enabled: Default\n")
+);
+
+// Increment when changes to the importer invalidate the previously created objects
+static const int32 GeoImportCacheVersion = 1;
+
+// Minimum time between two non-forced writes of the cache file
+static const double GeoImportCacheSaveInterval = 10.0;
+
+FHoudiniGeoImportCache&
+FHoudiniGeoImportCache::Get()
+{
+	static FHoudiniGeoImportCache Instance;
+	return Instance;
+}
+
+bool
+FHoudiniGeoImportCache::IsEnabled()
+{
+	return CVarHoudiniEngineGeoImportCache.GetValueOnAnyThread() != 0;
+}
+
+FString
+FHoudiniGeoImportCache::GetCacheFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("HoudiniEngine") / TEXT("GeoImportCache.json");
+}
+
+bool
+FHoudiniGeoImportCache::ComputeKey(
+	const FString& InFilePath,
+	const FHoudiniPackageParams& InPackageParams,
+	const FHoudiniStaticMeshGenerationProperties& InStaticMeshGenerationProperties,
+	const FMeshBuildSettings& InMeshBuildSettings,
+	FString& OutKey)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniGeoImportCache::ComputeKey);
+
+	const FMD5Hash ContentHash = FMD5Hash::HashFile(*InFilePath);
+	if (!ContentHash.IsValid())
+		return false;
+
+	// Hash the settings that affect the created objects and their names.
+	// The component GUID is regenerated for every import and is left out.
+	FString Settings = FString::Printf(TEXT("%d|%d|%d|%s|%s|%s|%s|"),
+		GeoImportCacheVersion,
+		(int32)InPackageParams.PackageMode,
+		(int32)InPackageParams.ReplaceMode,
+		*InPackageParams.BakeFolder,
+		*InPackageParams.TempCookFolder,
+		*InPackageParams.HoudiniAssetName,
+		*InPackageParams.ObjectName);
+
+	FHoudiniStaticMeshGenerationProperties::StaticStruct()->ExportText(
+		Settings, &InStaticMeshGenerationProperties, nullptr, nullptr, PPF_None, nullptr);
+	Settings += TEXT("|");
+	FMeshBuildSettings::StaticStruct()->ExportText(
+		Settings, &InMeshBuildSettings, nullptr, nullptr, PPF_None, nullptr);
+
+	OutKey = LexToString(ContentHash) + TEXT("_") + FMD5::HashAnsiString(*Settings);
+	return true;
+}
+
+FString
+FHoudiniGeoImportCache::GetSettingsHash(const FString& InKey)
+{
+	FString ContentHash;
+	FString SettingsHash;
+	InKey.Split(TEXT("_"), &ContentHash, &SettingsHash);
+	return SettingsHash;
+}
+
+bool
+FHoudiniGeoImportCache::FindObjects(const FString& InKey, TArray<UObject*>& OutObjects)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniGeoImportCache::FindObjects);
+
+	OutObjects.Empty();
+	LoadIfNeeded();
+
+	const FEntry* Entry = Entries.Find(InKey);
+	if (!Entry)
+		return false;
+
+	for (const FString& ObjectPath : Entry->ObjectPaths)
+	{
+		UObject* Object = FSoftObjectPath(ObjectPath).TryLoad();
+		if (!IsValid(Object))
+		{
+			// The object has been deleted or renamed since the import, the file needs to be imported again
+			HOUDINI_LOG_MESSAGE(TEXT("Houdini GEO Import Cache: %s could not be loaded, discarding the entry for %s."),
+				*ObjectPath, *Entry->SourceFile);
+			OutObjects.Empty();
+			Entries.Remove(InKey);
+			RemovedKeys.Add(InKey);
+			bDirty = true;
+			return false;
+		}
+
+		OutObjects.Add(Object);
+	}
+
+	return OutObjects.Num() > 0;
+}
+
+bool
+FHoudiniGeoImportCache::ContainsValidEntry(const FString& InKey)
+{
+	LoadIfNeeded();
+
+	const FEntry* Entry = Entries.Find(InKey);
+	if (!Entry || Entry->ObjectPaths.Num() <= 0)
+		return false;
+
+	for (const FString& ObjectPath : Entry->ObjectPaths)
+	{
+		const FString PackageName = FPackageName::ObjectPathToPackageName(ObjectPath);
+		if (!FindPackage(nullptr, *PackageName) && !FPackageName::DoesPackageExist(PackageName))
+		{
+			Entries.Remove(InKey);
+			RemovedKeys.Add(InKey);
+			bDirty = true;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void
+FHoudiniGeoImportCache::AddObjects(const FString& InKey, const FString& InSourceFile, const TArray<UObject*>& InObjects)
+{
+	TArray<FString> ObjectPaths;
+	for (const UObject* Object : InObjects)
+	{
+		if (IsValid(Object))
+			ObjectPaths.Add(Object->GetPathName());
+	}
+
+	AddObjectPaths(InKey, InSourceFile, ObjectPaths);
+}
+
+void
+FHoudiniGeoImportCache::AddObjectPaths(const FString& InKey, const FString& InSourceFile, const TArray<FString>& InObjectPaths)
+{
+	if (InKey.IsEmpty() || InObjectPaths.Num() <= 0)
+		return;
+
+	LoadIfNeeded();
+
+	// Remove the entries of the previous versions of the file imported with the same settings,
+	// their objects have been replaced or are superseded by this import
+	const FString SettingsHash = GetSettingsHash(InKey);
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (It.Key() != InKey && It.Value().SourceFile == InSourceFile && GetSettingsHash(It.Key()) == SettingsHash)
+		{
+			RemovedKeys.Add(It.Key());
+			It.RemoveCurrent();
+		}
+	}
+
+	FEntry& Entry = Entries.FindOrAdd(InKey);
+	Entry.SourceFile = InSourceFile;
+	Entry.ObjectPaths = InObjectPaths;
+	RemovedKeys.Remove(InKey);
+	bDirty = true;
+}
+
+void
+FHoudiniGeoImportCache::Save(const bool bInForce)
+{
+	if (!bDirty)
+		return;
+
+	const double Now = FPlatformTime::Seconds();
+	if (!bInForce && Now - LastSaveTime < GeoImportCacheSaveInterval)
+		return;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniGeoImportCache::Save);
+
+	// Other processes (editor, import commandlets) may have added entries since we read the file, keep them
+	TMap<FString, FEntry> FileEntries;
+	ReadCacheFile(FileEntries);
+	for (auto& FileEntry : FileEntries)
+	{
+		if (!Entries.Contains(FileEntry.Key) && !RemovedKeys.Contains(FileEntry.Key))
+			Entries.Add(FileEntry.Key, MoveTemp(FileEntry.Value));
+	}
+
+	TArray<TSharedPtr<FJsonValue>> EntryValues;
+	for (const auto& Entry : Entries)
+	{
+		TSharedPtr<FJsonObject> EntryObject = MakeShared<FJsonObject>();
+		EntryObject->SetStringField(TEXT("key"), Entry.Key);
+		EntryObject->SetStringField(TEXT("source_file"), Entry.Value.SourceFile);
+
+		TArray<TSharedPtr<FJsonValue>> ObjectValues;
+		for (const FString& ObjectPath : Entry.Value.ObjectPaths)
+			ObjectValues.Add(MakeShared<FJsonValueString>(ObjectPath));
+		EntryObject->SetArrayField(TEXT("objects"), ObjectValues);
+
+		EntryValues.Add(MakeShared<FJsonValueObject>(EntryObject));
+	}
+
+	TSharedPtr<FJsonObject> JSONObject = MakeShared<FJsonObject>();
+	JSONObject->SetNumberField(TEXT("version"), GeoImportCacheVersion);
+	JSONObject->SetArrayField(TEXT("entries"), EntryValues);
+
+	const FString CacheFilePath = GetCacheFilePath();
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.CreateDirectoryTree(*FPaths::GetPath(CacheFilePath))
+		|| !FFileHelper::SaveStringToFile(FHoudiniEngineUtils::JSONToString(JSONObject), *CacheFilePath))
+	{
+		HOUDINI_LOG_WARNING(TEXT("Houdini GEO Import Cache: could not write %s."), *CacheFilePath);
+	}
+
+	RemovedKeys.Empty();
+	bDirty = false;
+	LastSaveTime = Now;
+}
+
+void
+FHoudiniGeoImportCache::LoadIfNeeded()
+{
+	if (bLoaded)
+		return;
+
+	bLoaded = true;
+	ReadCacheFile(Entries);
+}
+
+bool
+FHoudiniGeoImportCache::ReadCacheFile(TMap<FString, FEntry>& OutEntries)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniGeoImportCache::ReadCacheFile);
+
+	FString JSONString;
+	if (!FFileHelper::LoadFileToString(JSONString, *GetCacheFilePath()))
+		return false;
+
+	TSharedPtr<FJsonObject> JSONObject;
+	if (!FHoudiniEngineUtils::JSONFromString(JSONString, JSONObject))
+		return false;
+
+	// Entries written by another version of the importer can't be reused
+	int32 Version = 0;
+	if (!JSONObject->TryGetNumberField(TEXT("version"), Version) || Version != GeoImportCacheVersion)
+		return false;
+
+	const TArray<TSharedPtr<FJsonValue>>* EntryValues = nullptr;
+	if (!JSONObject->TryGetArrayField(TEXT("entries"), EntryValues))
+		return false;
+
+	for (const TSharedPtr<FJsonValue>& EntryValue : *EntryValues)
+	{
+		const TSharedPtr<FJsonObject>* EntryObject = nullptr;
+		if (!EntryValue.IsValid() || !EntryValue->TryGetObject(EntryObject))
+			continue;
+
+		FString Key;
+		FEntry Entry;
+		const TArray<TSharedPtr<FJsonValue>>* ObjectValues = nullptr;
+		if (!(*EntryObject)->TryGetStringField(TEXT("key"), Key)
+			|| !(*EntryObject)->TryGetStringField(TEXT("source_file"), Entry.SourceFile)
+			|| !(*EntryObject)->TryGetArrayField(TEXT("objects"), ObjectValues))
+		{
+			continue;
+		}
+
+		for (const TSharedPtr<FJsonValue>& ObjectValue : *ObjectValues)
+		{
+			FString ObjectPath;
+			if (ObjectValue.IsValid() && ObjectValue->TryGetString(ObjectPath))
+				Entry.ObjectPaths.Add(ObjectPath);
+		}
+
+		OutEntries.Add(Key, MoveTemp(Entry));
+	}
+
+	return true;
+}
@@ -0,0 +1,102 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FHoudiniPackageParams;
+struct FHoudiniStaticMeshGenerationProperties;
+struct FMeshBuildSettings;
+
+// Persistent cache of the objects created by bgeo imports.
+// Entries are keyed on the content hash of the bgeo file and a hash of the import settings,
+// so importing an unchanged file with the same settings can reuse the previously saved objects.
+// The cache is stored in Saved/HoudiniEngine/GeoImportCache.json.
+class HOUDINIENGINE_API FHoudiniGeoImportCache
+{
+public:
+
+	static FHoudiniGeoImportCache& Get();
+
+	// Returns true if the cache is enabled (HoudiniEngine.GeoImportCache)
+	static bool IsEnabled();
+
+	// Builds the cache key of a bgeo file import.
+	// Returns false if the file could not be hashed.
+	static bool ComputeKey(
+		const FString& InFilePath,
+		const FHoudiniPackageParams& InPackageParams,
+		const FHoudiniStaticMeshGenerationProperties& InStaticMeshGenerationProperties,
+		const FMeshBuildSettings& InMeshBuildSettings,
+		FString& OutKey);
+
+	// Loads the objects cached for the key.
+	// Returns false if there is no entry or if any of its objects could not be loaded, in which case the entry is removed.
+	bool FindObjects(const FString& InKey, TArray<UObject*>& OutObjects);
+
+	// Returns true if there is an entry for the key and all its packages still exist, without loading them
+	bool ContainsValidEntry(const FString& InKey);
+
+	// Adds the objects created by the import of InSourceFile.
+	// Entries previously added for the same file and settings are replaced.
+	void AddObjects(const FString& InKey, const FString& InSourceFile, const TArray<UObject*>& InObjects);
+
+	// Same as above, using the object paths directly
+	void AddObjectPaths(const FString& InKey, const FString& InSourceFile, const TArray<FString>& InObjectPaths);
+
+	// Writes the cache file if it has been modified.
+	// Unless bInForce is true, writes are throttled to avoid rewriting the file after every import.
+	void Save(const bool bInForce = false);
+
+	// Returns the path to the cache file
+	static FString GetCacheFilePath();
+
+private:
+
+	struct FEntry
+	{
+		FString SourceFile;
+		TArray<FString> ObjectPaths;
+	};
+
+	// Reads the cache file the first time the cache is accessed
+	void LoadIfNeeded();
+
+	// Reads the entries of the cache file into OutEntries
+	static bool ReadCacheFile(TMap<FString, FEntry>& OutEntries);
+
+	static FString GetSettingsHash(const FString& InKey);
+
+	TMap<FString, FEntry> Entries;
+
+	// Keys removed since the last save, so they are not merged back from the file
+	TSet<FString> RemovedKeys;
+
+	bool bLoaded = false;
+	bool bDirty = false;
+	double LastSaveTime = 0.0;
+};
@@ -46,9 +46,11 @@
 #include "Rendering/SlateRenderer.h"
 #include "Framework/Application/SlateApplication.h"
 #include "HAL/ThreadManager.h"
+#include "HAL/FileManager.h"
 
 #include "HoudiniPackageParams.h"
 #include "HoudiniGeoImporter.h"
+#include "HoudiniGeoImportCache.h"
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniOutput.h"
@@ -70,6 +72,12 @@ UHoudiniGeoImportCommandlet::UHoudiniGeoImportCommandlet()
 	//	"\t\tA directory to watch for new .bgeo files to import.\n\n"
 	//	"\t-managerpid=owner_pid\n\n"
 	//	"\t\tThe PID of the owner/manager process. If the manager process dies the commandlet also quits.\n\n"
+	//	"\t-pipename=name\n\n"
+	//	"\t\tThe named pipe used for the Houdini Engine session. Must be unique when running multiple commandlets.\n\n"
+	//	"\t-workers=count\n\n"
+	//	"\t\tWith -watch: import the discovered files in parallel with this number of worker commandlets.\n\n"
+	//	"\t-maxattempts=count\n\n"
+	//	"\t\tMaximum number of attempts at importing a discovered file (default 3).\n\n"
 	//	"\t-bake\n\n"
 	//	"\t\tBake generated assets. Instancers are baked to blueprints. Not supported in -listen mode.\n\n"
 	//	"\t[filename.bgeo]\n"
@@ -82,6 +90,9 @@ UHoudiniGeoImportCommandlet::UHoudiniGeoImportCommandlet()
 		"guid",
 		"watch",
 		"managerpid",
+		"pipename",
+		"workers",
+		"maxattempts",
 		"bake"
 	};
 
@@ -91,6 +102,9 @@ UHoudiniGeoImportCommandlet::UHoudiniGeoImportCommandlet()
 		"Specify a GUID for the commandlet. Useful to identify the commandlet when the messaging system is used.",
 		"A directory to watch for new .bgeo files to import.",
 		"The PID of the owner/manager process. If the manager process dies the commandlet also quits.",
+		"The named pipe used for the Houdini Engine session. Must be unique when running multiple commandlets.",
+		"With -watch: import the discovered files in parallel with this number of worker commandlets.",
+		"Maximum number of attempts at importing a discovered file (default 3).",
 		"Bake generated assets. Instancers are baked to blueprints. Not supported in -listen mode."
 	};
 
@@ -105,6 +119,13 @@ UHoudiniGeoImportCommandlet::UHoudiniGeoImportCommandlet()
 
 	Mode = EHoudiniGeoImportCommandletMode::None;
 	bBakeOutputs = false;
+	SessionPipeName = TEXT("hapi_bgeo_cmdlet");
+	MaxImportAttempts = 3;
+
+	NumFilesImported = 0;
+	NumFilesFailed = 0;
+	TotalImportTime = 0.0;
+	FirstImportStartTime = 0.0;
 }
 
 void UHoudiniGeoImportCommandlet::PrintUsage() const
@@ -153,6 +174,12 @@ void UHoudiniGeoImportCommandlet::PopulatePackageParams(const FString &InBGEOFil
 
 void UHoudiniGeoImportCommandlet::TickDiscoveredFiles()
 {
+	if (Mode == EHoudiniGeoImportCommandletMode::Coordinator)
+	{
+		TickWorkers();
+		return;
+	}
+
 	for (auto &FileDataEntry : DiscoveredFiles)
 	{
 		FDiscoveredFileData &FileData = FileDataEntry.Value;
@@ -160,23 +187,301 @@ void UHoudiniGeoImportCommandlet::TickDiscoveredFiles()
 		{
 			FileData.bImportNextTick = false;
 			FileData.ImportAttempts++;
+			FileData.ImportStartTime = FPlatformTime::Seconds();
 			
 			FHoudiniPackageParams PackageParams;
 			PopulatePackageParams(FileData.FileName, PackageParams);
 			TArray<TObjectPtr<UHoudiniOutput>> Outputs;
 			int32 Error = ImportBGEO(FileData.FileName, PackageParams, Outputs);
-			if (Error == 0)
-			{
-				FileData.bImported = true;
-				HOUDINI_LOG_DISPLAY(TEXT("Importing %s... Done"), *FileData.FileName);
-			}
-			else
+			if (Error != 0)
+				HOUDINI_LOG_DISPLAY(TEXT("Import error %d for %s"), Error, *FileData.FileName);
+
+			OnFileImportFinished(FileData, Error == 0, INDEX_NONE);
+		}
+	}
+}
+
+void UHoudiniGeoImportCommandlet::OnFileImportFinished(FDiscoveredFileData& InFileData, const bool bInSuccess, const int32 InWorkerIndex)
+{
+	const double ImportTime = FPlatformTime::Seconds() - InFileData.ImportStartTime;
+	TotalImportTime += ImportTime;
+	InFileData.WorkerIndex = INDEX_NONE;
+	InFileData.bImported = bInSuccess;
+
+	const FString WorkerStr = InWorkerIndex != INDEX_NONE ? FString::Printf(TEXT(", worker %d"), InWorkerIndex) : FString();
+	if (bInSuccess)
+	{
+		NumFilesImported++;
+		HOUDINI_LOG_DISPLAY(TEXT("Importing %s... Done (%.3fs%s, attempt %d)"),
+			*InFileData.FileName, ImportTime, *WorkerStr, InFileData.ImportAttempts);
+	}
+	else if (InFileData.ImportAttempts < MaxImportAttempts)
+	{
+		// Try again on the next tick
+		InFileData.bImportNextTick = true;
+		HOUDINI_LOG_DISPLAY(TEXT("Importing %s... Failed (%.3fs%s, attempt %d/%d), retrying"),
+			*InFileData.FileName, ImportTime, *WorkerStr, InFileData.ImportAttempts, MaxImportAttempts);
+	}
+	else
+	{
+		NumFilesFailed++;
+		HOUDINI_LOG_WARNING(TEXT("Importing %s... Failed (%.3fs%s, attempt %d/%d), max attempts exceeded"),
+			*InFileData.FileName, ImportTime, *WorkerStr, InFileData.ImportAttempts, MaxImportAttempts);
+	}
+}
+
+void UHoudiniGeoImportCommandlet::TickWorkers()
+{
+	// Restart the workers that stopped running, the file they were importing counts as a failed attempt
+	static const int32 MaxWorkerStarts = 5;
+	int32 NumWorkersAvailable = 0;
+	for (int32 WorkerIndex = 0; WorkerIndex < Workers.Num(); ++WorkerIndex)
+	{
+		FHoudiniGeoImportWorker& Worker = Workers[WorkerIndex];
+		if (Worker.ProcHandle.IsValid() && FPlatformProcess::IsProcRunning(Worker.ProcHandle))
+		{
+			NumWorkersAvailable++;
+			continue;
+		}
+
+		if (!Worker.ImportingFile.IsEmpty())
+		{
+			HOUDINI_LOG_WARNING(TEXT("Worker %d stopped while importing %s"), WorkerIndex, *Worker.ImportingFile);
+			if (FDiscoveredFileData* FileData = DiscoveredFiles.Find(Worker.ImportingFile))
+				OnFileImportFinished(*FileData, false, WorkerIndex);
+			Worker.ImportingFile.Empty();
+		}
+
+		if (Worker.NumStarts < MaxWorkerStarts && StartWorker(Worker))
+			NumWorkersAvailable++;
+	}
+
+	if (NumWorkersAvailable <= 0)
+	{
+		HOUDINI_LOG_ERROR(TEXT("All the import workers failed to start, quitting."));
+		RequestEngineExit(TEXT("WorkersFailed"));
+		return;
+	}
+
+	// Send the files waiting to be imported to the idle workers
+	bool bFilesWaiting = false;
+	int32 NextWorkerIndex = 0;
+	for (auto& FileDataEntry : DiscoveredFiles)
+	{
+		FDiscoveredFileData& FileData = FileDataEntry.Value;
+		if (!FileData.bImportNextTick || FileData.bImported || FileData.WorkerIndex != INDEX_NONE)
+			continue;
+
+		while (NextWorkerIndex < Workers.Num()
+			&& (!Workers[NextWorkerIndex].Address.IsValid() || !Workers[NextWorkerIndex].ImportingFile.IsEmpty()))
+		{
+			NextWorkerIndex++;
+		}
+
+		if (NextWorkerIndex >= Workers.Num())
+		{
+			bFilesWaiting = true;
+			break;
+		}
+
+		FHoudiniPackageParams PackageParams;
+		PopulatePackageParams(FileData.FileName, PackageParams);
+
+		// Don't send the files that were already imported with the same settings
+		FileData.CacheKey.Empty();
+		if (FHoudiniGeoImportCache::IsEnabled()
+			&& FHoudiniGeoImportCache::ComputeKey(
+				FileData.FileName, PackageParams,
+				FHoudiniEngineRuntimeUtils::GetDefaultStaticMeshGenerationProperties(),
+				FHoudiniEngineRuntimeUtils::GetDefaultMeshBuildSettings(),
+				FileData.CacheKey)
+			&& FHoudiniGeoImportCache::Get().ContainsValidEntry(FileData.CacheKey))
+		{
+			HOUDINI_LOG_DISPLAY(TEXT("%s is unchanged since its last import, skipping."), *FileData.FileName);
+			FileData.bImportNextTick = false;
+			FileData.bImported = true;
+			continue;
+		}
+
+		FHoudiniGeoImportWorker& Worker = Workers[NextWorkerIndex];
+		FileData.bImportNextTick = false;
+		FileData.ImportAttempts++;
+		FileData.WorkerIndex = NextWorkerIndex;
+		FileData.ImportStartTime = FPlatformTime::Seconds();
+		if (NumFilesImported + NumFilesFailed == 0 && FirstImportStartTime <= 0.0)
+			FirstImportStartTime = FileData.ImportStartTime;
+
+		PDGEndpoint->Send(
+			new FHoudiniPDGImportBGEOMessage(FileData.FileName, FPaths::GetBaseFilename(FileData.FileName), PackageParams),
+			Worker.Address);
+
+		Worker.ImportingFile = FileData.FileName;
+	}
+
+	if (bFilesWaiting || NumFilesImported + NumFilesFailed == 0)
+		return;
+
+	for (const FHoudiniGeoImportWorker& Worker : Workers)
+	{
+		if (!Worker.ImportingFile.IsEmpty())
+			return;
+	}
+
+	// All the discovered files have been processed
+	HOUDINI_LOG_DISPLAY(TEXT("Imported %d files (%d failed) in %.3fs, %.3fs of import time across %d workers."),
+		NumFilesImported, NumFilesFailed, FPlatformTime::Seconds() - FirstImportStartTime, TotalImportTime, Workers.Num());
+
+	NumFilesImported = 0;
+	NumFilesFailed = 0;
+	TotalImportTime = 0.0;
+	FirstImportStartTime = 0.0;
+}
+
+bool UHoudiniGeoImportCommandlet::StartWorker(FHoudiniGeoImportWorker& InWorker)
+{
+	if (!PDGEndpoint.IsValid())
+		return false;
+
+	if (InWorker.ProcHandle.IsValid())
+		FPlatformProcess::CloseProc(InWorker.ProcHandle);
+
+	InWorker.NumStarts++;
+	InWorker.Guid = FGuid::NewGuid();
+	InWorker.Address.Invalidate();
+	InWorker.ImportingFile.Empty();
+
+	// Get the absolute path to the project file, if known, otherwise get
+	// the project name. For the path: quote it for the command line.
+	IFileManager& FileManager = IFileManager::Get();
+	FString ProjectPathOrName = FApp::GetProjectName();
+	if (FPaths::IsProjectFilePathSet())
+	{
+		const FString ProjectPath = FPaths::GetProjectFilePath();
+		if (!ProjectPath.IsEmpty())
+		{
+			ProjectPathOrName = FString::Printf(
+				TEXT("\"%s\""),
+				*FileManager.ConvertToAbsolutePathForExternalAppForRead(*ProjectPath));
+		}
+	}
+
+	if (ProjectPathOrName.IsEmpty())
+		return false;
+
+	// Get the executable path for the app/editor
+	FString ExePath = FPlatformProcess::GenerateApplicationPath(FApp::GetName(), FApp::GetBuildConfiguration());
+	if (!ExePath.IsEmpty())
+		ExePath = FileManager.ConvertToAbsolutePathForExternalAppForRead(*ExePath);
+
+	if (ExePath.IsEmpty())
+		return false;
+
+	// Each worker needs its own named pipe, otherwise they would share a single Houdini Engine session
+	const FString CommandLineParameters = FString::Printf(
+		TEXT("%s -messaging -unattended -run=HoudiniGeoImport -guid=%s -listen=%s -managerpid=%d -pipename=hapi_bgeo_worker_%s"),
+		*ProjectPathOrName,
+		*InWorker.Guid.ToString(),
+		*PDGEndpoint->GetAddress().ToString(),
+		FPlatformProcess::GetCurrentProcessId(),
+		*InWorker.Guid.ToString());
+
+	InWorker.ProcHandle = FPlatformProcess::CreateProc(
+		*ExePath,
+		*CommandLineParameters,
+		false,
+		true,
+		false,
+		&InWorker.ProcessId,
+		0,
+		nullptr,
+		nullptr);
+
+	if (!InWorker.ProcHandle.IsValid())
+	{
+		HOUDINI_LOG_WARNING(TEXT("Failed to start import worker (attempt %d)"), InWorker.NumStarts);
+		return false;
+	}
+
+	HOUDINI_LOG_DISPLAY(TEXT("Started import worker %s (pid %d)"), *InWorker.Guid.ToString(), InWorker.ProcessId);
+	return true;
+}
+
+void UHoudiniGeoImportCommandlet::StopWorkers()
+{
+	for (FHoudiniGeoImportWorker& Worker : Workers)
+	{
+		if (!Worker.ProcHandle.IsValid())
+			continue;
+
+		if (FPlatformProcess::IsProcRunning(Worker.ProcHandle))
+		{
+			FPlatformProcess::TerminateProc(Worker.ProcHandle, true);
+			FPlatformProcess::WaitForProc(Worker.ProcHandle);
+		}
+		FPlatformProcess::CloseProc(Worker.ProcHandle);
+	}
+	Workers.Empty();
+}
+
+void UHoudiniGeoImportCommandlet::HandleImportBGEODiscoverMessage(
+	const FHoudiniPDGImportBGEODiscoverMessage& InMessage,
+	const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext)
+{
+	for (int32 WorkerIndex = 0; WorkerIndex < Workers.Num(); ++WorkerIndex)
+	{
+		FHoudiniGeoImportWorker& Worker = Workers[WorkerIndex];
+		if (!InMessage.CommandletGuid.IsValid() || Worker.Guid != InMessage.CommandletGuid)
+			continue;
+
+		if (!Worker.Address.IsValid())
+		{
+			Worker.Address = InContext->GetSender();
+			HOUDINI_LOG_DISPLAY(TEXT("Import worker %d connected"), WorkerIndex);
+		}
+		return;
+	}
+}
+
+void UHoudiniGeoImportCommandlet::HandleImportBGEOResultMessage(
+	const FHoudiniPDGImportBGEOResultMessage& InMessage,
+	const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext)
+{
+	const int32 WorkerIndex = Workers.IndexOfByPredicate([&InContext](const FHoudiniGeoImportWorker& Worker)
+	{
+		return Worker.Address == InContext->GetSender();
+	});
+	if (WorkerIndex == INDEX_NONE)
+		return;
+
+	// Workers import one file at a time, so the result is for the file they were sent last
+	FHoudiniGeoImportWorker& Worker = Workers[WorkerIndex];
+	const FString FileName = Worker.ImportingFile;
+	Worker.ImportingFile.Empty();
+
+	// The file could have been removed since it was sent
+	FDiscoveredFileData* FileData = DiscoveredFiles.Find(FileName);
+	if (!FileData)
+		return;
+
+	const bool bSuccess = InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_Success
+		|| InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_PartialSuccess;
+	if (InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_Success && !FileData->CacheKey.IsEmpty())
+	{
+		// Record the saved objects so the file is skipped until it changes
+		TArray<FString> ObjectPaths;
+		for (const FHoudiniPDGImportNodeOutput& Output : InMessage.Outputs)
+		{
+			for (const FHoudiniPDGImportNodeOutputObject& OutputObject : Output.OutputObjects)
 			{
-				FileData.bImported = false;
-				HOUDINI_LOG_DISPLAY(TEXT("Importing %s... Failed (%d)"), *FileData.FileName, Error);
+				if (!OutputObject.PackagePath.IsEmpty())
+					ObjectPaths.Add(OutputObject.PackagePath);
 			}
 		}
+		FHoudiniGeoImportCache::Get().AddObjectPaths(FileData->CacheKey, FileData->FileName, ObjectPaths);
+		FHoudiniGeoImportCache::Get().Save();
 	}
+
+	OnFileImportFinished(*FileData, bSuccess, WorkerIndex);
 }
 
 int32 UHoudiniGeoImportCommandlet::MainLoop()
@@ -202,12 +507,30 @@ int32 UHoudiniGeoImportCommandlet::MainLoop()
 		// additional set up needed to connect / discover the endpoints?
 		PDGEndpoint->Send(new FHoudiniPDGImportBGEODiscoverMessage(Guid), ManagerAddress);
 	}
-	else if (Mode == EHoudiniGeoImportCommandletMode::Watch)
+	else if (Mode == EHoudiniGeoImportCommandletMode::Watch || Mode == EHoudiniGeoImportCommandletMode::Coordinator)
 	{
 		FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::Get().LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
 		DirectoryWatcher = DirectoryWatcherModule.Get();
 	}
 
+	if (Mode == EHoudiniGeoImportCommandletMode::Coordinator)
+	{
+		PDGEndpoint = FMessageEndpoint::Builder("PDG/BGEO Import Coordinator")
+			.Handling<FHoudiniPDGImportBGEOResultMessage>(this, &UHoudiniGeoImportCommandlet::HandleImportBGEOResultMessage)
+			.Handling<FHoudiniPDGImportBGEODiscoverMessage>(this, &UHoudiniGeoImportCommandlet::HandleImportBGEODiscoverMessage)
+			.ReceivingOnThread(ENamedThreads::GameThread);
+		if (!PDGEndpoint.IsValid())
+		{
+			GIsRunning = false;
+			return 3;
+		}
+		// The workers publish a discover message once they are running
+		PDGEndpoint->Subscribe<FHoudiniPDGImportBGEODiscoverMessage>();
+
+		for (FHoudiniGeoImportWorker& Worker : Workers)
+			StartWorker(Worker);
+	}
+
 	// In UnrealEngine 4.25 and older we cannot tick the editor engine without slate being initialized.
 	if (!FSlateApplication::IsInitialized())
 	{
@@ -282,7 +605,9 @@ int32 UHoudiniGeoImportCommandlet::MainLoop()
 		FPlatformProcess::Sleep(0);
 	}
 
+	StopWorkers();
 	PDGEndpoint.Reset();
+	FHoudiniGeoImportCache::Get().Save(true);
 	if (DirectoryWatcherHandle.IsValid() && DirectoryWatcher)
 	{
 		DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(DirectoryToWatch, DirectoryWatcherHandle);
@@ -374,6 +699,7 @@ UHoudiniGeoImportCommandlet::HandleImportBGEOMessage(
 	{
 		HOUDINI_LOG_WARNING(TEXT("BGEO import failed."));
 		FHoudiniPDGImportBGEOResultMessage* Reply = new FHoudiniPDGImportBGEOResultMessage();
+		(*Reply) = InMessage;
 		Reply->ImportResult = EHoudiniPDGImportBGEOResult::HPIBR_Failed;
 		PDGEndpoint->Send(Reply, InContext->GetSender());
 	}
@@ -429,7 +755,7 @@ bool UHoudiniGeoImportCommandlet::StartHoudiniEngineSession()
 	FHoudiniEngine& HoudiniEngine = FHoudiniEngine::Get();
 	if (!HoudiniEngine.CreateSession(
 		EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe,
-		"hapi_bgeo_cmdlet"))
+		FName(*SessionPipeName)))
 	{
 		HOUDINI_LOG_ERROR(TEXT("Failed to start Houdini Engine session."));
 		return false;
@@ -447,6 +773,27 @@ int32 UHoudiniGeoImportCommandlet::ImportBGEO(
 	TMap<FHoudiniOutputObjectIdentifier, TArray<FHoudiniGenericAttribute>>* OutGenericAttributes,
 	TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutputPartData>* OutInstancedOutputPartData)
 {
+	const FHoudiniStaticMeshGenerationProperties& StaticMeshGenerationProperties =
+		InStaticMeshGenerationProperties?
+		*InStaticMeshGenerationProperties :
+		FHoudiniEngineRuntimeUtils::GetDefaultStaticMeshGenerationProperties();
+	
+	const FMeshBuildSettings& MeshBuildSettings =
+		InMeshBuildSettings ? *InMeshBuildSettings : FHoudiniEngineRuntimeUtils::GetDefaultMeshBuildSettings();
+
+	// Skip the files that were already imported with the same settings.
+	// Imports requesting attributes or instancer data need the file to be loaded in HAPI and are never cached.
+	FString CacheKey;
+	const FString AbsoluteFilename = FPaths::ConvertRelativePathToFull(InFilename);
+	if (!OutGenericAttributes && !OutInstancedOutputPartData && FHoudiniGeoImportCache::IsEnabled()
+		&& FHoudiniGeoImportCache::ComputeKey(AbsoluteFilename, InPackageParams, StaticMeshGenerationProperties, MeshBuildSettings, CacheKey)
+		&& FHoudiniGeoImportCache::Get().ContainsValidEntry(CacheKey))
+	{
+		HOUDINI_LOG_DISPLAY(TEXT("%s is unchanged since its last import, skipping."), *InFilename);
+		OutOutputs.Empty();
+		return 0;
+	}
+
 	if (!IsHoudiniEngineSessionRunning() && !StartHoudiniEngineSession())
 	{
 		return 2;
@@ -531,14 +878,6 @@ int32 UHoudiniGeoImportCommandlet::ImportBGEO(
 	UObject* Outer = this;
 	
 	// 5. Create the static meshes in the outputs
-	const FHoudiniStaticMeshGenerationProperties& StaticMeshGenerationProperties =
-		InStaticMeshGenerationProperties?
-		*InStaticMeshGenerationProperties :
-		FHoudiniEngineRuntimeUtils::GetDefaultStaticMeshGenerationProperties();
-	
-	const FMeshBuildSettings& MeshBuildSettings =
-		InMeshBuildSettings ? *InMeshBuildSettings : FHoudiniEngineRuntimeUtils::GetDefaultMeshBuildSettings();
-	
 	HOUDINI_LOG_DISPLAY(TEXT("Creating Objects from Outputs"));
 	if (!GeoImporter->CreateObjectsFromOutputs(OutOutputs, PackageParams, StaticMeshGenerationProperties, MeshBuildSettings, OutInstancedOutputPartData))
 		return CleanUpAndExit(1);
@@ -613,6 +952,12 @@ int32 UHoudiniGeoImportCommandlet::ImportBGEO(
 	{
 		UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, true);
 	}
+
+	if (!CacheKey.IsEmpty())
+	{
+		FHoudiniGeoImportCache::Get().AddObjects(CacheKey, AbsoluteFilename, OutputObjects);
+		FHoudiniGeoImportCache::Get().Save();
+	}
 	
 	PackagesToSave.Empty();
 	OutputObjects.Empty();
@@ -632,14 +977,17 @@ void UHoudiniGeoImportCommandlet::HandleDirectoryChanged(const TArray<FFileChang
 		if (BGEOMatcher.FindNext() && BGEOMatcher.GetCaptureGroup(2).StartsWith(TEXT("bgeo")))
 		{
 			HOUDINI_LOG_DISPLAY(TEXT("Updating entry for %s..."), *FileChangeData.Filename);
-			const uint32 MaxImportAttempts = 3;
+
+			// Use a single entry per file, whichever way the watcher reported its path
+			FString FileName = FPaths::ConvertRelativePathToFull(FileChangeData.Filename);
+			FPaths::NormalizeFilename(FileName);
 			switch(FileChangeData.Action)
 			{
 				case FFileChangeData::FCA_Added:
 				case FFileChangeData::FCA_Modified:
-					if (DiscoveredFiles.Contains(FileChangeData.Filename))
+					if (DiscoveredFiles.Contains(FileName))
 					{
-						FDiscoveredFileData &FileData = DiscoveredFiles[FileChangeData.Filename];
+						FDiscoveredFileData &FileData = DiscoveredFiles[FileName];
 						if (!FileData.bImported && FileData.ImportAttempts < MaxImportAttempts)
 							FileData.bImportNextTick = true;
 						else if (FileData.ImportAttempts >= MaxImportAttempts)
@@ -647,12 +995,12 @@ void UHoudiniGeoImportCommandlet::HandleDirectoryChanged(const TArray<FFileChang
 					}
 					else
 					{
-						DiscoveredFiles.Add(FileChangeData.Filename, FDiscoveredFileData(FileChangeData.Filename, true));
+						DiscoveredFiles.Add(FileName, FDiscoveredFileData(FileName, true));
 					}
 				break;
 
 				case FFileChangeData::FCA_Removed:
-					DiscoveredFiles.Remove(FileChangeData.Filename);
+					DiscoveredFiles.Remove(FileName);
 				break;
 
 				default:
@@ -687,6 +1035,12 @@ int32 UHoudiniGeoImportCommandlet::Main(const FString& InParams)
 		Guid = FGuid::NewGuid();
 	}
 
+	if (Params.Contains(TEXT("pipename")))
+		SessionPipeName = Params.FindChecked(TEXT("pipename"));
+
+	if (Params.Contains(TEXT("maxattempts")))
+		MaxImportAttempts = FMath::Max(FCString::Atoi(*Params.FindChecked(TEXT("maxattempts"))), 1);
+
 	// Set bake mode
 	if (Switches.Contains(TEXT("bake")))
 		bBakeOutputs = true;
@@ -726,9 +1080,18 @@ int32 UHoudiniGeoImportCommandlet::Main(const FString& InParams)
 	}
 	else if (Params.Contains(TEXT("watch")))
 	{
-		Mode = EHoudiniGeoImportCommandletMode::Watch;
-		
-		HOUDINI_LOG_DISPLAY(TEXT("directory watch mode"));
+		const int32 NumWorkers = Params.Contains(TEXT("workers")) ? FCString::Atoi(*Params.FindChecked(TEXT("workers"))) : 0;
+		if (NumWorkers > 0)
+		{
+			Mode = EHoudiniGeoImportCommandletMode::Coordinator;
+			Workers.SetNum(NumWorkers);
+			HOUDINI_LOG_DISPLAY(TEXT("directory watch mode, importing with %d workers"), NumWorkers);
+		}
+		else
+		{
+			Mode = EHoudiniGeoImportCommandletMode::Watch;
+			HOUDINI_LOG_DISPLAY(TEXT("directory watch mode"));
+		}
 		FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
 		IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule.Get();
 		if (DirectoryWatcher)
@@ -764,6 +1127,7 @@ int32 UHoudiniGeoImportCommandlet::Main(const FString& InParams)
 
 		TArray<TObjectPtr<UHoudiniOutput>> Outputs;
 		const int32 Result = ImportBGEO(Tokens[0], PackageParams, Outputs);
+		FHoudiniGeoImportCache::Get().Save(true);
 
 		for (UHoudiniOutput* Output : Outputs)
 		{
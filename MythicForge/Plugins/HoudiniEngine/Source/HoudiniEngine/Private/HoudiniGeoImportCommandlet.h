@@ -54,17 +54,19 @@ enum class EHoudiniGeoImportCommandletMode : uint8
 	// Directory watch mode
 	Watch,
 	// Listen mode (via PDGManager)
-	Listen
+	Listen,
+	// Directory watch mode, importing the files with worker commandlets in listen mode
+	Coordinator
 };
 
 struct FDiscoveredFileData
 {
 public:
-	FDiscoveredFileData() : FileName(), bImportNextTick(false), ImportAttempts(0), bImported(false) {}
+	FDiscoveredFileData() : FileName(), bImportNextTick(false), ImportAttempts(0), bImported(false), WorkerIndex(INDEX_NONE), ImportStartTime(0.0) {}
 
-	FDiscoveredFileData(const FString& InFileName, bool bInImportNextTick=false) : FileName(InFileName), bImportNextTick(bInImportNextTick), ImportAttempts(0), bImported(false) {}
+	FDiscoveredFileData(const FString& InFileName, bool bInImportNextTick=false) : FileName(InFileName), bImportNextTick(bInImportNextTick), ImportAttempts(0), bImported(false), WorkerIndex(INDEX_NONE), ImportStartTime(0.0) {}
 
-	FDiscoveredFileData(FString&& InFileName, bool bInImportNextTick=false) : FileName(InFileName), bImportNextTick(bInImportNextTick), ImportAttempts(0), bImported(false) {}
+	FDiscoveredFileData(FString&& InFileName, bool bInImportNextTick=false) : FileName(InFileName), bImportNextTick(bInImportNextTick), ImportAttempts(0), bImported(false), WorkerIndex(INDEX_NONE), ImportStartTime(0.0) {}
 	
 	// Full/absolute file path
 	FString FileName;
@@ -77,6 +79,32 @@ public:
 
 	// The file has been imported successfully
 	bool bImported;
+
+	// Coordinator mode: the worker currently importing this file, or INDEX_NONE
+	int32 WorkerIndex;
+
+	// Coordinator mode: time at which the file was sent to its worker
+	double ImportStartTime;
+
+	// Coordinator mode: key of the file's entry in the geo import cache, empty if caching is disabled
+	FString CacheKey;
+};
+
+// A commandlet process in listen mode, importing the files sent by the coordinator
+struct FHoudiniGeoImportWorker
+{
+	FProcHandle ProcHandle;
+	uint32 ProcessId = 0;
+	FGuid Guid;
+
+	// Messaging address, valid once the worker has sent its discover message
+	FMessageAddress Address;
+
+	// The file being imported by the worker (it imports one file at a time)
+	FString ImportingFile;
+
+	// Number of times the worker was (re)started
+	int32 NumStarts = 0;
 };
 
 UCLASS()
@@ -103,6 +131,16 @@ public:
 
 	void HandleDirectoryChanged(const TArray<struct FFileChangeData>& InFileChangeDatas);
 
+	// Coordinator mode: handles the discover messages published by the workers
+	void HandleImportBGEODiscoverMessage(
+		const struct FHoudiniPDGImportBGEODiscoverMessage& InMessage,
+		const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext);
+
+	// Coordinator mode: handles the import results sent by the workers
+	void HandleImportBGEOResultMessage(
+		const struct FHoudiniPDGImportBGEOResultMessage& InMessage,
+		const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext);
+
 protected:
 
 	void PopulatePackageParams(const FString& InBGEOFilename, FHoudiniPackageParams& OutPackageParams);
@@ -124,6 +162,17 @@ protected:
 
 	void TickDiscoveredFiles();
 
+	// Coordinator mode: restarts crashed workers and sends the discovered files to the idle workers
+	void TickWorkers();
+
+	// Coordinator mode: starts a worker commandlet in listen mode
+	bool StartWorker(FHoudiniGeoImportWorker& InWorker);
+
+	void StopWorkers();
+
+	// Records the result of an import attempt of a discovered file, and schedules a retry if allowed
+	void OnFileImportFinished(FDiscoveredFileData& InFileData, const bool bInSuccess, const int32 InWorkerIndex);
+
 private:
 
 	// Messaging end point for receiving messages from PDG manager
@@ -152,4 +201,19 @@ private:
 	
 	// Bake outputs via FHoudiniEngineBakeUtils
 	bool bBakeOutputs;
+
+	// Named pipe used for our Houdini Engine session
+	FString SessionPipeName;
+
+	// Maximum number of attempts at importing a discovered file
+	uint32 MaxImportAttempts;
+
+	// Coordinator mode: the worker commandlets
+	TArray<FHoudiniGeoImportWorker> Workers;
+
+	// Coordinator mode: files imported / failed since the last summary, and the time spent importing them
+	int32 NumFilesImported;
+	int32 NumFilesFailed;
+	double TotalImportTime;
+	double FirstImportStartTime;
 };
\ No newline at end of file
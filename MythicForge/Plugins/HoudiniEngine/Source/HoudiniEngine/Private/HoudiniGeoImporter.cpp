@@ -29,6 +29,7 @@
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineString.h"
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniPackageParams.h"
@@ -44,6 +45,7 @@
 #include "HoudiniGeometryCollectionTranslator.h"
 #include "HoudiniSplineComponent.h"
 #include "HoudiniEngineRuntimeUtils.h"
+#include "HoudiniGeoImportCache.h"
 
 #include "CoreMinimal.h"
 #include "Misc/Paths.h"
@@ -827,36 +829,10 @@ UHoudiniGeoImporter::ImportBGEOFile(
 	if (InBGEOFile.IsEmpty())
 		return false;
 	
-	// 1. Houdini Engine Session
-	// See if we should/can start the default "first" HE session
-	if (!AutoStartHoudiniEngineSessionIfNeeded())
-		return false;
-
-	// 2. Update the file paths
+	// 1. Update the file paths
 	if (!SetFilePath(InBGEOFile))
 		return false;
 
-	// 3. Load the BGEO file in HAPI
-	HAPI_NodeId NodeId;
-	if (!LoadBGEOFileInHAPI(NodeId))
-		return false;
-	
-	// 4. Get the output from the file node
-	TArray<TObjectPtr<UHoudiniOutput>> NewOutputs;
-	TArray<TObjectPtr<UHoudiniOutput>> OldOutputs;
-	if (!BuildOutputsForNode(NodeId, OldOutputs, NewOutputs, true))
-		return false;
-
-	// Failure lambda
-	auto CleanUpAndReturn = [&NewOutputs](const bool& bReturnValue)
-	{
-		// Remove the output objects from the root set before returning false
-		for (auto Out : NewOutputs)
-			Out->RemoveFromRoot();
-
-		return bReturnValue;
-	};
-
 	// Prepare the package used for creating the mesh, landscape and instancer pacakges
 	FHoudiniPackageParams PackageParams;
 	if (InPackageParams)
@@ -887,7 +863,6 @@ UHoudiniGeoImporter::ImportBGEOFile(
 		PackageParams.ComponentGUID = FGuid::NewGuid();
 	}
 
-	// 5. Create the static meshes in the outputs
 	const FHoudiniStaticMeshGenerationProperties& StaticMeshGenerationProperties =
 		InStaticMeshGenerationProperties?
 		*InStaticMeshGenerationProperties :
@@ -895,10 +870,54 @@ UHoudiniGeoImporter::ImportBGEOFile(
 	
 	const FMeshBuildSettings& MeshBuildSettings =
 		InMeshBuildSettings ? *InMeshBuildSettings : FHoudiniEngineRuntimeUtils::GetDefaultMeshBuildSettings();
-		
+
+	// If the file and the settings haven't changed since the last import, reuse the objects it created
+	FString CacheKey;
+	if (FHoudiniGeoImportCache::IsEnabled()
+		&& FHoudiniGeoImportCache::ComputeKey(AbsoluteFilePath, PackageParams, StaticMeshGenerationProperties, MeshBuildSettings, CacheKey)
+		&& FHoudiniGeoImportCache::Get().FindObjects(CacheKey, OutputObjects))
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("Houdini GEO Importer: %s is unchanged, reusing %d objects from the previous import."),
+			*AbsoluteFilePath, OutputObjects.Num());
+		return true;
+	}
+
+	// 2. Houdini Engine Session
+	// See if we should/can start the default "first" HE session
+	if (!AutoStartHoudiniEngineSessionIfNeeded())
+		return false;
+
+	// 3. Load the BGEO file in HAPI
+	HAPI_NodeId NodeId;
+	if (!LoadBGEOFileInHAPI(NodeId))
+		return false;
+	
+	// 4. Get the output from the file node
+	TArray<TObjectPtr<UHoudiniOutput>> NewOutputs;
+	TArray<TObjectPtr<UHoudiniOutput>> OldOutputs;
+	if (!BuildOutputsForNode(NodeId, OldOutputs, NewOutputs, true))
+		return false;
+
+	// Failure lambda
+	auto CleanUpAndReturn = [&NewOutputs](const bool& bReturnValue)
+	{
+		// Remove the output objects from the root set before returning false
+		for (auto Out : NewOutputs)
+			Out->RemoveFromRoot();
+
+		return bReturnValue;
+	};
+
+	// 5. Create the static meshes in the outputs
 	if (!CreateObjectsFromOutputs(NewOutputs, PackageParams, StaticMeshGenerationProperties, MeshBuildSettings))
 		return CleanUpAndReturn(false);
 
+	if (!CacheKey.IsEmpty())
+	{
+		FHoudiniGeoImportCache::Get().AddObjects(CacheKey, AbsoluteFilePath, OutputObjects);
+		FHoudiniGeoImportCache::Get().Save();
+	}
+
 	// Clean up and return true
 	return CleanUpAndReturn(true);
 }
@@ -1098,8 +1117,7 @@ UHoudiniGeoImporter::CookFileNode(const HAPI_NodeId& InNodeId)
 
 	// Cook the node    
 	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookNode(
-		FHoudiniEngine::Get().GetSession(), InNodeId, &CookOptions), false);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiStartCookNode(InNodeId, &CookOptions), false);
 
 	// Wait for the cook to finish
 	int32 status = HAPI_STATE_MAX_READY_STATE + 1;
@@ -1117,6 +1135,9 @@ UHoudiniGeoImporter::CookFileNode(const HAPI_NodeId& InNodeId)
 			FPlatformProcess::Sleep(0.5f);
 	}
 
+	// Strings resolved during the cook can use stale handles
+	FHoudiniEngineString::InvalidateStringCache();
+
 	if (status != HAPI_STATE_READY)
 	{
 		// There was some cook errors
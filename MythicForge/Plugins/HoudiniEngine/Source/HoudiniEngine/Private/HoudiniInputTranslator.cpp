@@ -33,6 +33,7 @@
 #include "HoudiniDataLayerUtils.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngineRuntime.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniInput.h"
@@ -126,6 +127,266 @@ struct FHoudiniMoveTracker
 
 	bool IsObjectMoving;
 };
+
+// Keeps track of the actors that are moved, modified, added or deleted in the editor, so that
+// world inputs only look at the actors that changed since their last update instead of polling all of them.
+// The HACs that have world inputs are queued for processing when a change is detected.
+struct FHoudiniWorldInputChangeTracker
+{
+	FHoudiniWorldInputChangeTracker() : Generation(1), FullUpdateGeneration(1), bComponentsNotified(false)
+	{
+		FCoreUObjectDelegates::OnObjectModified.AddLambda([this](UObject* Object) { OnObjectChanged(Object); });
+		FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda([this](UObject* Object, FPropertyChangedEvent&) { OnObjectChanged(Object); });
+
+		GEngine->OnActorMoved().AddLambda([this](AActor* Actor) { MarkActorChanged(Actor); });
+		GEngine->OnLevelActorAdded().AddLambda([this](AActor* Actor) { MarkActorChanged(Actor); });
+		GEngine->OnLevelActorDeleted().AddLambda([this](AActor* Actor) { MarkActorChanged(Actor); });
+		GEditor->OnActorsMoved().AddLambda([this](TArray<AActor*>& Actors) { for (AActor* Actor : Actors) MarkActorChanged(Actor); });
+
+		FEditorDelegates::PostUndoRedo.AddLambda([this]() { MarkAllChanged(); });
+	}
+	static FHoudiniWorldInputChangeTracker& Get() { static FHoudiniWorldInputChangeTracker Instance; return Instance; }
+
+	uint64 GetGeneration() const { return Generation; }
+
+	// Returns false if nothing that could affect this input changed since its last update.
+	// Otherwise, OutChangedActors contains the actors that need to be checked, or bOutCheckAllActors is set
+	bool GetInputChanges(const UHoudiniInput* InInput, bool& bOutCheckAllActors, TSet<const AActor*>& OutChangedActors) const
+	{
+		const uint64* InputGeneration = InputGenerations.Find(InInput);
+		if (!InputGeneration || *InputGeneration < FullUpdateGeneration)
+		{
+			bOutCheckAllActors = true;
+			return true;
+		}
+
+		if (*InputGeneration >= Generation)
+			return false;
+
+		bOutCheckAllActors = false;
+		for (const auto& ChangedActor : ChangedActors)
+		{
+			if (ChangedActor.Value > *InputGeneration && ChangedActor.Key.IsValid())
+				OutChangedActors.Add(ChangedActor.Key.Get());
+		}
+
+		// Actors were changed, but were deleted since, still update the input to remove them
+		return true;
+	}
+
+	void MarkInputUpdated(const UHoudiniInput* InInput, const uint64& InGeneration)
+	{
+		InputGenerations.Add(InInput, InGeneration);
+
+		if (ChangedActors.Num() < 256)
+			return;
+
+		// Forget the changes that every input has already seen
+		uint64 MinGeneration = Generation;
+		for (auto Iter = InputGenerations.CreateIterator(); Iter; ++Iter)
+		{
+			if (!Iter->Key.IsValid())
+				Iter.RemoveCurrent();
+			else
+				MinGeneration = FMath::Min(MinGeneration, Iter->Value);
+		}
+
+		for (auto Iter = ChangedActors.CreateIterator(); Iter; ++Iter)
+		{
+			if (!Iter->Key.IsValid() || Iter->Value <= MinGeneration)
+				Iter.RemoveCurrent();
+		}
+
+		// Forget the assets of the deleted actors
+		for (auto Iter = ActorAssets.CreateIterator(); Iter; ++Iter)
+		{
+			if (!Iter->Key.IsValid())
+			{
+				UntrackActorAssets(Iter->Key, Iter->Value);
+				Iter.RemoveCurrent();
+			}
+		}
+	}
+
+	// Records the assets (meshes, materials...) used by an actor of a world input,
+	// so that a change to one of them only marks the actors using it as changed.
+	void TrackActorAssets(const AActor* InActor)
+	{
+		if (!InActor)
+			return;
+
+		TArray<TWeakObjectPtr<const UObject>> Assets;
+		TArray<UPrimitiveComponent*> PrimitiveComponents;
+		InActor->GetComponents(PrimitiveComponents);
+		for (UPrimitiveComponent* PrimitiveComponent : PrimitiveComponents)
+		{
+			if (!IsValid(PrimitiveComponent))
+				continue;
+
+			const UObject* Mesh = nullptr;
+			if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(PrimitiveComponent))
+				Mesh = StaticMeshComponent->GetStaticMesh();
+			else if (USkinnedMeshComponent* SkinnedMeshComponent = Cast<USkinnedMeshComponent>(PrimitiveComponent))
+				Mesh = SkinnedMeshComponent->GetSkinnedAsset();
+
+			if (Mesh)
+				Assets.AddUnique(Mesh);
+
+			TArray<UMaterialInterface*> Materials;
+			PrimitiveComponent->GetUsedMaterials(Materials);
+			for (UMaterialInterface* Material : Materials)
+			{
+				if (Material)
+					Assets.AddUnique(Material);
+			}
+		}
+
+		TArray<TWeakObjectPtr<const UObject>>& TrackedAssets = ActorAssets.FindOrAdd(InActor);
+		UntrackActorAssets(InActor, TrackedAssets);
+		for (const TWeakObjectPtr<const UObject>& Asset : Assets)
+			AssetActors.FindOrAdd(Asset).AddUnique(const_cast<AActor*>(InActor));
+		TrackedAssets = MoveTemp(Assets);
+	}
+
+	// Called at the start of a world input update, so that the following changes notify the HACs again
+	void ResetNotification() { bComponentsNotified = false; }
+
+private:
+
+	void OnObjectChanged(UObject* Object)
+	{
+		if (!Object || Object->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+			return;
+
+		// Components and other subobjects are tracked via their actor
+		AActor* Actor = Cast<AActor>(Object);
+		if (!Actor)
+			Actor = Object->GetTypedOuter<AActor>();
+
+		if (Actor)
+			MarkActorChanged(Actor);
+		else if (Object->IsAsset())
+			MarkAssetChanged(Object); // Meshes, materials... used by the input actors
+	}
+
+	void MarkAssetChanged(const UObject* Asset)
+	{
+		// Cook outputs and transient objects are never tracked, skip the lookup
+		const UPackage* Package = Asset->GetPackage();
+		if (!Package || Package == GetTransientPackage())
+			return;
+
+		if (FHoudiniEngineRuntime::IsInitialized()
+			&& Package->GetName().StartsWith(FHoudiniEngineRuntime::Get().GetDefaultTemporaryCookFolder()))
+			return;
+
+		TArray<TWeakObjectPtr<AActor>>* Actors = AssetActors.Find(Asset);
+		if (!Actors)
+			return;
+
+		// Only the actors using the asset have to be checked again by their inputs
+		const TArray<TWeakObjectPtr<AActor>> ActorsToMark = *Actors;
+		for (const TWeakObjectPtr<AActor>& Actor : ActorsToMark)
+		{
+			if (Actor.IsValid())
+				MarkActorChanged(Actor.Get());
+		}
+	}
+
+	void UntrackActorAssets(const TWeakObjectPtr<const AActor>& InActor, const TArray<TWeakObjectPtr<const UObject>>& InAssets)
+	{
+		for (const TWeakObjectPtr<const UObject>& Asset : InAssets)
+		{
+			TArray<TWeakObjectPtr<AActor>>* Actors = AssetActors.Find(Asset);
+			if (!Actors)
+				continue;
+
+			Actors->RemoveAll([&InActor](const TWeakObjectPtr<AActor>& Actor) { return !Actor.IsValid() || Actor.Get() == InActor.Get(); });
+			if (Actors->IsEmpty())
+				AssetActors.Remove(Asset);
+		}
+	}
+
+	void MarkActorChanged(AActor* Actor)
+	{
+		if (!Actor)
+			return;
+
+		// Only editor world inputs are updated
+		UWorld* World = Actor->GetWorld();
+		if (!World || World->WorldType != EWorldType::Editor)
+			return;
+
+		++Generation;
+		MarkActorChangedRecursive(Actor);
+		NotifyWorldInputComponents();
+	}
+
+	void MarkActorChangedRecursive(AActor* Actor)
+	{
+		ChangedActors.Add(Actor, Generation);
+
+		// Attached actors have moved with their parent
+		TArray<AActor*> AttachedActors;
+		Actor->GetAttachedActors(AttachedActors);
+		for (AActor* AttachedActor : AttachedActors)
+		{
+			if (AttachedActor && ChangedActors.FindRef(AttachedActor) != Generation)
+				MarkActorChangedRecursive(AttachedActor);
+		}
+	}
+
+	void MarkAllChanged()
+	{
+		FullUpdateGeneration = ++Generation;
+		NotifyWorldInputComponents();
+	}
+
+	// Queues the HACs that have world inputs for processing
+	void NotifyWorldInputComponents()
+	{
+		if (bComponentsNotified || !FHoudiniEngineRuntime::IsInitialized())
+			return;
+
+		bComponentsNotified = true;
+
+		FHoudiniEngineRuntime& Runtime = FHoudiniEngineRuntime::Get();
+		for (int32 Idx = 0; Idx < Runtime.GetRegisteredHoudiniComponentCount(); Idx++)
+		{
+			UHoudiniAssetComponent* HAC = Runtime.GetRegisteredHoudiniComponentAt(Idx);
+			if (!IsValid(HAC))
+				continue;
+
+			for (const UHoudiniInput* CurrentInput : HAC->Inputs)
+			{
+				if (IsValid(CurrentInput) && CurrentInput->GetInputType() == EHoudiniInputType::World)
+				{
+					Runtime.MarkHoudiniComponentDirty(HAC);
+					break;
+				}
+			}
+		}
+	}
+
+	// Incremented every time a change is detected
+	uint64 Generation;
+
+	// Generation of the last change that requires all the world inputs to check all their actors
+	uint64 FullUpdateGeneration;
+
+	// Generation at which each actor last changed
+	TMap<TWeakObjectPtr<const AActor>, uint64> ChangedActors;
+
+	// Generation at which each world input was last updated
+	TMap<TWeakObjectPtr<const UHoudiniInput>, uint64> InputGenerations;
+
+	// Assets used by the actors of the world inputs, and the reverse mapping
+	TMap<TWeakObjectPtr<const AActor>, TArray<TWeakObjectPtr<const UObject>>> ActorAssets;
+	TMap<TWeakObjectPtr<const UObject>, TArray<TWeakObjectPtr<AActor>>> AssetActors;
+
+	// Whether the HACs have been queued since the last world input update
+	bool bComponentsNotified;
+};
 #endif
 
 // 
@@ -4868,6 +5129,11 @@ FHoudiniInputTranslator::UpdateWorldInputs(UHoudiniAssetComponent* HAC)
 	}
 
 #if WITH_EDITOR
+	// Only look at the world inputs, and at their actors, that changed since their last update.
+	// Reset the notification first so that the end of a drag notifies the HACs again.
+	FHoudiniWorldInputChangeTracker& ChangeTracker = FHoudiniWorldInputChangeTracker::Get();
+	ChangeTracker.ResetNotification();
+
 	// Stop outliner objects from causing recooks while input objects are dragged around
 	if (FHoudiniMoveTracker::Get().IsObjectMoving)
 	{
@@ -4883,14 +5149,25 @@ FHoudiniInputTranslator::UpdateWorldInputs(UHoudiniAssetComponent* HAC)
 		if (CurrentInput->GetInputType() != EHoudiniInputType::World)
 			continue;
 
+#if WITH_EDITOR
+		bool bCheckAllActors = false;
+		TSet<const AActor*> ChangedActors;
+		if (!ChangeTracker.GetInputChanges(CurrentInput, bCheckAllActors, ChangedActors))
+			continue;
+
+		const uint64 Generation = ChangeTracker.GetGeneration();
+		UpdateWorldInput(CurrentInput, bCheckAllActors ? nullptr : &ChangedActors);
+		ChangeTracker.MarkInputUpdated(CurrentInput, Generation);
+#else
 		UpdateWorldInput(CurrentInput);
+#endif
 	}
 
 	return true;
 }
 
 bool
-FHoudiniInputTranslator::UpdateWorldInput(UHoudiniInput* InInput)
+FHoudiniInputTranslator::UpdateWorldInput(UHoudiniInput* InInput, const TSet<const AActor*>* InChangedActors)
 {
 	if (!IsValid(InInput))
 		return false;
@@ -4952,6 +5229,10 @@ FHoudiniInputTranslator::UpdateWorldInput(UHoudiniInput* InInput)
 			continue;
 		}
 
+		// Unchanged actors don't need to be checked
+		if (InChangedActors && !InChangedActors->Contains(Actor))
+			continue;
+
 		// If we send our input objects as references, we should recreate the whole input node for 
 		// a transform change (as the transform is stored as a point attribute, not as a geo/object transform)
 		bool bImportAsRef = InInput->GetImportAsReference();
@@ -4979,6 +5260,9 @@ FHoudiniInputTranslator::UpdateWorldInput(UHoudiniInput* InInput)
 
 		// Ensure we are aware of all the components of the actor
 		ActorObject->Update(Actor, InputSettings);
+#if WITH_EDITOR
+		FHoudiniWorldInputChangeTracker::Get().TrackActorAssets(Actor);
+#endif
 
 		// Check if any components have content or transform changes
 		for (auto CurActorComp : ActorObject->GetActorComponents())
@@ -5070,8 +5354,7 @@ FHoudiniInputTranslator::CreateInputNodeForReference(
 	}
 
 	/*
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookNode(
-		FHoudiniEngine::Get().GetSession(), NewNodeId, nullptr), false);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiStartCookNode(NewNodeId, nullptr), false);
 	*/
 
 	// Check if we have a valid id for this new input asset.
@@ -5450,8 +5733,7 @@ FHoudiniInputTranslator::HapiCreateInputNodeForDataTable(
 		FHoudiniEngine::Get().GetSession(), InputNodeId), false);
 
 	// Commit the geo.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookNode(
-		FHoudiniEngine::Get().GetSession(), InputNodeId, nullptr), false);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiStartCookNode(InputNodeId, nullptr), false);
 	*/
 
 	return true;
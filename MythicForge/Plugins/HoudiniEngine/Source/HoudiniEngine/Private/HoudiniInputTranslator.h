@@ -136,7 +136,8 @@ struct HOUDINIENGINE_API FHoudiniInputTranslator
 	static bool UpdateWorldInputs(UHoudiniAssetComponent* HAC);
 
 	// Updates/ticks the given world input
-	static bool UpdateWorldInput(UHoudiniInput* InInput);
+	// If InChangedActors is set, only these actors are checked for changes, deleted actors are still removed.
+	static bool UpdateWorldInput(UHoudiniInput* InInput, const TSet<const AActor*>* InChangedActors = nullptr);
 
 	// Connect an input's nodes to its linked HDA node
 	static bool ConnectInputNode(UHoudiniInput* InInput);
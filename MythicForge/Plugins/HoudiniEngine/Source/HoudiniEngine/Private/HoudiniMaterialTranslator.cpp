@@ -61,6 +61,9 @@
 #include "Engine/Texture2D.h"
 #include "Factories/MaterialFactoryNew.h"
 #include "Serialization/BufferWriter.h"
+#include "Async/ParallelFor.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Misc/SecureHash.h"
 
 #if WITH_EDITOR
 	#include "Factories/MaterialFactoryNew.h"
@@ -971,6 +974,134 @@ FHoudiniMaterialTranslator::CreatePackageForTexture(
 }
 
 
+// Returns the number of bytes per pixel of a Houdini image packing, 0 for invalid packings
+static uint32
+GetImagePackingPixelSize(const HAPI_ImagePacking& InPacking)
+{
+	switch (InPacking)
+	{
+		case HAPI_IMAGE_PACKING_SINGLE:
+			return 1;
+		case HAPI_IMAGE_PACKING_DUAL:
+			return 2;
+		case HAPI_IMAGE_PACKING_RGB:
+		case HAPI_IMAGE_PACKING_BGR:
+			return 3;
+		case HAPI_IMAGE_PACKING_RGBA:
+		case HAPI_IMAGE_PACKING_ABGR:
+			return 4;
+		default:
+			return 0;
+	}
+}
+
+// Hash of the image data and of the parameters used to create a texture from it
+static FString
+ComputeTextureContentHash(
+	const HAPI_ImageInfo& ImageInfo,
+	const TArray<char>& ImageBuffer,
+	const FCreateTexture2DParameters& TextureParameters)
+{
+	FSHA1 HashState;
+	HashState.Update(reinterpret_cast<const uint8*>(ImageBuffer.GetData()), ImageBuffer.Num());
+
+	const int32 Settings[] = {
+		ImageInfo.xRes, ImageInfo.yRes, (int32)ImageInfo.packing,
+		TextureParameters.bUseAlpha ? 1 : 0, TextureParameters.bSRGB ? 1 : 0,
+		(int32)TextureParameters.CompressionSettings, TextureParameters.bDeferCompression ? 1 : 0 };
+	HashState.Update(reinterpret_cast<const uint8*>(Settings), sizeof(Settings));
+	HashState.Final();
+
+	FSHAHash Hash;
+	HashState.GetHash(Hash.Hash);
+	return Hash.ToString();
+}
+
+// Repacks a Houdini image (top row first) to a BGRA8 image (bottom row first).
+// Rows are converted in parallel, four channel images are swizzled a whole pixel at a time.
+// Returns true if bUseSourceAlpha is set and a pixel's alpha isn't opaque.
+static bool
+SwizzleImageToBGRA8(
+	const HAPI_ImagePacking& InPacking,
+	const uint8* SrcData,
+	const uint32 SrcWidth,
+	const uint32 SrcHeight,
+	const bool bUseSourceAlpha,
+	FColor* DestData)
+{
+	static_assert(PLATFORM_LITTLE_ENDIAN, "The texture swizzle expects little endian pixels.");
+
+	const uint32 PackOffset = GetImagePackingPixelSize(InPacking);
+	FThreadSafeBool bHasAlphaValue = false;
+	ParallelFor(SrcHeight, [&](int32 y)
+	{
+		const uint8* SrcRow = SrcData + (SIZE_T)y * SrcWidth * PackOffset;
+		uint32* DestRow = reinterpret_cast<uint32*>(DestData + (SIZE_T)(SrcHeight - 1 - y) * SrcWidth);
+
+		switch (InPacking)
+		{
+			case HAPI_IMAGE_PACKING_RGBA:
+			case HAPI_IMAGE_PACKING_ABGR:
+			{
+				uint32 AlphaMask = 0xFF000000;
+				const bool bABGR = InPacking == HAPI_IMAGE_PACKING_ABGR;
+				for (uint32 x = 0; x < SrcWidth; x++)
+				{
+					uint32 Pixel;
+					FMemory::Memcpy(&Pixel, SrcRow + x * 4, sizeof(uint32));
+
+					// RGBA bytes are 0xAABBGGRR, ABGR bytes are 0xRRGGBBAA, BGRA bytes are 0xAARRGGBB
+					Pixel = bABGR
+						? (Pixel >> 8) | (Pixel << 24)
+						: (Pixel & 0xFF00FF00) | ((Pixel >> 16) & 0xFF) | ((Pixel & 0xFF) << 16);
+
+					AlphaMask &= Pixel;
+					DestRow[x] = bUseSourceAlpha ? Pixel : (Pixel | 0xFF000000);
+				}
+
+				if (bUseSourceAlpha && AlphaMask != 0xFF000000)
+					bHasAlphaValue = true;
+				break;
+			}
+
+			case HAPI_IMAGE_PACKING_RGB:
+				for (uint32 x = 0; x < SrcWidth; x++)
+				{
+					const uint8* Src = SrcRow + x * 3;
+					DestRow[x] = 0xFF000000 | ((uint32)Src[0] << 16) | ((uint32)Src[1] << 8) | (uint32)Src[2];
+				}
+				break;
+
+			case HAPI_IMAGE_PACKING_BGR:
+				for (uint32 x = 0; x < SrcWidth; x++)
+				{
+					const uint8* Src = SrcRow + x * 3;
+					DestRow[x] = 0xFF000000 | ((uint32)Src[2] << 16) | ((uint32)Src[1] << 8) | (uint32)Src[0];
+				}
+				break;
+
+			case HAPI_IMAGE_PACKING_DUAL:
+				for (uint32 x = 0; x < SrcWidth; x++)
+				{
+					const uint8* Src = SrcRow + x * 2;
+					DestRow[x] = 0xFF000000 | ((uint32)Src[0] << 16) | ((uint32)Src[1] << 8) | (uint32)Src[1];
+				}
+				break;
+
+			case HAPI_IMAGE_PACKING_SINGLE:
+				for (uint32 x = 0; x < SrcWidth; x++)
+					DestRow[x] = 0xFF000000 | ((uint32)SrcRow[x] * 0x010101);
+				break;
+
+			default:
+				break;
+		}
+	});
+
+	return bHasAlphaValue;
+}
+
+
 UTexture2D *
 FHoudiniMaterialTranslator::CreateUnrealTexture(
 	UTexture2D* ExistingTexture,
@@ -981,8 +1112,10 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 	const FCreateTexture2DParameters& TextureParameters,
 	const TextureGroup& LODGroup, 
 	const FString& TextureType,
-	const FString& NodePath)
+	const FString& NodePath,
+	bool& bOutTextureUpdated)
 {
+	bOutTextureUpdated = false;
 	if (!IsValid(Package))
 		return nullptr;
 
@@ -1012,120 +1145,38 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 	FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
 		Package, Texture, HAPI_UNREAL_PACKAGE_META_NODE_PATH, *NodePath);
 
-	// Initialize texture source.
-	Texture->Source.Init(ImageInfo.xRes, ImageInfo.yRes, 1, 1, TSF_BGRA8);
+	const uint32 SrcWidth = ImageInfo.xRes;
+	const uint32 SrcHeight = ImageInfo.yRes;
+	const uint32 PackOffset = GetImagePackingPixelSize(ImageInfo.packing);
 
-	// Lock the texture.
-	uint8 * MipData = Texture->Source.LockMip(0);
+	// Invalid packing
+	HOUDINI_CHECK_RETURN(PackOffset > 0, nullptr);
 
-	// Create base map.
-	uint8* DestPtr = nullptr;
-	uint32 SrcWidth = ImageInfo.xRes;
-	uint32 SrcHeight = ImageInfo.yRes;
-	const char * SrcData = &ImageBuffer[0];
-
-	// Handle the different packing for the source Houdini texture
-	uint32 PackOffset = 4;
-	uint32 OffsetR = 0;
-	uint32 OffsetG = 1;
-	uint32 OffsetB = 2;
-	uint32 OffsetA = 3;
-	switch (ImageInfo.packing)
+	// Hash the image and the parameters used to build the texture from it.
+	// If the existing texture was built from the same content, there is no need to update its source, which would
+	// trigger a recompression of the texture.
+	const FString TextureHash = ComputeTextureContentHash(ImageInfo, ImageBuffer, TextureParameters);
+	if (ExistingTexture && ExistingTexture->Source.IsValid())
 	{
-		case HAPI_IMAGE_PACKING_SINGLE:
-			PackOffset = 1;
-			OffsetR = 0;
-			OffsetG = 0;
-			OffsetB = 0;
-			OffsetA = 0;
-			break;
-
-		case HAPI_IMAGE_PACKING_DUAL:
-			PackOffset = 2;
-			OffsetR = 0;
-			OffsetG = 1;
-			OffsetB = 1;
-			OffsetA = 0;
-			break;
-
-		case HAPI_IMAGE_PACKING_RGB:
-			PackOffset = 3;
-			OffsetR = 0;
-			OffsetG = 1;
-			OffsetB = 2;
-			OffsetA = 0;
-			break;
-
-		case HAPI_IMAGE_PACKING_BGR:
-			PackOffset = 3;
-			OffsetR = 2;
-			OffsetG = 1;
-			OffsetB = 0;
-			OffsetA = 0;
-			break;
-
-		case HAPI_IMAGE_PACKING_RGBA:
-			PackOffset = 4;
-			OffsetR = 0;
-			OffsetG = 1;
-			OffsetB = 2;
-			OffsetA = 3;
-			break;
-
-		case HAPI_IMAGE_PACKING_ABGR:
-			PackOffset = 4;
-			OffsetR = 3;
-			OffsetG = 2;
-			OffsetB = 1;
-			OffsetA = 0;
-			break;
-
-		case HAPI_IMAGE_PACKING_UNKNOWN:
-		case HAPI_IMAGE_PACKING_MAX:
-			// invalid packing
-			HOUDINI_CHECK_RETURN(false, nullptr);
-			break;
+		UMetaData* MetaData = Package->GetMetaData();
+		if (MetaData && MetaData->GetValue(ExistingTexture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH) == TextureHash)
+			return Texture;
 	}
 
-	for (uint32 y = 0; y < SrcHeight; y++)
-	{
-		DestPtr = &MipData[(SrcHeight - 1 - y) * SrcWidth * sizeof(FColor)];
-
-		for (uint32 x = 0; x < SrcWidth; x++)
-		{
-			uint32 DataOffset = y * SrcWidth * PackOffset + x * PackOffset;
-
-			*DestPtr++ = *(uint8*)(SrcData + DataOffset + OffsetB); // B
-			*DestPtr++ = *(uint8*)(SrcData + DataOffset + OffsetG); // G
-			*DestPtr++ = *(uint8*)(SrcData + DataOffset + OffsetR); // R
+	FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
+		Package, Texture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH, *TextureHash);
 
-			if (TextureParameters.bUseAlpha && PackOffset == 4)
-				*DestPtr++ = *(uint8*)(SrcData + DataOffset + OffsetA); // A
-			else
-				*DestPtr++ = 0xFF;
-		}
-	}
+	// Initialize texture source.
+	Texture->Source.Init(ImageInfo.xRes, ImageInfo.yRes, 1, 1, TSF_BGRA8);
 
-	bool bHasAlphaValue = false;
-	if (TextureParameters.bUseAlpha)
-	{
-		// See if there is an actual alpha value in the texture or if we can ignore the texture alpha
-		for (uint32 y = 0; y < SrcHeight; y++)
-		{
-			for (uint32 x = 0; x < SrcWidth; x++)
-			{
-				uint32 DataOffset = y * SrcWidth * 4 + x * 4;
-				if (*(uint8*)(SrcData + DataOffset + 3) != 0xFF)
-				{
-					bHasAlphaValue = true;
-					break;
-				}
-			}
+	// Lock the texture.
+	uint8 * MipData = Texture->Source.LockMip(0);
 
-			if (bHasAlphaValue)
-				break;
-		}
-	}
+	// Repack the Houdini image to BGRA8, flipping the rows.
+	const bool bUseSourceAlpha = TextureParameters.bUseAlpha && PackOffset == 4;
+	const bool bHasAlphaValue = SwizzleImageToBGRA8(
+		ImageInfo.packing, reinterpret_cast<const uint8*>(ImageBuffer.GetData()), SrcWidth, SrcHeight, bUseSourceAlpha,
+		reinterpret_cast<FColor*>(MipData));
 
 	// Unlock the texture.
 	Texture->Source.UnlockMip(0);
@@ -1146,6 +1197,7 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 
 	Texture->PostEditChange();
 
+	bOutTextureUpdated = true;
 	return Texture;
 }
 
@@ -1548,6 +1600,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentDiffuse(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing diffuse texture, or create new one.
+				bool bTextureUpdated = false;
 				TextureDiffuse = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureDiffuse,
 					ImageInfo,
@@ -1557,7 +1610,8 @@ FHoudiniMaterialTranslator::CreateMaterialComponentDiffuse(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE,
-					NodePath);
+					NodePath,
+					bTextureUpdated);
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureDiffuse->SetFlags(RF_Public | RF_Standalone);
@@ -1582,9 +1636,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentDiffuse(
 				if (bCreatedNewTextureDiffuse)
 					FAssetRegistryModule::AssetCreated(TextureDiffuse);
 
-				TextureDiffuse->PreEditChange(nullptr);
-				TextureDiffuse->PostEditChange();
-				TextureDiffuse->MarkPackageDirty();
+				// Only trigger the texture update if its content changed
+				if (bTextureUpdated)
+				{
+					TextureDiffuse->PreEditChange(nullptr);
+					TextureDiffuse->PostEditChange();
+					TextureDiffuse->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -1874,6 +1932,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing opacity texture, or create new one.
+				bool bTextureUpdated = false;
 				TextureOpacity = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureOpacity,
 					ImageInfo,
@@ -1883,7 +1942,8 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK,
-					NodePath);
+					NodePath,
+					bTextureUpdated);
 
  				// if (BakeMode == EBakeMode::CookToTemp)
 				TextureOpacity->SetFlags(RF_Public | RF_Standalone);
@@ -1927,9 +1987,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 				if (bCreatedNewTextureOpacity)
 					FAssetRegistryModule::AssetCreated(TextureOpacity);
 
-				TextureOpacity->PreEditChange(nullptr);
-				TextureOpacity->PostEditChange();
-				TextureOpacity->MarkPackageDirty();
+				// Only trigger the texture update if its content changed
+				if (bTextureUpdated)
+				{
+					TextureOpacity->PreEditChange(nullptr);
+					TextureOpacity->PostEditChange();
+					TextureOpacity->MarkPackageDirty();
+				}
 
 				bExpressionCreated = true;
 			}
@@ -2309,6 +2373,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing normal texture, or create new one.
+				bool bTextureUpdated = false;
 				TextureNormal = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureNormal,
 					ImageInfo,
@@ -2318,7 +2383,8 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_WorldNormalMap,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
-					NodePath);
+					NodePath,
+					bTextureUpdated);
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureNormal->SetFlags(RF_Public | RF_Standalone);
@@ -2353,9 +2419,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 				if (bCreatedNewTextureNormal)
 					FAssetRegistryModule::AssetCreated(TextureNormal);
 
-				TextureNormal->PreEditChange(nullptr);
-				TextureNormal->PostEditChange();
-				TextureNormal->MarkPackageDirty();
+				// Only trigger the texture update if its content changed
+				if (bTextureUpdated)
+				{
+					TextureNormal->PreEditChange(nullptr);
+					TextureNormal->PostEditChange();
+					TextureNormal->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -2467,6 +2537,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 					FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 					// Reuse existing normal texture, or create new one.
+					bool bTextureUpdated = false;
 					TextureNormal = FHoudiniMaterialTranslator::CreateUnrealTexture(
 						TextureNormal, 
 						ImageInfo,
@@ -2476,7 +2547,8 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 						CreateTexture2DParameters,
 						TEXTUREGROUP_WorldNormalMap,
 						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
-						NodePath);
+						NodePath,
+						bTextureUpdated);
 
 					//if (BakeMode == EBakeMode::CookToTemp)
 					TextureNormal->SetFlags(RF_Public | RF_Standalone);
@@ -2509,9 +2581,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 					if (bCreatedNewTextureNormal)
 						FAssetRegistryModule::AssetCreated(TextureNormal);
 
-					TextureNormal->PreEditChange(nullptr);
-					TextureNormal->PostEditChange();
-					TextureNormal->MarkPackageDirty();
+					// Only trigger the texture update if its content changed
+					if (bTextureUpdated)
+					{
+						TextureNormal->PreEditChange(nullptr);
+						TextureNormal->PostEditChange();
+						TextureNormal->MarkPackageDirty();
+					}
 
 					bExpressionCreated = true;
 				}
@@ -2662,6 +2738,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing specular texture, or create new one.
+				bool bTextureUpdated = false;
 				TextureSpecular = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureSpecular,
 					ImageInfo,
@@ -2671,7 +2748,8 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_SPECULAR,
-					NodePath);
+					NodePath,
+					bTextureUpdated);
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureSpecular->SetFlags(RF_Public | RF_Standalone);
@@ -2705,9 +2783,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 				if (bCreatedNewTextureSpecular)
 					FAssetRegistryModule::AssetCreated(TextureSpecular);
 
-				TextureSpecular->PreEditChange(nullptr);
-				TextureSpecular->PostEditChange();
-				TextureSpecular->MarkPackageDirty();
+				// Only trigger the texture update if its content changed
+				if (bTextureUpdated)
+				{
+					TextureSpecular->PreEditChange(nullptr);
+					TextureSpecular->PostEditChange();
+					TextureSpecular->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -2921,6 +3003,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing roughness texture, or create new one.
+				bool bTextureUpdated = false;
 				TextureRoughness = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureRoughness,
 					ImageInfo,
@@ -2930,7 +3013,8 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_ROUGHNESS,
-					NodePath);
+					NodePath,
+					bTextureUpdated);
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureRoughness->SetFlags(RF_Public | RF_Standalone);
@@ -2962,9 +3046,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 				if (bCreatedNewTextureRoughness)
 					FAssetRegistryModule::AssetCreated(TextureRoughness);
 
-				TextureRoughness->PreEditChange(nullptr);
-				TextureRoughness->PostEditChange();
-				TextureRoughness->MarkPackageDirty();
+				// Only trigger the texture update if its content changed
+				if (bTextureUpdated)
+				{
+					TextureRoughness->PreEditChange(nullptr);
+					TextureRoughness->PostEditChange();
+					TextureRoughness->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -3182,6 +3270,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing metallic texture, or create new one.
+				bool bTextureUpdated = false;
 				TextureMetallic = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureMetallic, 
 					ImageInfo,
@@ -3191,7 +3280,8 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC,
-					NodePath);
+					NodePath,
+					bTextureUpdated);
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureMetallic->SetFlags(RF_Public | RF_Standalone);
@@ -3223,9 +3313,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 				if (bCreatedNewTextureMetallic)
 					FAssetRegistryModule::AssetCreated(TextureMetallic);
 
-				TextureMetallic->PreEditChange(nullptr);
-				TextureMetallic->PostEditChange();
-				TextureMetallic->MarkPackageDirty();
+				// Only trigger the texture update if its content changed
+				if (bTextureUpdated)
+				{
+					TextureMetallic->PreEditChange(nullptr);
+					TextureMetallic->PostEditChange();
+					TextureMetallic->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -3549,6 +3643,7 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
 				// Reuse existing emissive texture, or create new one.
+				bool bTextureUpdated = false;
 				TextureEmissive = FHoudiniMaterialTranslator::CreateUnrealTexture(
 					TextureEmissive,
 					ImageInfo,
@@ -3558,7 +3653,8 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 					CreateTexture2DParameters,
 					TEXTUREGROUP_World,
 					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE,
-					NodePath);
+					NodePath,
+					bTextureUpdated);
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureEmissive->SetFlags(RF_Public | RF_Standalone);
@@ -3583,9 +3679,13 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 				if (bCreatedNewTextureEmissive)
 					FAssetRegistryModule::AssetCreated(TextureEmissive);
 
-				TextureEmissive->PreEditChange(nullptr);
-				TextureEmissive->PostEditChange();
-				TextureEmissive->MarkPackageDirty();
+				// Only trigger the texture update if its content changed
+				if (bTextureUpdated)
+				{
+					TextureEmissive->PreEditChange(nullptr);
+					TextureEmissive->PostEditChange();
+					TextureEmissive->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
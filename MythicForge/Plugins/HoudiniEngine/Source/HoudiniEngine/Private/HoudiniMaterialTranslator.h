@@ -262,6 +262,8 @@ public:
 
 
 	// Create a texture from given information.
+	// If ExistingTexture was created from the same image and parameters, it is returned untouched
+	// and bOutTextureUpdated is set to false.
 	static UTexture2D* CreateUnrealTexture(
 		UTexture2D* ExistingTexture,
 		const HAPI_ImageInfo& ImageInfo,
@@ -271,7 +273,8 @@ public:
 		const FCreateTexture2DParameters& TextureParameters,
 		const TextureGroup& LODGroup,
 		const FString& TextureType,
-		const FString& NodePath);
+		const FString& NodePath,
+		bool& bOutTextureUpdated);
 
 	// HAPI : Retrieve a list of image planes.
 	static bool HapiExtractImage(
@@ -67,6 +67,7 @@
 #include "Components/SkeletalMeshComponent.h"
 
 #include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Async/ParallelFor.h"
 
 #include "EditorSupportDelegates.h"
 #include "HoudiniGeometryCollectionTranslator.h"
@@ -87,6 +88,28 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineMeshBuildTimer(
 	TEXT("When enabled, the plugin will output timings during the Mesh creation.\n")
 );
 
+// Number of elements (vertices or triangles) processed per task when populating meshes in parallel.
+// Small meshes end up in a single chunk and are populated on the calling thread.
+static constexpr int32 HoudiniMeshPopulateChunkSize = 16384;
+
+// Runs InChunkFunc(StartIndex, EndIndex) over [0, InNumElements) split in chunks of HoudiniMeshPopulateChunkSize.
+// Each chunk must only write to its own range of pre-sized arrays.
+template<typename ChunkFuncType>
+static void
+ParallelForMeshChunks(const int32 InNumElements, const ChunkFuncType& InChunkFunc)
+{
+	if (InNumElements <= 0)
+		return;
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(InNumElements, HoudiniMeshPopulateChunkSize);
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
+	{
+		const int32 StartIdx = ChunkIdx * HoudiniMeshPopulateChunkSize;
+		const int32 EndIdx = FMath::Min(StartIdx + HoudiniMeshPopulateChunkSize, InNumElements);
+		InChunkFunc(StartIdx, EndIdx);
+	}, NumChunks <= 1);
+}
+
 bool
 FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 	UHoudiniOutput* InOutput, 
@@ -2323,27 +2346,43 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			TVertexAttributesRef<FVector3f> VertexPositions = 
 				MeshDescription->VertexAttributes().GetAttributesRef<FVector3f>(MeshAttribute::Vertex::Position);
 
-			bool bHasInvalidPositionIndexData = false;
-			MeshDescription->ReserveNewVertices(SplitNeededVertices.Num());
-			for (const int32& NeededVertexIndex : SplitNeededVertices)
-			{
-				// Create a new Vertex
-				FVertexID VertexID = MeshDescription->CreateVertex();
-				if (PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
+			// Vertices have to be created serially, their positions are then filled in parallel
+			const int32 NumSplitVertices = SplitNeededVertices.Num();
+			TArray<FVertexID> SplitVertexIDs;
+			SplitVertexIDs.SetNumUninitialized(NumSplitVertices);
+			MeshDescription->ReserveNewVertices(NumSplitVertices);
+			for (int32 SplitVertexIdx = 0; SplitVertexIdx < NumSplitVertices; ++SplitVertexIdx)
+				SplitVertexIDs[SplitVertexIdx] = MeshDescription->CreateVertex();
+
+			const int32 NumPartPoints = PartPositions.Num() / 3;
+			const float* PartPositionsData = PartPositions.GetData();
+			std::atomic<bool> bHasInvalidPositionIndexDataAtomic(false);
+			ParallelForMeshChunks(NumSplitVertices, [&](int32 StartIdx, int32 EndIdx)
+			{
+				bool bChunkHasInvalidData = false;
+				for (int32 SplitVertexIdx = StartIdx; SplitVertexIdx < EndIdx; ++SplitVertexIdx)
 				{
+					const int32 NeededVertexIndex = SplitNeededVertices[SplitVertexIdx];
+					if (NeededVertexIndex < 0 || NeededVertexIndex >= NumPartPoints)
+					{
+						// Error when retrieving positions.
+						bChunkHasInvalidData = true;
+						continue;
+					}
+
 					// We need to swap Z and Y coordinate here, and convert from m to cm. 
-					VertexPositions[VertexID].X = PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-					VertexPositions[VertexID].Y = PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-					VertexPositions[VertexID].Z = PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+					const float* Position = PartPositionsData + NeededVertexIndex * 3;
+					VertexPositions[SplitVertexIDs[SplitVertexIdx]] = FVector3f(
+						Position[0] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
+						Position[2] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
+						Position[1] * HAPI_UNREAL_SCALE_FACTOR_POSITION);
 				}
-				else
-				{
-					// Error when retrieving positions.
-					bHasInvalidPositionIndexData = true;
 
-					continue;
-				}
-			}
+				if (bChunkHasInvalidData)
+					bHasInvalidPositionIndexDataAtomic = true;
+			});
+
+			const bool bHasInvalidPositionIndexData = bHasInvalidPositionIndexDataAtomic;
 
 			if (bHasInvalidPositionIndexData)
 			{
@@ -2775,23 +2814,30 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			//Approximately 2.5 edges per polygons
 			MeshDescription->ReserveNewEdges(SplitIndices.Num() * 2.5f / 3);
 
-			bHasNormal = SplitNormals.Num() > 0;
-			bHasTangents = SplitTangentU.Num() > 0 && SplitTangentV.Num() > 0;
-			bool bHasRGB = SplitColors.Num() > 0;
-			bool bHasRGBA = bHasRGB && AttribInfoColors.tupleSize == 4;
-			bool bHasAlpha = SplitAlphas.Num() > 0;
+			// Validate the attribute arrays once up front, instead of per vertex instance.
+			// Attributes are indexed by split index, so each array has to cover all of them.
+			const int32 NumSplitIndices = SplitIndices.Num();
+			const int32 ColorTupleSize = AttribInfoColors.tupleSize;
+			bHasNormal = SplitNormals.Num() > 0 && SplitNormals.Num() >= NumSplitIndices * 3;
+			bHasTangents = SplitTangentU.Num() > 0 && SplitTangentV.Num() > 0
+				&& SplitTangentU.Num() >= NumSplitIndices * 3
+				&& SplitTangentV.Num() >= NumSplitIndices * 3;
+			bool bHasRGB = SplitColors.Num() > 0 && ColorTupleSize >= 3 && SplitColors.Num() >= NumSplitIndices * ColorTupleSize;
+			bool bHasRGBA = bHasRGB && ColorTupleSize == 4;
+			bool bHasAlpha = SplitAlphas.Num() > 0 && SplitAlphas.Num() >= NumSplitIndices;
 
 			TArray<bool> HasUVSets;
 			HasUVSets.SetNumZeroed(PartUVSets.Num());
 			for (int32 Idx = 0; Idx < PartUVSets.Num(); Idx++)
-				HasUVSets[Idx] = PartUVSets[Idx].Num() > 0;
+				HasUVSets[Idx] = PartUVSets[Idx].Num() > 0 && SplitUVSets[Idx].Num() >= NumSplitIndices * 2;
 
-			uint32 FaceCount = SplitIndices.Num() / 3;
+			// First pass: create the topology serially, as the mesh description's element containers aren't thread safe.
+			// Degenerate triangles are skipped and keep an invalid vertex instance ID.
+			const uint32 FaceCount = NumSplitIndices / 3;
+			TArray<FVertexInstanceID> SplitVertexInstanceIDs;
+			SplitVertexInstanceIDs.Init(FVertexInstanceID::Invalid, FaceCount * 3);
 			for (uint32 FaceIndex = 0; FaceIndex < FaceCount; FaceIndex++)
 			{
-				TArray<FVertexInstanceID> FaceVertexInstanceIDs;
-				FaceVertexInstanceIDs.SetNum(3);
-
 				// Ignore degenerate triangles
 				FVertexID VertexIDs[3];
 				for (int32 Corner = 0; Corner < 3; ++Corner)
@@ -2801,101 +2847,106 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 				if (VertexIDs[0] == VertexIDs[1] || VertexIDs[0] == VertexIDs[2] || VertexIDs[1] == VertexIDs[2])
 					continue;
 
-				//FVertexID FaceVertexIDs[3];
+				FVertexInstanceID FaceVertexInstanceIDs[3];
 				for (int32 Corner = 0; Corner < 3; Corner++)
 				{
-					uint32 SplitIndex = (FaceIndex * 3) + Corner;
-					uint32 SplitVertexIndex = SplitIndices[SplitIndex];
-					const FVertexInstanceID& VertexInstanceID = MeshDescription->CreateVertexInstance(FVertexID(SplitVertexIndex));
-
-					// Fix the winding order by updating the SplitIndex (invert corner 1 and 2)
-					// instead of going 0 1 2 go 0 2 1
-					// TODO; this slows down StaticMesh->Build() considerably!
-					Corner == 1 ? SplitIndex++ : Corner == 2 ? SplitIndex-- : SplitIndex;
-
-					const uint32 SplitVertexIndex_X = SplitIndex * 3 + 0;
-					const uint32 SplitVertexIndex_Y = SplitIndex * 3 + 2;
-					const uint32 SplitVertexIndex_Z = SplitIndex * 3 + 1;
-					// Normals
-					if (bHasNormal)
-					{
-						// We need to swap Z and Y coordinate here, and convert from m to cm. 
-						VertexInstanceNormals[VertexInstanceID].X = SplitNormals[SplitVertexIndex_X];
-						VertexInstanceNormals[VertexInstanceID].Y = SplitNormals[SplitVertexIndex_Y];
-						VertexInstanceNormals[VertexInstanceID].Z = SplitNormals[SplitVertexIndex_Z];
-					}
+					FaceVertexInstanceIDs[Corner] = MeshDescription->CreateVertexInstance(VertexIDs[Corner]);
+					SplitVertexInstanceIDs[FaceIndex * 3 + Corner] = FaceVertexInstanceIDs[Corner];
+				}
 
-					// Tangents and binormals
-					if (bHasTangents)
-					{
-						// We need to swap Z and Y coordinate here, and convert from m to cm.
-						VertexInstanceTangents[VertexInstanceID].X = SplitTangentU[SplitVertexIndex_X];
-						VertexInstanceTangents[VertexInstanceID].Y = SplitTangentU[SplitVertexIndex_Y];
-						VertexInstanceTangents[VertexInstanceID].Z = SplitTangentU[SplitVertexIndex_Z];
-
-						FVector3f TangentY;
-						TangentY.X = SplitTangentV[SplitVertexIndex_X];
-						TangentY.Y = SplitTangentV[SplitVertexIndex_Y];
-						TangentY.Z = SplitTangentV[SplitVertexIndex_Z];
-
-						VertexInstanceBinormalSigns[VertexInstanceID] = GetBasisDeterminantSign(
-							(FVector)VertexInstanceTangents[VertexInstanceID].GetSafeNormal(),
-							(FVector)TangentY.GetSafeNormal(),
-							(FVector)VertexInstanceNormals[VertexInstanceID].GetSafeNormal());
-					}
+				const FPolygonGroupID PolygonGroupID(SplitFaceMaterialIndices[FaceIndex]);
 
-					// Color
-					FLinearColor Color = FLinearColor::White;
-					if (bHasRGB)
-					{
-						Color.R = FMath::Clamp(
-							SplitColors[SplitIndex * AttribInfoColors.tupleSize + 0], 0.0f, 1.0f);
-						Color.G = FMath::Clamp(
-							SplitColors[SplitIndex * AttribInfoColors.tupleSize + 1], 0.0f, 1.0f);
-						Color.B = FMath::Clamp(
-							SplitColors[SplitIndex * AttribInfoColors.tupleSize + 2], 0.0f, 1.0f);
-					}
-					// Alpha
-					if (bHasAlpha)
-					{
-						Color.A = FMath::Clamp(SplitAlphas[SplitIndex], 0.0f, 1.0f);
-					}
-					else if (bHasRGBA)
-					{
-						Color.A = FMath::Clamp(SplitColors[SplitIndex * AttribInfoColors.tupleSize + 3], 0.0f, 1.0f);
-					}
+				// Insert a triangle into the mesh
+				MeshDescription->CreateTriangle(PolygonGroupID, MakeArrayView(FaceVertexInstanceIDs));
+			}
 
-					if (bIsGammaCorrectionDisabled)
+			// Second pass: fill the vertex instance attributes in parallel,
+			// each vertex instance only writes to its own attribute values.
+			ParallelForMeshChunks((int32)FaceCount, [&](int32 StartFaceIdx, int32 EndFaceIdx)
+			{
+				for (int32 FaceIndex = StartFaceIdx; FaceIndex < EndFaceIdx; FaceIndex++)
+				{
+					for (int32 Corner = 0; Corner < 3; Corner++)
 					{
-						// Mesh Description colors are always gamma corrected by Unreal. So we have to reverse the correction
-						// if this flag is enabled.
-						Color =  FLinearColor::FromSRGBColor(Color.ToFColor(false));
-					}
-					FVector4f VertexColor = FVector4f(Color);
-					VertexInstanceColors[VertexInstanceID] = VertexColor;
+						const FVertexInstanceID VertexInstanceID = SplitVertexInstanceIDs[FaceIndex * 3 + Corner];
+						if (VertexInstanceID == FVertexInstanceID::Invalid)
+							break;
+
+						// Fix the winding order by updating the SplitIndex (invert corner 1 and 2)
+						// instead of going 0 1 2 go 0 2 1
+						// TODO; this slows down StaticMesh->Build() considerably!
+						uint32 SplitIndex = (FaceIndex * 3) + Corner;
+						Corner == 1 ? SplitIndex++ : Corner == 2 ? SplitIndex-- : SplitIndex;
+
+						const uint32 SplitVertexIndex_X = SplitIndex * 3 + 0;
+						const uint32 SplitVertexIndex_Y = SplitIndex * 3 + 2;
+						const uint32 SplitVertexIndex_Z = SplitIndex * 3 + 1;
+						// Normals
+						FVector3f Normal = FVector3f::ZeroVector;
+						if (bHasNormal)
+						{
+							// We need to swap Z and Y coordinate here
+							Normal = FVector3f(SplitNormals[SplitVertexIndex_X], SplitNormals[SplitVertexIndex_Y], SplitNormals[SplitVertexIndex_Z]);
+							VertexInstanceNormals[VertexInstanceID] = Normal;
+						}
 
-					// UVs
-					for (int32 UVIndex = 0; UVIndex < SplitUVSets.Num(); UVIndex++)
-					{
-						if (HasUVSets[UVIndex])
+						// Tangents and binormals
+						if (bHasTangents)
 						{
-							// We need to flip V coordinate when it's coming from HAPI.
-							FVector2f CurrentUV;
-							CurrentUV.X = SplitUVSets[UVIndex][SplitIndex * 2 + 0];
-							CurrentUV.Y = 1.0f - SplitUVSets[UVIndex][SplitIndex * 2 + 1];
+							// We need to swap Z and Y coordinate here
+							const FVector3f TangentX(SplitTangentU[SplitVertexIndex_X], SplitTangentU[SplitVertexIndex_Y], SplitTangentU[SplitVertexIndex_Z]);
+							const FVector3f TangentY(SplitTangentV[SplitVertexIndex_X], SplitTangentV[SplitVertexIndex_Y], SplitTangentV[SplitVertexIndex_Z]);
+							VertexInstanceTangents[VertexInstanceID] = TangentX;
+
+							VertexInstanceBinormalSigns[VertexInstanceID] = GetBasisDeterminantSign(
+								(FVector)TangentX.GetSafeNormal(),
+								(FVector)TangentY.GetSafeNormal(),
+								(FVector)Normal.GetSafeNormal());
+						}
 
-							VertexInstanceUVs.Set(VertexInstanceID, UVIndex, CurrentUV);
+						// Color
+						FLinearColor Color = FLinearColor::White;
+						if (bHasRGB)
+						{
+							const float* SplitColor = SplitColors.GetData() + SplitIndex * ColorTupleSize;
+							Color.R = FMath::Clamp(SplitColor[0], 0.0f, 1.0f);
+							Color.G = FMath::Clamp(SplitColor[1], 0.0f, 1.0f);
+							Color.B = FMath::Clamp(SplitColor[2], 0.0f, 1.0f);
+						}
+						// Alpha
+						if (bHasAlpha)
+						{
+							Color.A = FMath::Clamp(SplitAlphas[SplitIndex], 0.0f, 1.0f);
+						}
+						else if (bHasRGBA)
+						{
+							Color.A = FMath::Clamp(SplitColors[SplitIndex * ColorTupleSize + 3], 0.0f, 1.0f);
 						}
-					}
 
-					FaceVertexInstanceIDs[Corner] = VertexInstanceID;
-				}
+						if (bIsGammaCorrectionDisabled)
+						{
+							// Mesh Description colors are always gamma corrected by Unreal. So we have to reverse the correction
+							// if this flag is enabled.
+							Color =  FLinearColor::FromSRGBColor(Color.ToFColor(false));
+						}
+						VertexInstanceColors[VertexInstanceID] = FVector4f(Color);
 
-				const FPolygonGroupID PolygonGroupID(SplitFaceMaterialIndices[FaceIndex]);
+						// UVs
+						for (int32 UVIndex = 0; UVIndex < SplitUVSets.Num(); UVIndex++)
+						{
+							if (HasUVSets[UVIndex])
+							{
+								// We need to flip V coordinate when it's coming from HAPI.
+								FVector2f CurrentUV;
+								CurrentUV.X = SplitUVSets[UVIndex][SplitIndex * 2 + 0];
+								CurrentUV.Y = 1.0f - SplitUVSets[UVIndex][SplitIndex * 2 + 1];
 
-				// Insert a triangle into the mesh
-				MeshDescription->CreateTriangle(PolygonGroupID, FaceVertexInstanceIDs);
-			}
+								VertexInstanceUVs.Set(VertexInstanceID, UVIndex, CurrentUV);
+							}
+						}
+					}
+				}
+			});
 
 			if (bDoTiming)
 			{
@@ -3774,25 +3825,9 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			{
 				TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Vertex Positions);
 
-				bool bHasInvalidPositionIndexData = false;
-				for (int32 VertexPositionIdx = 0; VertexPositionIdx < NumVertexPositions; ++VertexPositionIdx)
-				//ParallelFor(NumVertexPositions, [&](uint32 VertexPositionIdx)
-				{
-					int32 NeededVertexIndex = NeededVertices[VertexPositionIdx];
-					if (!PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
-					{
-						// Error retrieving positions.
-						bHasInvalidPositionIndexData = true;
-						continue;
-					}
-
-					// We need to swap Z and Y coordinate here, and convert from m to cm. 
-					FoundStaticMesh->SetVertexPosition(VertexPositionIdx, FVector3f(
-						PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-						PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-						PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION
-					));
-				}//);
+				// Gather the needed points, swapping Y/Z and converting from m to cm
+				const bool bHasInvalidPositionIndexData = !FoundStaticMesh->SetVertexPositionsFromHoudini(
+					PartPositions, NeededVertices, HAPI_UNREAL_SCALE_FACTOR_POSITION);
 
 				if (bHasInvalidPositionIndexData)
 				{
@@ -3811,130 +3846,91 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			{
 				TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Triangle Indices & Per Vertex Instance Attribute Values);
 
-				// Now add the triangles to the mesh
-				for (int32 TriangleIdx = 0; TriangleIdx < NumTriangles; ++TriangleIdx)
-				// ParallelFor(NumTriangles, [&](uint32 TriangleIdx)
+				// Validate the attribute arrays once: the split attributes are indexed per triangle,
+				// so we only need to know how many triangles each array can provide values for.
+				const int32 ColorTupleSize = AttribInfoColors.tupleSize;
+				const int32 NumTrianglesWithNormals = NormalCount > 0 ? FMath::Min(NumTriangles, SplitNormals.Num() / 9) : 0;
+				const int32 NumTrianglesWithTangents = bReadTangents
+					? FMath::Min(NumTriangles, FMath::Min(SplitTangentU.Num(), SplitTangentV.Num()) / 9)
+					: 0;
+				const int32 NumTrianglesWithColors = bSplitColorValid ? FMath::Min(NumTriangles, SplitColors.Num() / (3 * ColorTupleSize)) : 0;
+				const int32 NumTrianglesWithAlphas = bSplitAlphaValid ? FMath::Min(NumTriangles, SplitAlphas.Num() / 3) : 0;
+				TArray<int32, TInlineAllocator<MAX_STATIC_TEXCOORDS>> NumTrianglesWithUVs;
+				NumTrianglesWithUVs.SetNumZeroed(NumUVLayers);
+				for (int32 TexCoordIdx = 0; TexCoordIdx < NumUVLayers; ++TexCoordIdx)
+					NumTrianglesWithUVs[TexCoordIdx] = FMath::Min(NumTriangles, SplitUVSets[TexCoordIdx].Num() / 6);
+
+				// Now add the triangles to the mesh, the indices have already been flipped to fix the winding order
+				FoundStaticMesh->SetTriangleIndices(TriangleIndices);
+
+				// Normals and tangents (either getting tangents from attributes or generating tangents from the
+				// normals). The bulk setters swap Y/Z and fix the winding order.
+				FoundStaticMesh->SetVertexInstanceNormalsFromHoudini(SplitNormals, NumTrianglesWithNormals);
+				if (bGenerateTangentsFromNormalAttribute)
 				{
-					// TODO: add some additional intermediate consts for index calculations to make the indexing
-					// TODO: code a bit more readable
-					const int32 TriVertIdx0 = TriangleIdx * 3;
-					FoundStaticMesh->SetTriangleVertexIndices(TriangleIdx, FIntVector(
-						TriangleIndices[TriVertIdx0 + 0],
-						TriangleIndices[TriVertIdx0 + 1],
-						TriangleIndices[TriVertIdx0 + 2]
-					));
+					if (NumTrianglesWithNormals > 0)
+						FoundStaticMesh->CalculateTangents();
+				}
+				else if (NumTrianglesWithTangents > 0)
+				{
+					// Transfer the tangents from Houdini
+					FoundStaticMesh->SetVertexInstanceUTangentsFromHoudini(SplitTangentU, NumTrianglesWithTangents);
+					FoundStaticMesh->SetVertexInstanceVTangentsFromHoudini(SplitTangentV, NumTrianglesWithTangents);
+				}
+
+				// Vertex Colors
+				if (NumTrianglesWithColors > 0)
+				{
+					TArray<FColor> VertexInstanceColors;
+					VertexInstanceColors.Init(FColor(127, 127, 127), NumTriangles * 3);
 
 					const int32 TriWindingIndex[3] = { 0, 2, 1 };
-					// Normals and tangents (either getting tangents from attributes or generating tangents from the
-					// normals
-					if (NormalCount > 0 || bReadTangents)
+					ParallelForMeshChunks(NumTrianglesWithColors, [&](int32 StartIdx, int32 EndIdx)
 					{
-						for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
+						for (int32 TriangleIdx = StartIdx; TriangleIdx < EndIdx; ++TriangleIdx)
 						{
-							const bool bHasNormal = (NormalCount > 0 && SplitNormals.IsValidIndex(TriVertIdx0 * 3 + 3 * 3 - 1));
-							FVector3f Normal = FVector3f::ZeroVector;
-							if (bHasNormal)
+							const int32 TriVertIdx0 = TriangleIdx * 3;
+							FLinearColor VertexLinearColor;
+							for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
 							{
-								// Flip Z and Y coordinate for normal, but don't scale
-								Normal.Set(
-									SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 0],
-									SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 2],
-									SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 1]
-								);
-
-								FoundStaticMesh->SetTriangleVertexNormal(TriangleIdx, TriWindingIndex[ElementIdx], Normal);
-							}
+								const float* Color = SplitColors.GetData() + TriVertIdx0 * ColorTupleSize + ColorTupleSize * ElementIdx;
+								VertexLinearColor.R = FMath::Clamp(Color[0], 0.0f, 1.0f);
+								VertexLinearColor.G = FMath::Clamp(Color[1], 0.0f, 1.0f);
+								VertexLinearColor.B = FMath::Clamp(Color[2], 0.0f, 1.0f);
 
-							if (bReadTangents || bGenerateTangentsFromNormalAttribute)
-							{
-								FVector3f TangentU, TangentV;
-								if (bGenerateTangentsFromNormalAttribute)
+								if (TriangleIdx < NumTrianglesWithAlphas)
+								{
+									VertexLinearColor.A = FMath::Clamp(SplitAlphas[TriVertIdx0 + ElementIdx], 0.0f, 1.0f);
+								}
+								else if (ColorTupleSize >= 4)
 								{
-									if (bHasNormal)
-									{
-										// Generate the tangents if needed
-										Normal.FindBestAxisVectors(TangentU, TangentV);
-
-										FoundStaticMesh->SetTriangleVertexUTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentU);
-										FoundStaticMesh->SetTriangleVertexVTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentV);
-									}
+									VertexLinearColor.A = FMath::Clamp(Color[3], 0.0f, 1.0f);
 								}
 								else
 								{
-									// Transfer the tangents from Houdini
-									TangentU.X = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 0];
-									TangentU.Y = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
-									TangentU.Z = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
-
-									TangentU.X = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 0];
-									TangentU.Y = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
-									TangentU.Z = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
-
-									FoundStaticMesh->SetTriangleVertexUTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentU);
-									FoundStaticMesh->SetTriangleVertexVTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentV);
+									VertexLinearColor.A = 1.0f;
 								}
-							}
-						}
-					}
 
-					// Vertex Colors
-					if (bSplitColorValid && SplitColors.IsValidIndex(TriVertIdx0 * AttribInfoColors.tupleSize + 3 * AttribInfoColors.tupleSize - 1))
-					{
-						FLinearColor VertexLinearColor;
-						for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
-						{
-							VertexLinearColor.R = FMath::Clamp(
-								SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 0], 0.0f, 1.0f);
-							VertexLinearColor.G = FMath::Clamp(
-								SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 1], 0.0f, 1.0f);
-							VertexLinearColor.B = FMath::Clamp(
-								SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 2], 0.0f, 1.0f);
-
-							if (bSplitAlphaValid)
-							{
-								VertexLinearColor.A = FMath::Clamp(SplitAlphas[TriVertIdx0 + ElementIdx], 0.0f, 1.0f);
-							}
-							else if (AttribInfoColors.tupleSize >= 4)
-							{
-								VertexLinearColor.A = FMath::Clamp(
-									SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 3], 0.0f, 1.0f);
-							}
-							else
-							{
-								VertexLinearColor.A = 1.0f;
-							}
+								FColor VertexColor = VertexLinearColor.ToFColor(false);
 
-							FColor VertexColor = VertexLinearColor.ToFColor(false);
+								// If Gamma correction is disabled, de-convert the color. Since SetVertexInstanceColors() will apply gamma.
+								if (bIsGammaCorrectionDisabled)
+									VertexColor = FLinearColor::FromSRGBColor(VertexColor).ToFColor(false);
 
-							// If Gamma correction is disabled, de-convert the color. Since SetTriangleVertexColor() will apply gamma.
-							if (bIsGammaCorrectionDisabled)
-								VertexColor = FLinearColor::FromSRGBColor(VertexColor).ToFColor(false);
-
-							FoundStaticMesh->SetTriangleVertexColor(TriangleIdx, TriWindingIndex[ElementIdx], VertexColor);
-						}
-					}
-
-					// UVs
-					if (NumUVLayers > 0)
-					{
-						// Dynamic mesh supports only 1 UV layer on the mesh it self. So we set the first layer
-						// on the mesh itself only, and we set all layers on the AttributeSet
-						for (int32 TexCoordIdx = 0; TexCoordIdx < NumUVLayers; ++TexCoordIdx)
-						{
-							const TArray<float>& SplitUVs = SplitUVSets[TexCoordIdx];
-							if (SplitUVs.IsValidIndex(TriVertIdx0 * 2 + 3 * 2 - 1))
-							{
-								for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
-								{
-									const int32 UVIdx = TriVertIdx0 * 2 + ElementIdx * 2;
-									// We need to flip V coordinate when it's coming from HAPI.
-									const FVector2f UV(SplitUVs[UVIdx + 0], 1.0f - SplitUVs[UVIdx + 1]);
-									// Set the UV on the vertex instance in the UVLayer
-									FoundStaticMesh->SetTriangleVertexUV(TriangleIdx, TriWindingIndex[ElementIdx], TexCoordIdx, UV);
-								}
+								VertexInstanceColors[TriVertIdx0 + TriWindingIndex[ElementIdx]] = VertexColor;
 							}
 						}
-					}
+					});
+
+					// The grey defaults of the triangles without colors must not be gamma converted
+					FoundStaticMesh->SetVertexInstanceColors(MoveTemp(VertexInstanceColors), NumTrianglesWithColors * 3);
+				}
+
+				// UVs
+				for (int32 TexCoordIdx = 0; TexCoordIdx < NumUVLayers; ++TexCoordIdx)
+				{
+					// The bulk setter flips the V coordinate and fixes the winding order
+					FoundStaticMesh->SetVertexInstanceUVsFromHoudini(TexCoordIdx, SplitUVSets[TexCoordIdx], NumTrianglesWithUVs[TexCoordIdx]);
 				}
 			}
 
@@ -8144,25 +8140,9 @@ void FHoudiniMeshTranslator::BuildHoudiniMesh(const FString& SplitGroupName, UHo
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Vertex Positions);
 
-		bool bHasInvalidPositionIndexData = false;
-		for (int32 VertexPositionIdx = 0; VertexPositionIdx < NumVertexPositions; ++VertexPositionIdx)
-			//ParallelFor(NumVertexPositions, [&](uint32 VertexPositionIdx)
-		{
-			int32 NeededVertexIndex = NeededVertices[VertexPositionIdx];
-			if (!PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
-			{
-				// Error retrieving positions.
-				bHasInvalidPositionIndexData = true;
-				continue;
-			}
-
-			// We need to swap Z and Y coordinate here, and convert from m to cm. 
-			FoundStaticMesh->SetVertexPosition(VertexPositionIdx, FVector3f(
-				PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-				PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
-				PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION
-			));
-		}//);
+		// Gather the needed points, swapping Y/Z and converting from m to cm
+		const bool bHasInvalidPositionIndexData = !FoundStaticMesh->SetVertexPositionsFromHoudini(
+			PartPositions, NeededVertices, HAPI_UNREAL_SCALE_FACTOR_POSITION);
 
 		if (bHasInvalidPositionIndexData)
 		{
@@ -8181,124 +8161,85 @@ void FHoudiniMeshTranslator::BuildHoudiniMesh(const FString& SplitGroupName, UHo
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Triangle Indices & Per Vertex Instance Attribute Values);
 
-		// Now add the triangles to the mesh
-		for (int32 TriangleIdx = 0; TriangleIdx < NumTriangles; ++TriangleIdx)
-			// ParallelFor(NumTriangles, [&](uint32 TriangleIdx)
+		// Validate the attribute arrays once: the split attributes are indexed per triangle,
+		// so we only need to know how many triangles each array can provide values for.
+		const int32 ColorTupleSize = AttribInfoColors.tupleSize;
+		const int32 NumTrianglesWithNormals = NormalCount > 0 ? FMath::Min(NumTriangles, SplitNormals.Num() / 9) : 0;
+		const int32 NumTrianglesWithTangents = bReadTangents
+			? FMath::Min(NumTriangles, FMath::Min(SplitTangentU.Num(), SplitTangentV.Num()) / 9)
+			: 0;
+		const int32 NumTrianglesWithColors = bSplitColorValid ? FMath::Min(NumTriangles, SplitColors.Num() / (3 * ColorTupleSize)) : 0;
+		const int32 NumTrianglesWithAlphas = bSplitAlphaValid ? FMath::Min(NumTriangles, SplitAlphas.Num() / 3) : 0;
+		TArray<int32, TInlineAllocator<MAX_STATIC_TEXCOORDS>> NumTrianglesWithUVs;
+		NumTrianglesWithUVs.SetNumZeroed(NumUVLayers);
+		for (int32 TexCoordIdx = 0; TexCoordIdx < NumUVLayers; ++TexCoordIdx)
+			NumTrianglesWithUVs[TexCoordIdx] = FMath::Min(NumTriangles, SplitUVSets[TexCoordIdx].Num() / 6);
+
+		// Now add the triangles to the mesh, the indices have already been flipped to fix the winding order
+		FoundStaticMesh->SetTriangleIndices(TriangleIndices);
+
+		// Normals and tangents (either getting tangents from attributes or generating tangents from the
+		// normals). The bulk setters swap Y/Z and fix the winding order.
+		FoundStaticMesh->SetVertexInstanceNormalsFromHoudini(SplitNormals, NumTrianglesWithNormals);
+		if (bGenerateTangentsFromNormalAttribute)
+		{
+			if (NumTrianglesWithNormals > 0)
+				FoundStaticMesh->CalculateTangents();
+		}
+		else if (NumTrianglesWithTangents > 0)
+		{
+			// Transfer the tangents from Houdini
+			FoundStaticMesh->SetVertexInstanceUTangentsFromHoudini(SplitTangentU, NumTrianglesWithTangents);
+			FoundStaticMesh->SetVertexInstanceVTangentsFromHoudini(SplitTangentV, NumTrianglesWithTangents);
+		}
+
+		// Vertex Colors
+		if (NumTrianglesWithColors > 0)
 		{
-			// TODO: add some additional intermediate consts for index calculations to make the indexing
-			// TODO: code a bit more readable
-			const int32 TriVertIdx0 = TriangleIdx * 3;
-			FoundStaticMesh->SetTriangleVertexIndices(TriangleIdx, FIntVector(
-				TriangleIndices[TriVertIdx0 + 0],
-				TriangleIndices[TriVertIdx0 + 1],
-				TriangleIndices[TriVertIdx0 + 2]
-			));
+			TArray<FColor> VertexInstanceColors;
+			VertexInstanceColors.Init(FColor(127, 127, 127), NumTriangles * 3);
 
 			const int32 TriWindingIndex[3] = { 0, 2, 1 };
-			// Normals and tangents (either getting tangents from attributes or generating tangents from the
-			// normals
-			if (NormalCount > 0 || bReadTangents)
+			ParallelForMeshChunks(NumTrianglesWithColors, [&](int32 StartIdx, int32 EndIdx)
 			{
-				for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
+				for (int32 TriangleIdx = StartIdx; TriangleIdx < EndIdx; ++TriangleIdx)
 				{
-					const bool bHasNormal = (NormalCount > 0 && SplitNormals.IsValidIndex(TriVertIdx0 * 3 + 3 * 3 - 1));
-					FVector3f Normal = FVector3f::ZeroVector;
-					if (bHasNormal)
+					const int32 TriVertIdx0 = TriangleIdx * 3;
+					FLinearColor VertexLinearColor;
+					for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
 					{
-						// Flip Z and Y coordinate for normal, but don't scale
-						Normal.Set(
-							SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 0],
-							SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 2],
-							SplitNormals[TriVertIdx0 * 3 + 3 * ElementIdx + 1]
-						);
-
-						FoundStaticMesh->SetTriangleVertexNormal(TriangleIdx, TriWindingIndex[ElementIdx], Normal);
-					}
+						const float* Color = SplitColors.GetData() + TriVertIdx0 * ColorTupleSize + ColorTupleSize * ElementIdx;
+						VertexLinearColor.R = FMath::Clamp(Color[0], 0.0f, 1.0f);
+						VertexLinearColor.G = FMath::Clamp(Color[1], 0.0f, 1.0f);
+						VertexLinearColor.B = FMath::Clamp(Color[2], 0.0f, 1.0f);
 
-					if (bReadTangents || bGenerateTangentsFromNormalAttribute)
-					{
-						FVector3f TangentU, TangentV;
-						if (bGenerateTangentsFromNormalAttribute)
+						if (TriangleIdx < NumTrianglesWithAlphas)
 						{
-							if (bHasNormal)
-							{
-								// Generate the tangents if needed
-								Normal.FindBestAxisVectors(TangentU, TangentV);
-
-								FoundStaticMesh->SetTriangleVertexUTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentU);
-								FoundStaticMesh->SetTriangleVertexVTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentV);
-							}
+							VertexLinearColor.A = FMath::Clamp(SplitAlphas[TriVertIdx0 + ElementIdx], 0.0f, 1.0f);
+						}
+						else if (ColorTupleSize >= 4)
+						{
+							VertexLinearColor.A = FMath::Clamp(Color[3], 0.0f, 1.0f);
 						}
 						else
 						{
-							// Transfer the tangents from Houdini
-							TangentU.X = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 0];
-							TangentU.Y = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
-							TangentU.Z = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
-
-							TangentU.X = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 0];
-							TangentU.Y = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
-							TangentU.Z = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
-
-							FoundStaticMesh->SetTriangleVertexUTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentU);
-							FoundStaticMesh->SetTriangleVertexVTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentV);
+							VertexLinearColor.A = 1.0f;
 						}
-					}
-				}
-			}
 
-			// Vertex Colors
-			if (bSplitColorValid && SplitColors.IsValidIndex(TriVertIdx0 * AttribInfoColors.tupleSize + 3 * AttribInfoColors.tupleSize - 1))
-			{
-				FLinearColor VertexLinearColor;
-				for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
-				{
-					VertexLinearColor.R = FMath::Clamp(
-						SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 0], 0.0f, 1.0f);
-					VertexLinearColor.G = FMath::Clamp(
-						SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 1], 0.0f, 1.0f);
-					VertexLinearColor.B = FMath::Clamp(
-						SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 2], 0.0f, 1.0f);
-
-					if (bSplitAlphaValid)
-					{
-						VertexLinearColor.A = FMath::Clamp(SplitAlphas[TriVertIdx0 + ElementIdx], 0.0f, 1.0f);
+						VertexInstanceColors[TriVertIdx0 + TriWindingIndex[ElementIdx]] = VertexLinearColor.ToFColor(false);
 					}
-					else if (AttribInfoColors.tupleSize >= 4)
-					{
-						VertexLinearColor.A = FMath::Clamp(
-							SplitColors[TriVertIdx0 * AttribInfoColors.tupleSize + AttribInfoColors.tupleSize * ElementIdx + 3], 0.0f, 1.0f);
-					}
-					else
-					{
-						VertexLinearColor.A = 1.0f;
-					}
-					const FColor VertexColor = VertexLinearColor.ToFColor(false);
-					FoundStaticMesh->SetTriangleVertexColor(TriangleIdx, TriWindingIndex[ElementIdx], VertexColor);
 				}
-			}
+			});
 
-			// UVs
-			if (NumUVLayers > 0)
-			{
-				// Dynamic mesh supports only 1 UV layer on the mesh it self. So we set the first layer
-				// on the mesh itself only, and we set all layers on the AttributeSet
-				for (int32 TexCoordIdx = 0; TexCoordIdx < NumUVLayers; ++TexCoordIdx)
-				{
-					const TArray<float>& SplitUVs = SplitUVSets[TexCoordIdx];
-					if (SplitUVs.IsValidIndex(TriVertIdx0 * 2 + 3 * 2 - 1))
-					{
-						for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
-						{
-							const int32 UVIdx = TriVertIdx0 * 2 + ElementIdx * 2;
-							// We need to flip V coordinate when it's coming from HAPI.
-							const FVector2f UV(SplitUVs[UVIdx + 0], 1.0f - SplitUVs[UVIdx + 1]);
-							// Set the UV on the vertex instance in the UVLayer
-							FoundStaticMesh->SetTriangleVertexUV(TriangleIdx, TriWindingIndex[ElementIdx], TexCoordIdx, UV);
-						}
-					}
-				}
-			}
+			// The grey defaults of the triangles without colors must not be gamma converted
+			FoundStaticMesh->SetVertexInstanceColors(MoveTemp(VertexInstanceColors), NumTrianglesWithColors * 3);
+		}
+
+		// UVs
+		for (int32 TexCoordIdx = 0; TexCoordIdx < NumUVLayers; ++TexCoordIdx)
+		{
+			// The bulk setter flips the V coordinate and fixes the winding order
+			FoundStaticMesh->SetVertexInstanceUVsFromHoudini(TexCoordIdx, SplitUVSets[TexCoordIdx], NumTrianglesWithUVs[TexCoordIdx]);
 		}
 	}
 
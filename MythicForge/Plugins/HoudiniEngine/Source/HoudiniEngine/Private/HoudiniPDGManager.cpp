@@ -48,8 +48,20 @@
 
 #include "HAPI/HAPI_Common.h"
 
+#include "HAL/IConsoleManager.h"
+#include "Engine/Engine.h"
+
 HOUDINI_PDG_DEFINE_LOG_CATEGORY();
 
+static TAutoConsoleVariable<float> CVarHoudiniEnginePDGResultsTimeBudget(
+	TEXT("HoudiniEngine.PDGResultsTimeBudget"),
+	0.01,
+	TEXT("Time (in s) that the PDG manager can spend loading/deleting work result objects per tick.\n")
+	TEXT("At least one work result is processed per tick.\n")
+	TEXT("<= 0.0: No Limit\n")
+	TEXT("0.01: Default\n")
+);
+
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
 FHoudiniPDGManager::FHoudiniPDGManager()
@@ -58,6 +70,10 @@ FHoudiniPDGManager::FHoudiniPDGManager()
 
 FHoudiniPDGManager::~FHoudiniPDGManager()
 {
+#if WITH_EDITOR
+	if (GEngine && LevelActorDeletedHandle.IsValid())
+		GEngine->OnLevelActorDeleted().Remove(LevelActorDeletedHandle);
+#endif
 }
 
 bool
@@ -131,6 +147,9 @@ FHoudiniPDGManager::InitializePDGAssetLink(UHoudiniAssetComponent* InHAC)
 		// Register this PDG Asset Link to the PDG Manager
 		TWeakObjectPtr<UHoudiniPDGAssetLink> AssetLinkPtr(PDGAssetLink);
 		PDGAssetLinks.Add(AssetLinkPtr);
+
+		// Work results loaded with the asset link are only processed once
+		PDGAssetLink->MarkAllTOPNodeWorkResultsDirty();
 	}
 
 	// If the commandlet is enabled, check if we have started and established communication with the commandlet yet
@@ -379,6 +398,9 @@ FHoudiniPDGManager::PopulateTOPNetworks(UHoudiniPDGAssetLink* PDGAssetLink, bool
 	//PDGAssetLink->ClearAllTOPData();
 	PDGAssetLink->AllTOPNetworks = AllTOPNetworks;
 
+	// Rescan the work results of the (re)populated nodes
+	PDGAssetLink->MarkAllTOPNodeWorkResultsDirty();
+
 	return (AllTOPNetworks.Num() > 0);
 }
 
@@ -532,6 +554,7 @@ FHoudiniPDGManager::CookTOPNode(UTOPNode* InTOPNode)
 		return false;
 	}
 
+	FHoudiniEngineString::InvalidateStringCache();
 	if (HAPI_RESULT_SUCCESS != FHoudiniApi::CookPDG(
 		FHoudiniEngine::Get().GetSession(), InTOPNode->NodeId, 0, 0))
 	{
@@ -607,6 +630,7 @@ FHoudiniPDGManager::CookOutput(UTOPNetwork* InTOPNet)
 
 	// TODO: ???
 	// Cancel all cooks. This is required as otherwise the graph gets into an infinite cook state (bug?)
+	FHoudiniEngineString::InvalidateStringCache();
 	if(HAPI_RESULT_SUCCESS != FHoudiniApi::CookPDGAllOutputs(
 		FHoudiniEngine::Get().GetSession(), InTOPNet->NodeId, 0, 0))
 	{
@@ -702,6 +726,11 @@ FHoudiniPDGManager::Update()
 	if (PDGAssetLinks.Num() <= 0)
 		return;
 
+#if WITH_EDITOR
+	if (!LevelActorDeletedHandle.IsValid() && GEngine)
+		LevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FHoudiniPDGManager::OnLevelActorDeleted);
+#endif
+
 	// Update the PDG contexts and handle all pdg events and work item status updates
 	UpdatePDGContexts();
 
@@ -883,6 +912,8 @@ FHoudiniPDGManager::ProcessPDGEvent(const HAPI_PDG_GraphContextId& InContextID,
 			break;
 
 		case HAPI_PDG_EVENT_COOK_COMPLETE:
+			// Strings resolved while the graph was cooking can use stale handles
+			FHoudiniEngineString::InvalidateStringCache();
 			SetTOPNodePDGState(PDGAssetLink, TOPNode, EPDGNodeState::Cook_Complete);
 			TOPNode->HandleOnPDGEventCookComplete();
 			TOPNetwork->HandleOnPDGEventCookCompleteReceivedByChildNode(PDGAssetLink, TOPNode);
@@ -957,6 +988,8 @@ FHoudiniPDGManager::ProcessPDGEvent(const HAPI_PDG_GraphContextId& InContextID,
 			else if (CurrentWorkItemState == HAPI_PDG_WorkItemState::HAPI_PDG_WORKITEM_COOKED_SUCCESS 
 				|| CurrentWorkItemState == HAPI_PDG_WorkItemState::HAPI_PDG_WORKITEM_COOKED_CACHE)
 			{
+				// The work item's cook can have reused string handles
+				FHoudiniEngineString::InvalidateStringCache();
 				NotifyTOPNodeCookedWorkItem(PDGAssetLink, TOPNode, EventInfo.workItemId);
 
 				// On cook success, handle results
@@ -1260,6 +1293,8 @@ FHoudiniPDGManager::ClearWorkItemResult(UHoudiniPDGAssetLink* InAssetLink, const
 	//session.LogErrorOverride = false;
 	InAssetLink->ClearWorkItemResultByID(InWorkItemID, InTOPNode);
 	// session.LogErrorOverride = true;
+
+	TOPNodesToRefresh.Add(InTOPNode);
 }
 
 void
@@ -1271,6 +1306,8 @@ FHoudiniPDGManager::RemoveWorkItem(UHoudiniPDGAssetLink* InAssetLink, const HAPI
 	// Clear all of the work item's results for the specified TOP node and also remove the work item itself from
 	// the TOP node.
 	InAssetLink->DestroyWorkItemByID(InWorkItemID, InTOPNode);
+
+	TOPNodesToRefresh.Add(InTOPNode);
 }
 
 void
@@ -1527,6 +1564,9 @@ FHoudiniPDGManager::CreateOrRelinkWorkItemResult(
 	}
 	WorkResult->ResultObjects = NewResultObjects;
 
+	// Let ProcessWorkItemResults load/delete the result objects
+	QueueWorkResult(InTOPNode, WorkResultArrayIndex);
+
 	return true;
 }
 
@@ -1604,6 +1644,7 @@ FHoudiniPDGManager::SyncAndPruneWorkItems(UTOPNode* InTOPNode)
 		// Ensure that the outer level (or actor in the case of OFPA) is marked as dirty so that references to the
 		// output actors / objects are saved
 		InTOPNode->MarkPackageDirty();
+		TOPNodesToRefresh.Add(InTOPNode);
 	}
 	
 	return NumRemoved;
@@ -1614,188 +1655,374 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniPDGManager::ProcessWorkItemResults);
 
-	const EHoudiniBGEOCommandletStatus CommandletStatus = UpdateAndGetBGEOCommandletStatus();
+	// Deleted actors could be output actors of loaded work result objects
+	if (bActorsDeleted)
+	{
+		bActorsDeleted = false;
+		for (auto& CurrentPDGAssetLink : PDGAssetLinks)
+		{
+			UHoudiniPDGAssetLink* AssetLink = CurrentPDGAssetLink.Get();
+			if (!AssetLink)
+				continue;
+
+			for (UTOPNetwork* CurrentTOPNet : AssetLink->AllTOPNetworks)
+			{
+				if (!IsValid(CurrentTOPNet))
+					continue;
+
+				for (UTOPNode* CurrentTOPNode : CurrentTOPNet->AllTOPNodes)
+				{
+					if (IsValid(CurrentTOPNode) && CurrentTOPNode->bCachedHaveLoadedWorkResults)
+						TOPNodesToRefresh.Add(CurrentTOPNode);
+				}
+			}
+		}
+	}
+
+	// Go through the nodes whose work results were changed in bulk (load/unload all, newly registered asset link...)
+	TArray<TWeakObjectPtr<UTOPNode>> DirtyTOPNodes;
 	for (auto& CurrentPDGAssetLink : PDGAssetLinks)
 	{
-		// Iterate through all PDG Asset Link
 		UHoudiniPDGAssetLink* AssetLink = CurrentPDGAssetLink.Get();
 		if (!AssetLink)
 			continue;
 
-		// Set up package parameters to:
-		// Cook to temp houdini engine directory
-		// and if the PDG asset link is associated with a Houdini Asset Component (HAC):
-		//		set the outer package to the HAC
-		//		set the HoudiniAssetName according to the HAC
-		//		set the ComponentGUID according to the HAC
-		// otherwise we set the outer to the asset link's parent and leave naming and GUID blank
-		FHoudiniPackageParams PackageParams;
-		PackageParams.PackageMode = FHoudiniPackageParams::GetDefaultStaticMeshesCookMode();
-		PackageParams.ReplaceMode = FHoudiniPackageParams::GetDefaultReplaceMode();
+		AssetLink->ConsumeDirtyTOPNodes(DirtyTOPNodes);
+		for (const TWeakObjectPtr<UTOPNode>& DirtyTOPNode : DirtyTOPNodes)
+		{
+			ScanTOPNodeWorkResults(DirtyTOPNode.Get());
+			TOPNodesToRefresh.Remove(DirtyTOPNode);
+		}
+	}
 
-		PackageParams.BakeFolder = FHoudiniEngineRuntime::Get().GetDefaultBakeFolder();
-		PackageParams.TempCookFolder = FHoudiniEngineRuntime::Get().GetDefaultTemporaryCookFolder();
+	// Process the queued work results until the time budget is spent
+	const double TimeBudget = CVarHoudiniEnginePDGResultsTimeBudget.GetValueOnAnyThread();
+	const double StartTime = FPlatformTime::Seconds();
+	const EHoudiniBGEOCommandletStatus CommandletStatus = UpdateAndGetBGEOCommandletStatus();
 
-		// AActor* ParentActor = nullptr;
-		UObject* AssetLinkParent = AssetLink->GetOuter();
-		UHoudiniAssetComponent* HAC = AssetLinkParent != nullptr ? Cast<UHoudiniAssetComponent>(AssetLinkParent) : nullptr;
-		if (HAC)
+	TMap<UHoudiniPDGAssetLink*, FHoudiniPackageParams> PackageParamsPerAssetLink;
+	int32 NumProcessed = 0;
+	while (WorkResultQueueHead < WorkResultQueue.Num())
+	{
+		if (NumProcessed > 0 && TimeBudget > 0.0 && (FPlatformTime::Seconds() - StartTime) >= TimeBudget)
+			break;
+
+		const FQueuedWorkResult QueuedWorkResult = WorkResultQueue[WorkResultQueueHead++];
+		if (QueuedWorkResult.WorkItemID != INDEX_NONE)
+			QueuedWorkResults.Remove(TPair<TWeakObjectPtr<UTOPNode>, int32>(QueuedWorkResult.TOPNode, QueuedWorkResult.WorkItemID));
+		NumProcessed++;
+
+		UTOPNode* CurrentTOPNode = QueuedWorkResult.TOPNode.Get();
+		if (!IsValid(CurrentTOPNode))
+			continue;
+
+		// Work results could have been removed from the node since this one was queued
+		int32 WorkResultArrayIndex = QueuedWorkResult.WorkResultArrayIndex;
+		if (!CurrentTOPNode->WorkResult.IsValidIndex(WorkResultArrayIndex)
+			|| CurrentTOPNode->WorkResult[WorkResultArrayIndex].WorkItemID != QueuedWorkResult.WorkItemID)
 		{
-			PackageParams.OuterPackage = HAC->GetComponentLevel();
-			PackageParams.HoudiniAssetName = HAC->GetHoudiniAssetName();
-			PackageParams.HoudiniAssetActorName = HAC->GetOwner()->GetActorNameOrLabel();
-			PackageParams.ComponentGUID = HAC->GetComponentGUID();
+			if (QueuedWorkResult.WorkItemID == INDEX_NONE)
+				continue;
 
-			// ParentActor = HAC->GetOwner();
+			WorkResultArrayIndex = CurrentTOPNode->ArrayIndexOfWorkResultByID(QueuedWorkResult.WorkItemID);
+			if (WorkResultArrayIndex == INDEX_NONE)
+				continue;
 		}
-		else
-		{
-			PackageParams.OuterPackage = AssetLinkParent ? AssetLinkParent->GetOutermost() : nullptr;
-			PackageParams.HoudiniAssetName = FString();
-			PackageParams.HoudiniAssetActorName = FString();
-			// PackageParams.ComponentGUID = HAC->GetComponentGUID();
 
-			// // Try to find a parent actor
-			// UObject* Parent = AssetLinkParent;
-			// while (Parent && !ParentActor)
-			// {
-			// 	ParentActor = Cast<AActor>(Parent);
-			// 	if (!ParentActor)
-			// 		Parent = ParentActor->GetOuter();
-			// }
+		UHoudiniPDGAssetLink* AssetLink = CurrentTOPNode->GetOuterAssetLink();
+		UTOPNetwork* CurrentTOPNet = IsValid(AssetLink) ? AssetLink->GetTOPNetworkForNode(CurrentTOPNode) : nullptr;
+		if (!IsValid(CurrentTOPNet))
+			continue;
+
+		FHoudiniPackageParams* PackageParams = PackageParamsPerAssetLink.Find(AssetLink);
+		if (!PackageParams)
+		{
+			PackageParams = &PackageParamsPerAssetLink.Add(AssetLink);
+			GetWorkResultPackageParams(AssetLink, *PackageParams);
 		}
-		PackageParams.ObjectName = FString();
 
-		// Static mesh generation / build settings, get it from the HAC if available, otherwise from the plugin
-		// defaults
-		const FHoudiniStaticMeshGenerationProperties& StaticMeshGenerationProperties = HAC ? HAC->StaticMeshGenerationProperties : FHoudiniEngineRuntimeUtils::GetDefaultStaticMeshGenerationProperties();
-		const FMeshBuildSettings& MeshBuildSettings = HAC ? HAC->StaticMeshBuildSettings : FHoudiniEngineRuntimeUtils::GetDefaultMeshBuildSettings();
+		ProcessWorkResult(AssetLink, CurrentTOPNet, CurrentTOPNode, WorkResultArrayIndex, *PackageParams, CommandletStatus);
+	}
+
+	if (WorkResultQueueHead >= WorkResultQueue.Num())
+	{
+		WorkResultQueue.Reset();
+		WorkResultQueueHead = 0;
+
+		// Loading/deleting result objects can clear the nodes' cached flags,
+		// update them now that all the queued work has been done
+		TArray<TWeakObjectPtr<UTOPNode>> NodesToRefresh = TOPNodesToRefresh.Array();
+		TOPNodesToRefresh.Reset();
+		for (const TWeakObjectPtr<UTOPNode>& NodeToRefresh : NodesToRefresh)
+			ScanTOPNodeWorkResults(NodeToRefresh.Get());
+	}
+	else if (WorkResultQueueHead > 1024 && WorkResultQueueHead > WorkResultQueue.Num() / 2)
+	{
+		// Drop the processed entries
+		WorkResultQueue.RemoveAt(0, WorkResultQueueHead);
+		WorkResultQueueHead = 0;
+	}
+
+	if (NumProcessed > 0)
+	{
+		HOUDINI_PDG_MESSAGE(TEXT("PDG: Tick processed %d work results, %d remaining."), NumProcessed, WorkResultQueue.Num() - WorkResultQueueHead);
+	}
+}
 
-		// .. All TOP Nets
-		for (UTOPNetwork* CurrentTOPNet : AssetLink->AllTOPNetworks)
+void
+FHoudiniPDGManager::QueueWorkResult(UTOPNode* InTOPNode, const int32& InWorkResultArrayIndex)
+{
+	if (!IsValid(InTOPNode) || !InTOPNode->WorkResult.IsValidIndex(InWorkResultArrayIndex))
+		return;
+
+	// Work results are identified by their work item, the array index changes when work results are removed.
+	// Work results without a work item can't be matched, and are always queued.
+	const int32 WorkItemID = InTOPNode->WorkResult[InWorkResultArrayIndex].WorkItemID;
+	if (WorkItemID != INDEX_NONE)
+	{
+		bool bAlreadyQueued = false;
+		QueuedWorkResults.Add(TPair<TWeakObjectPtr<UTOPNode>, int32>(InTOPNode, WorkItemID), &bAlreadyQueued);
+		if (bAlreadyQueued)
+			return;
+	}
+
+	FQueuedWorkResult& QueuedWorkResult = WorkResultQueue.AddDefaulted_GetRef();
+	QueuedWorkResult.TOPNode = InTOPNode;
+	QueuedWorkResult.WorkResultArrayIndex = InWorkResultArrayIndex;
+	QueuedWorkResult.WorkItemID = WorkItemID;
+}
+
+void
+FHoudiniPDGManager::ScanTOPNodeWorkResults(UTOPNode* InTOPNode)
+{
+	if (!IsValid(InTOPNode))
+		return;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniPDGManager::ScanTOPNodeWorkResults);
+
+	bool bHaveNotLoadedWorkResults = false;
+	bool bHaveLoadedWorkResults = false;
+
+	const int32 NumWorkResults = InTOPNode->WorkResult.Num();
+	for (int32 WorkResultArrayIndex = 0; WorkResultArrayIndex < NumWorkResults; ++WorkResultArrayIndex)
+	{
+		bool bNeedsProcessing = false;
+		for (const FTOPWorkResultObject& CurrentWorkResultObj : InTOPNode->WorkResult[WorkResultArrayIndex].ResultObjects)
 		{
-			if (!IsValid(CurrentTOPNet))
-				continue;
-			
-			// .. All TOP Nodes
-			for (UTOPNode* CurrentTOPNode : CurrentTOPNet->AllTOPNodes)
+			switch (CurrentWorkResultObj.State)
 			{
-				if (!IsValid(CurrentTOPNode))
-					continue;
-				
-				// ... All WorkResult
-				CurrentTOPNode->bCachedHaveNotLoadedWorkResults = false;
-				CurrentTOPNode->bCachedHaveLoadedWorkResults = false;
-				
-				const int32 NumWorkResults = CurrentTOPNode->WorkResult.Num();
-				for (int32 WorkResultArrayIndex = 0; WorkResultArrayIndex < NumWorkResults; ++WorkResultArrayIndex)
-				// for (FTOPWorkResult& CurrentWorkResult : CurrentTOPNode->WorkResult)
-				{
-					FTOPWorkResult& CurrentWorkResult = CurrentTOPNode->WorkResult[WorkResultArrayIndex];
-					// ... All WorkResultObjects
-					const int32 NumWorkResultObjects = CurrentWorkResult.ResultObjects.Num();
-					for (int32 WorkResultObjectArrayIndex = 0; WorkResultObjectArrayIndex < NumWorkResultObjects; ++WorkResultObjectArrayIndex)
-					// for (FTOPWorkResultObject& CurrentWorkResultObj : CurrentWorkResult.ResultObjects)
-					{
-						FTOPWorkResultObject& CurrentWorkResultObj = CurrentWorkResult.ResultObjects[WorkResultObjectArrayIndex];
-						if (CurrentWorkResultObj.State == EPDGWorkResultState::ToLoad)
-						{
-							CurrentWorkResultObj.State = EPDGWorkResultState::Loading;
+				case EPDGWorkResultState::ToLoad:
+				case EPDGWorkResultState::ToDelete:
+					bNeedsProcessing = true;
+					break;
 
-							// Load this WRObj
-							PackageParams.PDGTOPNetworkName = CurrentTOPNet->NodeName;
-							PackageParams.PDGTOPNodeName = CurrentTOPNode->NodeName;
-							PackageParams.PDGWorkItemIndex = CurrentWorkResult.WorkItemIndex;
-							// Use the array index to ensure uniqueness among the work items of the node (
-							// CurrentWorkResult.WorkItemIndex is not necessarily unique)
-							PackageParams.PDGWorkResultArrayIndex = WorkResultArrayIndex;
+				case EPDGWorkResultState::Loaded:
+					// The output actor could have been deleted by the user, the result object then needs to be deleted
+					if (!IsValid(CurrentWorkResultObj.GetOutputActorOwner().GetOutputActor()))
+						bNeedsProcessing = true;
+					else
+						bHaveLoadedWorkResults = true;
+					break;
 
-							if (CommandletStatus == EHoudiniBGEOCommandletStatus::Connected)
-							{
-								BGEOCommandletEndpoint->Send(new FHoudiniPDGImportBGEOMessage(
-									CurrentWorkResultObj.FilePath,
-									CurrentWorkResultObj.Name,
-									PackageParams,
-									CurrentTOPNode->NodeId,
-									CurrentWorkResult.WorkItemID,
-									StaticMeshGenerationProperties,
-									MeshBuildSettings
-								), BGEOCommandletAddress);
-							}
-							else
-							{
-								if (FHoudiniPDGTranslator::CreateAllResultObjectsForPDGWorkItem(
-									AssetLink,
-									CurrentTOPNode,
-									CurrentWorkResultObj,
-									PackageParams))
-								{
-									CurrentWorkResultObj.State = EPDGWorkResultState::Loaded;
-									CurrentWorkResultObj.SetAutoBakedSinceLastLoad(false);
-									CurrentTOPNode->bCachedHaveLoadedWorkResults = true;
-									
-									// Broadcast that we have loaded the work result object to those interested
-									AssetLink->OnWorkResultObjectLoaded.Broadcast(
-										AssetLink, CurrentTOPNode, WorkResultArrayIndex,
-										CurrentWorkResultObj.WorkItemResultInfoIndex);
-								}
-								else
-								{
-									CurrentWorkResultObj.State = EPDGWorkResultState::None;
-								}
-							}
-						}
-						else if (CurrentWorkResultObj.State == EPDGWorkResultState::Loaded)
-						{
-							// If the work item result obj is in the "Loaded" state, confirm that the output actor
-							// is still valid (the user could have manually deleted the output
-							if (!IsValid(CurrentWorkResultObj.GetOutputActorOwner().GetOutputActor()))
-							{
-								// If the output actor is invalid, set the state to ToDelete to complete the
-								// unload/deletion process
-								CurrentWorkResultObj.State = EPDGWorkResultState::ToDelete;
-							}
-							else
-							{
-								CurrentTOPNode->bCachedHaveLoadedWorkResults = true;
-							}
-						}
-						else if (CurrentWorkResultObj.State == EPDGWorkResultState::ToDelete)
-						{
-							CurrentWorkResultObj.State = EPDGWorkResultState::Deleting;
+				case EPDGWorkResultState::Deleted:
+				case EPDGWorkResultState::NotLoaded:
+					bHaveNotLoadedWorkResults = true;
+					break;
 
-							// Delete and clean up that WRObj
-							CurrentTOPNode->DeleteWorkResultObjectOutputs(WorkResultArrayIndex, WorkResultObjectArrayIndex);
-							CurrentTOPNode->bCachedHaveNotLoadedWorkResults = true;
-						}
-						else if (CurrentWorkResultObj.State == EPDGWorkResultState::Deleted)
-						{
-							CurrentTOPNode->bCachedHaveNotLoadedWorkResults = true;
-						}
-						else if (CurrentWorkResultObj.State == EPDGWorkResultState::NotLoaded)
-						{
-							CurrentTOPNode->bCachedHaveNotLoadedWorkResults = true;
-						}
-					}
+				default:
+					break;
+			}
+		}
+
+		if (bNeedsProcessing)
+			QueueWorkResult(InTOPNode, WorkResultArrayIndex);
+	}
+
+	InTOPNode->bCachedHaveNotLoadedWorkResults = bHaveNotLoadedWorkResults;
+	InTOPNode->bCachedHaveLoadedWorkResults = bHaveLoadedWorkResults;
+}
+
+void
+FHoudiniPDGManager::GetWorkResultPackageParams(UHoudiniPDGAssetLink* InAssetLink, FHoudiniPackageParams& OutPackageParams)
+{
+	if (!IsValid(InAssetLink))
+		return;
+
+	// Set up package parameters to:
+	// Cook to temp houdini engine directory
+	// and if the PDG asset link is associated with a Houdini Asset Component (HAC):
+	//		set the outer package to the HAC
+	//		set the HoudiniAssetName according to the HAC
+	//		set the ComponentGUID according to the HAC
+	// otherwise we set the outer to the asset link's parent and leave naming and GUID blank
+	OutPackageParams.PackageMode = FHoudiniPackageParams::GetDefaultStaticMeshesCookMode();
+	OutPackageParams.ReplaceMode = FHoudiniPackageParams::GetDefaultReplaceMode();
+
+	OutPackageParams.BakeFolder = FHoudiniEngineRuntime::Get().GetDefaultBakeFolder();
+	OutPackageParams.TempCookFolder = FHoudiniEngineRuntime::Get().GetDefaultTemporaryCookFolder();
+
+	UObject* AssetLinkParent = InAssetLink->GetOuter();
+	UHoudiniAssetComponent* HAC = AssetLinkParent != nullptr ? Cast<UHoudiniAssetComponent>(AssetLinkParent) : nullptr;
+	if (HAC)
+	{
+		OutPackageParams.OuterPackage = HAC->GetComponentLevel();
+		OutPackageParams.HoudiniAssetName = HAC->GetHoudiniAssetName();
+		OutPackageParams.HoudiniAssetActorName = HAC->GetOwner()->GetActorNameOrLabel();
+		OutPackageParams.ComponentGUID = HAC->GetComponentGUID();
+	}
+	else
+	{
+		OutPackageParams.OuterPackage = AssetLinkParent ? AssetLinkParent->GetOutermost() : nullptr;
+		OutPackageParams.HoudiniAssetName = FString();
+		OutPackageParams.HoudiniAssetActorName = FString();
+	}
+	OutPackageParams.ObjectName = FString();
+}
+
+void
+FHoudiniPDGManager::ProcessWorkResult(
+	UHoudiniPDGAssetLink* InAssetLink,
+	UTOPNetwork* InTOPNetwork,
+	UTOPNode* InTOPNode,
+	const int32& InWorkResultArrayIndex,
+	FHoudiniPackageParams& InPackageParams,
+	const EHoudiniBGEOCommandletStatus& InCommandletStatus)
+{
+	if (!IsValid(InAssetLink) || !IsValid(InTOPNetwork) || !IsValid(InTOPNode))
+		return;
+
+	if (!InTOPNode->WorkResult.IsValidIndex(InWorkResultArrayIndex))
+		return;
+
+	// Static mesh generation / build settings, get it from the HAC if available, otherwise from the plugin
+	// defaults
+	UHoudiniAssetComponent* HAC = Cast<UHoudiniAssetComponent>(InAssetLink->GetOuter());
+	const FHoudiniStaticMeshGenerationProperties& StaticMeshGenerationProperties = HAC ? HAC->StaticMeshGenerationProperties : FHoudiniEngineRuntimeUtils::GetDefaultStaticMeshGenerationProperties();
+	const FMeshBuildSettings& MeshBuildSettings = HAC ? HAC->StaticMeshBuildSettings : FHoudiniEngineRuntimeUtils::GetDefaultMeshBuildSettings();
+
+	FTOPWorkResult& CurrentWorkResult = InTOPNode->WorkResult[InWorkResultArrayIndex];
+	const int32 NumWorkResultObjects = CurrentWorkResult.ResultObjects.Num();
+	for (int32 WorkResultObjectArrayIndex = 0; WorkResultObjectArrayIndex < NumWorkResultObjects; ++WorkResultObjectArrayIndex)
+	{
+		FTOPWorkResultObject& CurrentWorkResultObj = CurrentWorkResult.ResultObjects[WorkResultObjectArrayIndex];
+		if (CurrentWorkResultObj.State == EPDGWorkResultState::Loaded)
+		{
+			// If the work item result obj is in the "Loaded" state, confirm that the output actor
+			// is still valid (the user could have manually deleted the output
+			if (!IsValid(CurrentWorkResultObj.GetOutputActorOwner().GetOutputActor()))
+			{
+				// If the output actor is invalid, set the state to ToDelete to complete the
+				// unload/deletion process
+				CurrentWorkResultObj.State = EPDGWorkResultState::ToDelete;
+			}
+			else
+			{
+				InTOPNode->bCachedHaveLoadedWorkResults = true;
+			}
+		}
+
+		if (CurrentWorkResultObj.State == EPDGWorkResultState::ToLoad)
+		{
+			CurrentWorkResultObj.State = EPDGWorkResultState::Loading;
+			TOPNodesToRefresh.Add(InTOPNode);
+
+			// Load this WRObj
+			InPackageParams.PDGTOPNetworkName = InTOPNetwork->NodeName;
+			InPackageParams.PDGTOPNodeName = InTOPNode->NodeName;
+			InPackageParams.PDGWorkItemIndex = CurrentWorkResult.WorkItemIndex;
+			// Use the array index to ensure uniqueness among the work items of the node (
+			// CurrentWorkResult.WorkItemIndex is not necessarily unique)
+			InPackageParams.PDGWorkResultArrayIndex = InWorkResultArrayIndex;
+
+			// Spread the imports across the connected commandlet processes
+			const int32 CommandletProcessIndex = InCommandletStatus == EHoudiniBGEOCommandletStatus::Connected
+				? GetBGEOCommandletProcessForImport() : INDEX_NONE;
+			if (CommandletProcessIndex != INDEX_NONE)
+			{
+				FBGEOCommandletProcess& CommandletProcess = BGEOCommandletProcesses[CommandletProcessIndex];
+				BGEOCommandletEndpoint->Send(new FHoudiniPDGImportBGEOMessage(
+					CurrentWorkResultObj.FilePath,
+					CurrentWorkResultObj.Name,
+					InPackageParams,
+					InTOPNode->NodeId,
+					CurrentWorkResult.WorkItemID,
+					StaticMeshGenerationProperties,
+					MeshBuildSettings
+				), CommandletProcess.Address);
+
+				FBGEOCommandletImport& PendingImport = CommandletProcess.PendingImports.AddDefaulted_GetRef();
+				PendingImport.TOPNode = InTOPNode;
+				PendingImport.WorkItemID = CurrentWorkResult.WorkItemID;
+				PendingImport.Name = CurrentWorkResultObj.Name;
+			}
+			else
+			{
+				if (FHoudiniPDGTranslator::CreateAllResultObjectsForPDGWorkItem(
+					InAssetLink,
+					InTOPNode,
+					CurrentWorkResultObj,
+					InPackageParams))
+				{
+					CurrentWorkResultObj.State = EPDGWorkResultState::Loaded;
+					CurrentWorkResultObj.SetAutoBakedSinceLastLoad(false);
+					InTOPNode->bCachedHaveLoadedWorkResults = true;
+					
+					// Broadcast that we have loaded the work result object to those interested
+					InAssetLink->OnWorkResultObjectLoaded.Broadcast(
+						InAssetLink, InTOPNode, InWorkResultArrayIndex,
+						CurrentWorkResultObj.WorkItemResultInfoIndex);
+				}
+				else
+				{
+					CurrentWorkResultObj.State = EPDGWorkResultState::None;
 				}
 			}
 		}
+		else if (CurrentWorkResultObj.State == EPDGWorkResultState::ToDelete)
+		{
+			CurrentWorkResultObj.State = EPDGWorkResultState::Deleting;
+			TOPNodesToRefresh.Add(InTOPNode);
+
+			// Delete and clean up that WRObj
+			InTOPNode->DeleteWorkResultObjectOutputs(InWorkResultArrayIndex, WorkResultObjectArrayIndex);
+			InTOPNode->bCachedHaveNotLoadedWorkResults = true;
+		}
+		else if (CurrentWorkResultObj.State == EPDGWorkResultState::Deleted)
+		{
+			InTOPNode->bCachedHaveNotLoadedWorkResults = true;
+		}
+		else if (CurrentWorkResultObj.State == EPDGWorkResultState::NotLoaded)
+		{
+			InTOPNode->bCachedHaveNotLoadedWorkResults = true;
+		}
 	}
 }
 
+void
+FHoudiniPDGManager::OnLevelActorDeleted(AActor* InActor)
+{
+	bActorsDeleted = true;
+}
+
 void FHoudiniPDGManager::HandleImportBGEODiscoverMessage(
 	const FHoudiniPDGImportBGEODiscoverMessage& InMessage,
 	const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext)
 {
 	HOUDINI_LOG_DISPLAY(TEXT("Received Discover from %s"), *InContext->GetSender().ToString());
-	// Ignore any discover acks received if we already have a valid local address
-	// for the commandlet
-	if (BGEOCommandletAddress.IsValid())
+	if (!InMessage.CommandletGuid.IsValid())
 		return;
 
-	if (BGEOCommandletProcHandle.IsValid() && InMessage.CommandletGuid.IsValid() && BGEOCommandletGuid == InMessage.CommandletGuid)
+	for (FBGEOCommandletProcess& CommandletProcess : BGEOCommandletProcesses)
 	{
-		BGEOCommandletAddress = InContext->GetSender();
+		if (CommandletProcess.Guid != InMessage.CommandletGuid)
+			continue;
+
+		// Ignore any discover acks received if we already have a valid local address
+		// for the commandlet
+		if (!CommandletProcess.Address.IsValid() && CommandletProcess.ProcHandle.IsValid())
+			CommandletProcess.Address = InContext->GetSender();
+
+		return;
 	}
 }
 
@@ -1804,6 +2031,23 @@ void FHoudiniPDGManager::HandleImportBGEOResultMessage(
 	const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext)
 {
 	HOUDINI_LOG_MESSAGE(TEXT("Received BGEO import result message"));
+
+	// The commandlet is done with this import
+	for (FBGEOCommandletProcess& CommandletProcess : BGEOCommandletProcesses)
+	{
+		if (CommandletProcess.Address != InContext->GetSender())
+			continue;
+
+		const int32 PendingImportIndex = CommandletProcess.PendingImports.IndexOfByPredicate(
+			[&InMessage](const FBGEOCommandletImport& PendingImport)
+			{
+				return PendingImport.WorkItemID == InMessage.WorkItemId && PendingImport.Name == InMessage.Name;
+			});
+		if (PendingImportIndex != INDEX_NONE)
+			CommandletProcess.PendingImports.RemoveAtSwap(PendingImportIndex);
+		break;
+	}
+
 	if (InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_Success || InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_PartialSuccess)
 	{
 		FHoudiniPackageParams PackageParams;
@@ -2030,6 +2274,7 @@ void FHoudiniPDGManager::HandleImportBGEOResultMessage(
 		{
 			WorkResultObject->State = EPDGWorkResultState::Loaded;
 			WorkResultObject->SetAutoBakedSinceLastLoad(false);
+			TOPNode->bCachedHaveLoadedWorkResults = true;
 			HOUDINI_LOG_MESSAGE(TEXT("Loaded geo for %s"), *InMessage.Name);
 			// Broadcast that we have loaded the work result object to those interested
 			AssetLink->OnWorkResultObjectLoaded.Broadcast(
@@ -2051,7 +2296,9 @@ bool FHoudiniPDGManager::CreateBGEOCommandletAndEndpoint()
 {
 	if (!BGEOCommandletEndpoint.IsValid())
 	{
-		BGEOCommandletAddress.Invalidate();
+		for (FBGEOCommandletProcess& CommandletProcess : BGEOCommandletProcesses)
+			CommandletProcess.Address.Invalidate();
+
 		BGEOCommandletEndpoint = FMessageEndpoint::Builder(TEXT("Houdini BGEO Commandlet"))
 			.Handling<FHoudiniPDGImportBGEOResultMessage>(this, &FHoudiniPDGManager::HandleImportBGEOResultMessage)
 			.Handling<FHoudiniPDGImportBGEODiscoverMessage>(this, &FHoudiniPDGManager::HandleImportBGEODiscoverMessage)
@@ -2066,95 +2313,190 @@ bool FHoudiniPDGManager::CreateBGEOCommandletAndEndpoint()
 		BGEOCommandletEndpoint->Subscribe<FHoudiniPDGImportBGEODiscoverMessage>();
 	}
 
-	if (!BGEOCommandletProcHandle.IsValid() || !FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
+	int32 NumProcesses = 1;
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (IsValid(HoudiniRuntimeSettings))
+		NumProcesses = FMath::Max(HoudiniRuntimeSettings->PDGAsyncCommandletImportProcessCount, 1);
+
+	if (BGEOCommandletProcesses.Num() < NumProcesses)
+		BGEOCommandletProcesses.SetNum(NumProcesses);
+
+	bool bStarted = false;
+	for (FBGEOCommandletProcess& CommandletProcess : BGEOCommandletProcesses)
 	{
-		// Start the bgeo commandlet
-		static const FString BGEOCommandletName = TEXT("HoudiniGeoImport");
-		BGEOCommandletGuid = FGuid::NewGuid();
-		BGEOCommandletAddress.Invalidate();
+		if (StartBGEOCommandletProcess(CommandletProcess))
+			bStarted = true;
+	}
 
-		// Get the absolute path to the project file, if known, otherwise get
-		// the project name. For the path: quote it for the command line.
-		IFileManager& FileManager = IFileManager::Get();
-		FString ProjectPathOrName = FApp::GetProjectName();
-		if (FPaths::IsProjectFilePathSet())
+	return bStarted;
+}
+
+bool FHoudiniPDGManager::StartBGEOCommandletProcess(FBGEOCommandletProcess& InProcess)
+{
+	if (InProcess.ProcHandle.IsValid() && FPlatformProcess::IsProcRunning(InProcess.ProcHandle))
+		return true;
+
+	// Imports sent to a previous instance of this process will never be replied to
+	RequeueBGEOCommandletImports(InProcess);
+	if (InProcess.ProcHandle.IsValid())
+		FPlatformProcess::CloseProc(InProcess.ProcHandle);
+
+	// Start the bgeo commandlet
+	static const FString BGEOCommandletName = TEXT("HoudiniGeoImport");
+	InProcess.Guid = FGuid::NewGuid();
+	InProcess.Address.Invalidate();
+
+	// Get the absolute path to the project file, if known, otherwise get
+	// the project name. For the path: quote it for the command line.
+	IFileManager& FileManager = IFileManager::Get();
+	FString ProjectPathOrName = FApp::GetProjectName();
+	if (FPaths::IsProjectFilePathSet())
+	{
+		const FString ProjectPath = FPaths::GetProjectFilePath();
+		if (!ProjectPath.IsEmpty())
 		{
-			const FString ProjectPath = FPaths::GetProjectFilePath();
-			if (!ProjectPath.IsEmpty())
-			{
-				ProjectPathOrName = FString::Printf(
-                    TEXT("\"%s\""),
-                    *FileManager.ConvertToAbsolutePathForExternalAppForRead(*ProjectPath)
-                );
-			}
+			ProjectPathOrName = FString::Printf(
+                TEXT("\"%s\""),
+                *FileManager.ConvertToAbsolutePathForExternalAppForRead(*ProjectPath)
+            );
 		}
+	}
 
-		if (ProjectPathOrName.IsEmpty())
-			return false;
+	if (ProjectPathOrName.IsEmpty())
+		return false;
 
-		// Get the executable path for the app/editor
-		FString ExePath = FPlatformProcess::GenerateApplicationPath(FApp::GetName(), FApp::GetBuildConfiguration());
-		if (!ExePath.IsEmpty())
-			ExePath = FileManager.ConvertToAbsolutePathForExternalAppForRead(*ExePath);
+	// Get the executable path for the app/editor
+	FString ExePath = FPlatformProcess::GenerateApplicationPath(FApp::GetName(), FApp::GetBuildConfiguration());
+	if (!ExePath.IsEmpty())
+		ExePath = FileManager.ConvertToAbsolutePathForExternalAppForRead(*ExePath);
 
-		if (ExePath.IsEmpty())
-			return false;
-		
-		const FString CommandLineParameters = FString::Printf(
-			TEXT("%s -messaging -run=%s -guid=%s -listen=%s -managerpid=%d"),
-			*ProjectPathOrName,
-			*BGEOCommandletName,
-			*BGEOCommandletGuid.ToString(),
-			*BGEOCommandletEndpoint->GetAddress().ToString(),
-			FPlatformProcess::GetCurrentProcessId());
-
-		BGEOCommandletProcHandle = FPlatformProcess::CreateProc(
-			*ExePath,
-			*CommandLineParameters,
-			false,
-			true,
-			false,
-			&BGEOCommandletProcessId,
-			0,
-			NULL,
-			NULL);
-		if (!BGEOCommandletProcHandle.IsValid())
+	if (ExePath.IsEmpty())
+		return false;
+	
+	// Each commandlet needs its own named pipe, otherwise they would share a single Houdini Engine session
+	const FString CommandLineParameters = FString::Printf(
+		TEXT("%s -messaging -run=%s -guid=%s -listen=%s -managerpid=%d -pipename=hapi_bgeo_cmdlet_%s"),
+		*ProjectPathOrName,
+		*BGEOCommandletName,
+		*InProcess.Guid.ToString(),
+		*BGEOCommandletEndpoint->GetAddress().ToString(),
+		FPlatformProcess::GetCurrentProcessId(),
+		*InProcess.Guid.ToString());
+
+	InProcess.ProcHandle = FPlatformProcess::CreateProc(
+		*ExePath,
+		*CommandLineParameters,
+		false,
+		true,
+		false,
+		&InProcess.ProcessId,
+		0,
+		NULL,
+		NULL);
+
+	return InProcess.ProcHandle.IsValid();
+}
+
+int32 FHoudiniPDGManager::GetBGEOCommandletProcessForImport() const
+{
+	int32 BestProcessIndex = INDEX_NONE;
+	for (int32 Index = 0; Index < BGEOCommandletProcesses.Num(); ++Index)
+	{
+		const FBGEOCommandletProcess& CommandletProcess = BGEOCommandletProcesses[Index];
+		if (!CommandletProcess.Address.IsValid() || !CommandletProcess.ProcHandle.IsValid())
+			continue;
+
+		if (BestProcessIndex == INDEX_NONE
+			|| CommandletProcess.PendingImports.Num() < BGEOCommandletProcesses[BestProcessIndex].PendingImports.Num())
 		{
-			return false;
+			BestProcessIndex = Index;
 		}
 	}
 
-	return true;
+	return BestProcessIndex;
+}
+
+void FHoudiniPDGManager::RequeueBGEOCommandletImports(FBGEOCommandletProcess& InProcess)
+{
+	for (const FBGEOCommandletImport& PendingImport : InProcess.PendingImports)
+	{
+		UTOPNode* TOPNode = PendingImport.TOPNode.Get();
+		if (!IsValid(TOPNode))
+			continue;
+
+		const int32 WorkResultArrayIndex = TOPNode->ArrayIndexOfWorkResultByID(PendingImport.WorkItemID);
+		FTOPWorkResult* WorkResult = TOPNode->GetWorkResultByArrayIndex(WorkResultArrayIndex);
+		if (!WorkResult)
+			continue;
+
+		for (FTOPWorkResultObject& WorkResultObject : WorkResult->ResultObjects)
+		{
+			if (WorkResultObject.Name == PendingImport.Name && WorkResultObject.State == EPDGWorkResultState::Loading)
+				WorkResultObject.State = EPDGWorkResultState::ToLoad;
+		}
+
+		QueueWorkResult(TOPNode, WorkResultArrayIndex);
+	}
+
+	InProcess.PendingImports.Empty();
 }
 
 void FHoudiniPDGManager::StopBGEOCommandletAndEndpoint()
 {
 	BGEOCommandletEndpoint.Reset();
-	BGEOCommandletAddress.Invalidate();
-	BGEOCommandletGuid.Invalidate();
 
-	if (BGEOCommandletProcHandle.IsValid() && FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
+	for (FBGEOCommandletProcess& CommandletProcess : BGEOCommandletProcesses)
 	{
-		FPlatformProcess::TerminateProc(BGEOCommandletProcHandle, true);
-		if (BGEOCommandletProcHandle.IsValid())
+		// The pending imports will be loaded in-process, or by the next commandlet
+		RequeueBGEOCommandletImports(CommandletProcess);
+
+		if (CommandletProcess.ProcHandle.IsValid() && FPlatformProcess::IsProcRunning(CommandletProcess.ProcHandle))
 		{
-			FPlatformProcess::WaitForProc(BGEOCommandletProcHandle);
-			FPlatformProcess::CloseProc(BGEOCommandletProcHandle);
+			FPlatformProcess::TerminateProc(CommandletProcess.ProcHandle, true);
+			if (CommandletProcess.ProcHandle.IsValid())
+			{
+				FPlatformProcess::WaitForProc(CommandletProcess.ProcHandle);
+				FPlatformProcess::CloseProc(CommandletProcess.ProcHandle);
+			}
 		}
 	}
+	BGEOCommandletProcesses.Empty();
 }
 
 EHoudiniBGEOCommandletStatus FHoudiniPDGManager::UpdateAndGetBGEOCommandletStatus()
 {
-	if (BGEOCommandletProcHandle.IsValid())
+	bool bAnyStarted = false;
+	bool bAnyRunning = false;
+	bool bAnyConnected = false;
+	for (FBGEOCommandletProcess& CommandletProcess : BGEOCommandletProcesses)
 	{
-		if (!FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Crashed;
-		else if (BGEOCommandletAddress.IsValid())
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Connected;
+		if (!CommandletProcess.ProcHandle.IsValid())
+			continue;
+
+		bAnyStarted = true;
+		if (!FPlatformProcess::IsProcRunning(CommandletProcess.ProcHandle))
+		{
+			// Crashed, its pending imports have to be loaded again
+			if (CommandletProcess.PendingImports.Num() > 0)
+			{
+				HOUDINI_LOG_WARNING(TEXT("BGEO commandlet (pid %d) stopped with %d pending imports, reloading them."),
+					CommandletProcess.ProcessId, CommandletProcess.PendingImports.Num());
+				RequeueBGEOCommandletImports(CommandletProcess);
+			}
+			CommandletProcess.Address.Invalidate();
+		}
+		else if (CommandletProcess.Address.IsValid())
+			bAnyConnected = true;
 		else
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Running;
+			bAnyRunning = true;
 	}
+
+	if (bAnyConnected)
+		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Connected;
+	else if (bAnyRunning)
+		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Running;
+	else if (bAnyStarted)
+		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Crashed;
 	else
 		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::NotStarted;
 
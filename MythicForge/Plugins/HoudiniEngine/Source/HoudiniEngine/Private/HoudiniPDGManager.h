@@ -36,8 +36,11 @@ class UHoudiniAssetComponent;
 class UHoudiniPDGAssetLink;
 class UTOPNetwork;
 class UTOPNode;
+class AActor;
 class FSocket;
 
+struct FHoudiniPackageParams;
+
 enum class EPDGNodeState : uint8;
 
 // BGEO commandlet status
@@ -153,7 +156,7 @@ public:
 		const struct FHoudiniPDGImportBGEOResultMessage& InMessage, 
 		const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext);
 
-	// Create the bgeo commandlet endpoint and start the commandlet (if not already running).
+	// Create the bgeo commandlet endpoint and start the commandlet processes (if not already running).
 	bool CreateBGEOCommandletAndEndpoint();
 
 	void StopBGEOCommandletAndEndpoint();
@@ -165,8 +168,60 @@ private:
 	
 	void UpdatePDGContexts();
 
+	// Loads/deletes the result objects of the queued work results, within the per-tick time budget
 	void ProcessWorkItemResults();
 
+	// Queues a work result so that its result objects are loaded or deleted by ProcessWorkItemResults()
+	void QueueWorkResult(UTOPNode* InTOPNode, const int32& InWorkResultArrayIndex);
+
+	// Goes through all the work results of a TOP node: queues the ones that have result objects to load or delete,
+	// and updates the node's cached loaded/not loaded flags
+	void ScanTOPNodeWorkResults(UTOPNode* InTOPNode);
+
+	// Loads or deletes the result objects of a single work result
+	void ProcessWorkResult(
+		UHoudiniPDGAssetLink* InAssetLink,
+		UTOPNetwork* InTOPNetwork,
+		UTOPNode* InTOPNode,
+		const int32& InWorkResultArrayIndex,
+		FHoudiniPackageParams& InPackageParams,
+		const EHoudiniBGEOCommandletStatus& InCommandletStatus);
+
+	// Sets up the package params used to load the work results of an asset link
+	static void GetWorkResultPackageParams(UHoudiniPDGAssetLink* InAssetLink, FHoudiniPackageParams& OutPackageParams);
+
+	// Output actors can be deleted by the user, their work result objects then need to be unloaded
+	void OnLevelActorDeleted(AActor* InActor);
+
+	// A result object sent to a commandlet process for import
+	struct FBGEOCommandletImport
+	{
+		TWeakObjectPtr<UTOPNode> TOPNode;
+		int32 WorkItemID;
+		FString Name;
+	};
+
+	// A BGEO commandlet process, each process imports on its own Houdini Engine session
+	struct FBGEOCommandletProcess
+	{
+		FProcHandle ProcHandle;
+		FGuid Guid;
+		FMessageAddress Address;
+		uint32 ProcessId = 0;
+		// Result objects sent to this process that it has not replied for yet
+		TArray<FBGEOCommandletImport> PendingImports;
+	};
+
+	// Starts the commandlet process InProcess (if not already running)
+	bool StartBGEOCommandletProcess(FBGEOCommandletProcess& InProcess);
+
+	// Returns the index of the connected commandlet process with the fewest pending imports,
+	// or INDEX_NONE if no commandlet is connected
+	int32 GetBGEOCommandletProcessForImport() const;
+
+	// Sets the pending imports of a commandlet process back to ToLoad, so that they are loaded again
+	void RequeueBGEOCommandletImports(FBGEOCommandletProcess& InProcess);
+
 	void ProcessPDGEvent(const HAPI_PDG_GraphContextId& InContextID, HAPI_PDG_EventInfo& EventInfo);
 
 	static void ResetPDGEventInfo(HAPI_PDG_EventInfo& InEventInfo);
@@ -204,11 +259,32 @@ private:
 
 	int32 MaxNumberOfPDGEvents = 20;
 
+	// A work result waiting to be processed, the array index is looked up again from the work item id when processed
+	struct FQueuedWorkResult
+	{
+		TWeakObjectPtr<UTOPNode> TOPNode;
+		int32 WorkResultArrayIndex;
+		int32 WorkItemID;
+	};
+
+	// Work results whose result objects need to be loaded or deleted, in the order they were queued.
+	// Entries before WorkResultQueueHead have already been processed.
+	TArray<FQueuedWorkResult> WorkResultQueue;
+	int32 WorkResultQueueHead = 0;
+
+	// TOP node and work item ID of the work results in the queue, array indexes can change while they are queued
+	TSet<TPair<TWeakObjectPtr<UTOPNode>, int32>> QueuedWorkResults;
+
+	// TOP nodes whose cached loaded/not loaded flags need to be updated once the queue is empty
+	TSet<TWeakObjectPtr<UTOPNode>> TOPNodesToRefresh;
+
+	// Set when an actor was deleted, the loaded work result objects' output actors then need to be checked
+	bool bActorsDeleted = false;
+	FDelegateHandle LevelActorDeletedHandle;
+
 	TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> BGEOCommandletEndpoint;
-	FMessageAddress BGEOCommandletAddress;
-	FProcHandle BGEOCommandletProcHandle;
-	FGuid BGEOCommandletGuid;
-	uint32 BGEOCommandletProcessId;
-	// Keep track of the BGEO commandlet status
+	// The BGEO commandlet processes, imports are spread across the connected ones
+	TArray<FBGEOCommandletProcess> BGEOCommandletProcesses;
+	// Keep track of the BGEO commandlet status (the best status of all the processes)
 	EHoudiniBGEOCommandletStatus BGEOCommandletStatus;
 };
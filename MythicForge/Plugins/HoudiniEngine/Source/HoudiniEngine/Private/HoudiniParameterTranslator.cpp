@@ -58,6 +58,9 @@
 #include "HoudiniParameter.h"
 #include "HoudiniAssetComponent.h"
 
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+
 
 // Default values for certain UI min and max parameter values
 #define HAPI_UNREAL_PARAM_INT_UI_MIN				0
@@ -72,6 +75,113 @@
 #define HAPI_UNREAL_PARAM_PIVOT						"p"
 #define HAPI_UNREAL_PARAM_UNIFORMSCALE				"scale"
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineParameterSchemaCache(
+	TEXT("HoudiniEngine.ParameterSchemaCache"),
+	1,
+	TEXT("Reuse the parameter tags of HDA definitions that have already been seen instead of fetching them for every instance.\n")
+	TEXT("0: Fetch the tags of every parameter from HAPI on each full update\n")
+	TEXT("1: Cache the tags per HDA definition: Default\n")
+);
+
+// Immutable part of a parameter, as defined by its HDA definition
+struct FHoudiniParameterSchema
+{
+	int32 TagCount = 0;
+	TMap<FString, FString> Tags;
+};
+
+// Parameter schemas of one HDA definition, keyed by parameter name
+struct FHoudiniParameterDefinitionSchema
+{
+	// Version and library timestamp the schemas were fetched from
+	FString Revision;
+	TMap<FString, FHoudiniParameterSchema> Parameters;
+};
+
+// Schemas of all the HDA definitions seen so far, keyed by library path and operator name
+static TMap<FString, FHoudiniParameterDefinitionSchema> HoudiniParameterSchemas;
+
+// Schemas of the HDA definition whose parameters are currently being built, if any
+static FHoudiniParameterDefinitionSchema* CurrentParameterSchemas = nullptr;
+
+// Finds (or resets) the schema cache entry of the HDA definition instantiated by the given asset.
+// Returns null for nodes that don't come from an HDA library on disk, or when Session Sync is enabled,
+// as their parameter interface can then change without notice.
+static FHoudiniParameterDefinitionSchema*
+FindParameterDefinitionSchema(const HAPI_AssetInfo& AssetInfo)
+{
+	// With Session Sync, definitions can be edited in Houdini without their library being saved.
+	// Drop what was cached so far, as it might not match the definitions once Session Sync is turned off.
+	if (FHoudiniEngine::Get().IsSessionSyncEnabled())
+	{
+		if (!CurrentParameterSchemas)
+			HoudiniParameterSchemas.Empty();
+
+		return nullptr;
+	}
+
+	FString LibraryPath;
+	if (!FHoudiniEngineString::ToFString(AssetInfo.filePathSH, LibraryPath) || LibraryPath.IsEmpty())
+		return nullptr;
+
+	FString OpName;
+	if (!FHoudiniEngineString::ToFString(AssetInfo.fullOpNameSH, OpName) || OpName.IsEmpty())
+		return nullptr;
+
+	// The library's timestamp catches definitions saved again without bumping their version.
+	// Without it (e.g. a library only visible to a remote session), changes can't be detected.
+	const FDateTime TimeStamp = IFileManager::Get().GetTimeStamp(*LibraryPath);
+	if (TimeStamp == FDateTime::MinValue())
+		return nullptr;
+
+	FString Version;
+	FHoudiniEngineString::ToFString(AssetInfo.versionSH, Version);
+
+	const FString Revision = FString::Printf(TEXT("%s|%lld"), *Version, TimeStamp.GetTicks());
+	FHoudiniParameterDefinitionSchema& DefinitionSchema = HoudiniParameterSchemas.FindOrAdd(LibraryPath + TEXT("|") + OpName);
+	if (DefinitionSchema.Revision != Revision)
+	{
+		DefinitionSchema.Revision = Revision;
+		DefinitionSchema.Parameters.Empty();
+	}
+
+	return &DefinitionSchema;
+}
+
+// Gets the value of a tag from the tags fetched during the parameter's full update.
+// Returns false if the parameter doesn't have the tag.
+static bool
+GetFetchedParameterTagValue(UHoudiniParameter* InParameter, const FString& InTag, FString& OutTagValue)
+{
+	OutTagValue = FString();
+
+	const FString* FoundValue = InParameter->GetTags().Find(InTag);
+	if (!FoundValue)
+		return false;
+
+	OutTagValue = *FoundValue;
+	return true;
+}
+
+// Converts the value of a parameter's "units" tag to a string understood by FUnitConversion
+static FString
+ConvertParameterUnitTagValue(const FString& InUnitTagValue)
+{
+	FString UnitString = InUnitTagValue;
+
+	// Per second and per hour are the only "per" unit that unreal recognize
+	UnitString.ReplaceInline(TEXT("s-1"), TEXT("/s"));
+	UnitString.ReplaceInline(TEXT("h-1"), TEXT("/h"));
+
+	// Houdini likes to add '1' on all the unit, so we'll remove all of them
+	// except the '-1' that still needs to remain.
+	UnitString.ReplaceInline(TEXT("-1"), TEXT("--"));
+	UnitString.ReplaceInline(TEXT("1"), TEXT(""));
+	UnitString.ReplaceInline(TEXT("--"), TEXT("-1"));
+
+	return UnitString;
+}
+
 // 
 bool 
 FHoudiniParameterTranslator::UpdateParameters(UHoudiniAssetComponent* HAC)
@@ -271,6 +381,7 @@ FHoudiniParameterTranslator::BuildAllParameters(
 	HAPI_NodeId NodeId = -1;
 	HAPI_AssetLibraryId AssetLibraryId = -1;
 	FString HoudiniAssetName;
+	FHoudiniParameterDefinitionSchema* DefinitionSchema = nullptr;
 	
 	if (AssetId >= 0)
 	{
@@ -295,6 +406,10 @@ FHoudiniParameterTranslator::BuildAllParameters(
 			FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId, &NodeInfo), false);
 
 		ParmCount = NodeInfo.parmCount;
+
+		// Reuse the tags already fetched for other instances of this HDA definition
+		if (ParmCount > 0 && CVarHoudiniEngineParameterSchemaCache.GetValueOnGameThread() > 0)
+			DefinitionSchema = FindParameterDefinitionSchema(AssetInfo);
 	}
 	else
 	{
@@ -434,6 +549,9 @@ FHoudiniParameterTranslator::BuildAllParameters(
 		}
 	}
 
+	// Let UpdateParameterFromInfo() use the definition's schemas
+	TGuardValue<FHoudiniParameterDefinitionSchema*> SchemaGuard(CurrentParameterSchemas, DefinitionSchema);
+
 	// Create properties for parameters.
 	TMap<UHoudiniParameterRampFloat*, int32> FloatRampsToIndex;
 	TMap<UHoudiniParameterRampColor*, int32> ColorRampsToIndex;
@@ -1443,38 +1561,63 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniParameterTranslator::UpdateParameterFromInfo__Tags);
 
-			int32 TagCount = HoudiniParameter->GetTagCount();
-			for (int32 Idx = 0; Idx < TagCount; ++Idx)
+			TMap<FString, FString>& Tags = HoudiniParameter->GetTags();
+			Tags.Empty();
+
+			// Spare parameters are added on the instance, and aren't part of the HDA definition
+			const bool bUseSchema = CurrentParameterSchemas && !ParmInfo.spare && !Name.IsEmpty();
+			const FHoudiniParameterSchema* Schema = bUseSchema ? CurrentParameterSchemas->Parameters.Find(Name) : nullptr;
+			if (Schema && Schema->TagCount == ParmInfo.tagCount)
 			{
-				HAPI_StringHandle TagNameSH;
-				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmTagName(
-					FHoudiniEngine::Get().GetSession(),
-					InNodeId, ParmInfo.id, Idx, &TagNameSH))
+				Tags = Schema->Tags;
+			}
+			else
+			{
+				bool bAllTagsFetched = true;
+				int32 TagCount = HoudiniParameter->GetTagCount();
+				for (int32 Idx = 0; Idx < TagCount; ++Idx)
 				{
-					HOUDINI_LOG_WARNING(TEXT("Failed to retrive parameter tag name: parmId: %d, tag index: %d"), ParmInfo.id, Idx);
-					continue;
-				}
+					HAPI_StringHandle TagNameSH;
+					if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmTagName(
+						FHoudiniEngine::Get().GetSession(),
+						InNodeId, ParmInfo.id, Idx, &TagNameSH))
+					{
+						HOUDINI_LOG_WARNING(TEXT("Failed to retrive parameter tag name: parmId: %d, tag index: %d"), ParmInfo.id, Idx);
+						bAllTagsFetched = false;
+						continue;
+					}
 
-				FString NameString = TEXT("");
-				FHoudiniEngineString::ToFString(TagNameSH, NameString);
-				if (NameString.IsEmpty())
-				{
-					HOUDINI_LOG_WARNING(TEXT("Failed to retrive parameter tag name: parmId: %d, tag index: %d"), ParmInfo.id, Idx);
-					continue;
+					FString NameString = TEXT("");
+					FHoudiniEngineString::ToFString(TagNameSH, NameString);
+					if (NameString.IsEmpty())
+					{
+						HOUDINI_LOG_WARNING(TEXT("Failed to retrive parameter tag name: parmId: %d, tag index: %d"), ParmInfo.id, Idx);
+						bAllTagsFetched = false;
+						continue;
+					}
+
+					HAPI_StringHandle TagValueSH;
+					if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmTagValue(
+						FHoudiniEngine::Get().GetSession(),
+						InNodeId, ParmInfo.id, TCHAR_TO_ANSI(*NameString), &TagValueSH))
+					{
+						HOUDINI_LOG_WARNING(TEXT("Failed to retrive parameter tag value: parmId: %d, tag: %s"), ParmInfo.id, *NameString);
+						bAllTagsFetched = false;
+					}
+
+					FString ValueString = TEXT("");
+					FHoudiniEngineString::ToFString(TagValueSH, ValueString);
+
+					Tags.Add(NameString, ValueString);
 				}
 
-				HAPI_StringHandle TagValueSH;
-				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmTagValue(
-					FHoudiniEngine::Get().GetSession(),
-					InNodeId, ParmInfo.id, TCHAR_TO_ANSI(*NameString), &TagValueSH))
+				// Only cache complete tag sets
+				if (bUseSchema && bAllTagsFetched)
 				{
-					HOUDINI_LOG_WARNING(TEXT("Failed to retrive parameter tag value: parmId: %d, tag: %s"), ParmInfo.id, *NameString);
+					FHoudiniParameterSchema& NewSchema = CurrentParameterSchemas->Parameters.FindOrAdd(Name);
+					NewSchema.TagCount = ParmInfo.tagCount;
+					NewSchema.Tags = Tags;
 				}
-
-				FString ValueString = TEXT("");
-				FHoudiniEngineString::ToFString(TagValueSH, ValueString);
-
-				HoudiniParameter->GetTags().Add(NameString, ValueString);
 			}
 		}
 	}
@@ -1661,7 +1804,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Check if we are read-only
 					bool bIsReadOnly = false;
 					FString FileChooserTag;
-					if (bHasValidNodeId && FHoudiniParameterTranslator::HapiGetParameterTagValue(InNodeId, ParmInfo.id, HAPI_PARAM_TAG_FILE_READONLY, FileChooserTag))
+					if (bHasValidNodeId && GetFetchedParameterTagValue(HoudiniParameter, TEXT(HAPI_PARAM_TAG_FILE_READONLY), FileChooserTag))
 					{
 						if (FileChooserTag.Equals(TEXT("read"), ESearchCase::IgnoreCase))
 							bIsReadOnly = true;
@@ -1785,10 +1928,11 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					FString ParamUnit;
 					if (bHasValidNodeId)
 					{
-						FHoudiniParameterTranslator::HapiGetParameterUnit(InNodeId, ParmInfo.id, ParamUnit);
+						if (GetFetchedParameterTagValue(HoudiniParameter, TEXT("units"), ParamUnit))
+							ParamUnit = ConvertParameterUnitTagValue(ParamUnit);
 						HoudiniParameterFloat->SetUnit(ParamUnit);
 						// Get the parameter's no swap tag (hengine_noswap)
-						HoudiniParameterFloat->SetNoSwap(HapiGetParameterHasTag(InNodeId, ParmInfo.id, HAPI_PARAM_TAG_NOSWAP));
+						HoudiniParameterFloat->SetNoSwap(HoudiniParameter->GetTags().Contains(TEXT(HAPI_PARAM_TAG_NOSWAP)));
 					}
 
 					// Set the min and max for this parameter
@@ -1994,7 +2138,8 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					FString ParamUnit;
 					if (bHasValidNodeId)
 					{
-						FHoudiniParameterTranslator::HapiGetParameterUnit(InNodeId, ParmInfo.id, ParamUnit);
+						if (GetFetchedParameterTagValue(HoudiniParameter, TEXT("units"), ParamUnit))
+							ParamUnit = ConvertParameterUnitTagValue(ParamUnit);
 						HoudiniParameterInt->SetUnit(ParamUnit);
 					}
 
@@ -2473,7 +2618,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					if (bHasValidNodeId)
 					{
 						HoudiniParameterString->SetIsAssetRef(
-							FHoudiniParameterTranslator::HapiGetParameterHasTag(InNodeId, ParmInfo.id, HOUDINI_PARAMETER_STRING_REF_TAG));
+							HoudiniParameter->GetTags().Contains(HOUDINI_PARAMETER_STRING_REF_TAG));
 					}
 				}
 			}
@@ -2541,6 +2686,12 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 	return true;
 }
 
+void
+FHoudiniParameterTranslator::ClearParameterSchemaCache()
+{
+	HoudiniParameterSchemas.Empty();
+}
+
 bool
 FHoudiniParameterTranslator::HapiGetParameterTagValue(const HAPI_NodeId& NodeId, const HAPI_ParmId& ParmId, const FString& Tag, FString& TagValue)
 {
@@ -2588,18 +2739,7 @@ FHoudiniParameterTranslator::HapiGetParameterUnit(const HAPI_NodeId& NodeId, con
 	
 	// We need to do some replacement in the string here in order to be able to get the
 	// proper unit type when calling FUnitConversion::UnitFromString(...) after.
-
-	// Per second and per hour are the only "per" unit that unreal recognize
-	UnitString.ReplaceInline(TEXT("s-1"), TEXT("/s"));
-	UnitString.ReplaceInline(TEXT("h-1"), TEXT("/h"));
-
-	// Houdini likes to add '1' on all the unit, so we'll remove all of them
-	// except the '-1' that still needs to remain.
-	UnitString.ReplaceInline(TEXT("-1"), TEXT("--"));
-	UnitString.ReplaceInline(TEXT("1"), TEXT(""));
-	UnitString.ReplaceInline(TEXT("--"), TEXT("-1"));
-
-	OutUnitString = UnitString;
+	OutUnitString = ConvertParameterUnitTagValue(UnitString);
 
 	return true;
 }
@@ -132,6 +132,9 @@ struct HOUDINIENGINE_API FHoudiniParameterTranslator
 		const HAPI_ParmInfo& ParmInfo );
 	*/
 
+	// Forgets the parameter tags cached per HDA definition by BuildAllParameters
+	static void ClearParameterSchemaCache();
+
 	// HAPI: Get a parameter's tag value.
 	static bool HapiGetParameterTagValue(
 		const HAPI_NodeId& NodeId,
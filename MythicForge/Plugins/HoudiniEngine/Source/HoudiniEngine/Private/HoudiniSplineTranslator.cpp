@@ -45,6 +45,71 @@
 #include "HoudiniEnginePrivatePCH.h"
 #include "HAPI/HAPI.h"
 
+// Converts curve positions to Houdini: scales them to meters and swaps Y/Z.
+// Float for the attribute data, double for the position strings so they keep their precision.
+template<typename RealType>
+static void
+ConvertCurvePositionsToHoudini(const TArray<FVector>& InPositions, TArray<RealType>& OutPositions)
+{
+	const int32 NumPoints = InPositions.Num();
+	OutPositions.SetNumUninitialized(NumPoints * 3);
+
+	const FVector* RESTRICT Src = InPositions.GetData();
+	RealType* RESTRICT Dst = OutPositions.GetData();
+	const double InvScale = 1.0 / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+	for (int32 Idx = 0; Idx < NumPoints; ++Idx, Dst += 3)
+	{
+		Dst[0] = (RealType)(Src[Idx].X * InvScale);
+		Dst[1] = (RealType)(Src[Idx].Z * InvScale);
+		Dst[2] = (RealType)(Src[Idx].Y * InvScale);
+	}
+}
+
+// Converts the first InNumPoints curve rotations to Houdini quaternions (swapped Y/Z, negated W)
+static void
+ConvertCurveRotationsToHoudini(const TArray<FQuat>& InRotations, const int32 InNumPoints, TArray<float>& OutRotations)
+{
+	OutRotations.SetNumUninitialized(InNumPoints * 4);
+
+	const FQuat* RESTRICT Src = InRotations.GetData();
+	float* RESTRICT Dst = OutRotations.GetData();
+	for (int32 Idx = 0; Idx < InNumPoints; ++Idx, Dst += 4)
+	{
+		Dst[0] = (float)Src[Idx].X;
+		Dst[1] = (float)Src[Idx].Z;
+		Dst[2] = (float)Src[Idx].Y;
+		Dst[3] = (float)-Src[Idx].W;
+	}
+}
+
+// Converts the first InNumPoints curve scales to Houdini (swapped Y/Z)
+static void
+ConvertCurveScalesToHoudini(const TArray<FVector>& InScales, const int32 InNumPoints, TArray<float>& OutScales)
+{
+	OutScales.SetNumUninitialized(InNumPoints * 3);
+
+	const FVector* RESTRICT Src = InScales.GetData();
+	float* RESTRICT Dst = OutScales.GetData();
+	for (int32 Idx = 0; Idx < InNumPoints; ++Idx, Dst += 3)
+	{
+		Dst[0] = (float)Src[Idx].X;
+		Dst[1] = (float)Src[Idx].Z;
+		Dst[2] = (float)Src[Idx].Y;
+	}
+}
+
+// Adds a float point attribute to part 0 of the node and uploads its values
+static bool
+HapiAddCurvePointFloatAttribute(const HAPI_NodeId InNodeId, const char* InAttributeName, const int32 InTupleSize, const TArray<float>& InValues)
+{
+	HAPI_AttributeInfo AttributeInfo;
+	FHoudiniHapiAccessor Accessor(InNodeId, 0, InAttributeName);
+	if (!Accessor.AddAttribute(HAPI_ATTROWNER_POINT, HAPI_STORAGETYPE_FLOAT, InTupleSize, InValues.Num() / InTupleSize, &AttributeInfo))
+		return false;
+
+	return Accessor.SetAttributeData(AttributeInfo, InValues);
+}
+
 void
 FHoudiniSplineTranslator::ExtractStringPositions(const FString& Positions, TArray<FVector>& OutPositions)
 {
@@ -567,12 +632,13 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForData(
 	const FTransform& ParentTransform,
 	const bool & InIsLegacyCurve,
 	const int32& InOrder,
-	const EHoudiniCurveBreakpointParameterization& InBreakpointParameterization
+	const EHoudiniCurveBreakpointParameterization& InBreakpointParameterization,
+	const bool& InNeedsCoordsParameter
 	 )
 {
 	if (InIsLegacyCurve)
 	{
-		return HapiCreateCurveInputNodeForDataLegacy(CurveNodeId, ParentNodeId, InputNodeName, Positions, Rotations, Scales3d, InCurveType, InCurveMethod, InClosed, InReversed, InForceClose, ParentTransform);
+		return HapiCreateCurveInputNodeForDataLegacy(CurveNodeId, ParentNodeId, InputNodeName, Positions, Rotations, Scales3d, InCurveType, InCurveMethod, InClosed, InReversed, InForceClose, ParentTransform, InNeedsCoordsParameter);
 	}
 	
 #if WITH_EDITOR
@@ -634,15 +700,7 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForData(
         &InputCurveInfo), false);
 
 	TArray<float> CurvePositions;
-	CurvePositions.SetNum(NumberOfCVs * 3);
-
-	for (int32 i = 0; i < Positions->Num(); i++)
-	{
-		CurvePositions[i*3 + 0] = (float)((*Positions)[i].X) / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		// Swap Y/Z
-		CurvePositions[i*3 + 1] = (float)((*Positions)[i].Z) / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		CurvePositions[i*3 + 2] = (float)((*Positions)[i].Y) / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-	}
+	ConvertCurvePositionsToHoudini(*Positions, CurvePositions);
 
 	TArray<float> CurveRotations;
 	TArray<float> CurveScales;
@@ -651,32 +709,10 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForData(
 	bool bAddScales3d = (Scales3d != nullptr && Scales3d->Num() == Positions->Num());
 	
 	if (bAddRotations)
-	{
-		CurveRotations.SetNum(NumberOfCVs * 4);
-		for (int32 Idx = 0; Idx < Rotations->Num(); Idx++)
-		{
-			// Get current quaternion
-			const FQuat& RotationQuaternion = (*Rotations)[Idx];
-
-			CurveRotations[Idx * 4 + 0] = RotationQuaternion.X;
-			CurveRotations[Idx * 4 + 1] = RotationQuaternion.Z;
-			CurveRotations[Idx * 4 + 2] = RotationQuaternion.Y;
-			CurveRotations[Idx * 4 + 3] = -RotationQuaternion.W;
-		}
-	}
+		ConvertCurveRotationsToHoudini(*Rotations, NumberOfCVs, CurveRotations);
 
 	if (bAddScales3d)
-	{
-		CurveScales.SetNum(NumberOfCVs * 3);
-		for (int32 Idx = 0; Idx < Scales3d->Num(); Idx++)
-		{
-			// Get current scale
-			FVector ScaleVector = (*Scales3d)[Idx];
-			CurveScales[Idx * 3 + 0] = ScaleVector.X;
-			CurveScales[Idx * 3 + 1] = ScaleVector.Z;
-			CurveScales[Idx * 3 + 2] = ScaleVector.Y;
-		}
-	}
+		ConvertCurveScalesToHoudini(*Scales3d, NumberOfCVs, CurveScales);
 
 	if (bAddRotations || bAddScales3d)
 	{
@@ -712,7 +748,8 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForDataLegacy(
 	const bool& InClosed,
 	const bool& InReversed,
 	const bool& InForceClose,
-	const FTransform& ParentTransform )
+	const FTransform& ParentTransform,
+	const bool& InNeedsCoordsParameter)
 {
 #if WITH_EDITOR
 	// Positions are required
@@ -766,6 +803,90 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForDataLegacy(
 		FHoudiniApi::RevertGeo(FHoudiniEngine::Get().GetSession(), CurveNodeId);
 	}
 
+	// The curve SOP outputs the points of polygon curves unchanged, so when the coords don't need to be
+	// read back from the node, we can send the curve as binary geometry instead of going through the coords string
+	// and cooking the curve SOP twice to add the rotation and scale attributes.
+	if (!InNeedsCoordsParameter && InCurveType == EHoudiniCurveType::Polygon && !InReversed)
+	{
+		const bool bClosed = InClosed || InForceClose;
+
+		HAPI_PartInfo PartInfo;
+		FHoudiniApi::PartInfo_Init(&PartInfo);
+		PartInfo.id = 0;
+		PartInfo.nameSH = 0;
+		// Closed polygon curves are output as a single closed face
+		PartInfo.type = bClosed ? HAPI_PARTTYPE_MESH : HAPI_PARTTYPE_CURVE;
+		PartInfo.pointCount = NumberOfCVs;
+		PartInfo.vertexCount = NumberOfCVs;
+		PartInfo.faceCount = 1;
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
+			FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, &PartInfo), false);
+
+		if (bClosed)
+		{
+			TArray<int32> FaceCounts({ NumberOfCVs });
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetFaceCounts(
+				FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, FaceCounts.GetData(), 0, 1), false);
+
+			TArray<int32> VertexList;
+			VertexList.SetNumUninitialized(NumberOfCVs);
+			for (int32 Idx = 0; Idx < NumberOfCVs; ++Idx)
+				VertexList[Idx] = Idx;
+
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetVertexList(
+				FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, VertexList.GetData(), 0, NumberOfCVs), false);
+		}
+		else
+		{
+			HAPI_CurveInfo CurveInfo;
+			FHoudiniApi::CurveInfo_Init(&CurveInfo);
+			CurveInfo.curveType = HAPI_CURVETYPE_LINEAR;
+			CurveInfo.curveCount = 1;
+			CurveInfo.vertexCount = NumberOfCVs;
+			CurveInfo.knotCount = 0;
+			CurveInfo.isPeriodic = false;
+			CurveInfo.isRational = false;
+			CurveInfo.order = 0;
+			CurveInfo.hasKnots = false;
+			CurveInfo.isClosed = false;
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetCurveInfo(
+				FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, &CurveInfo), false);
+
+			TArray<int32> CurveCounts({ NumberOfCVs });
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetCurveCounts(
+				FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, CurveCounts.GetData(), 0, 1), false);
+		}
+
+		TArray<float> CurvePositions;
+		ConvertCurvePositionsToHoudini(*Positions, CurvePositions);
+		if (!HapiAddCurvePointFloatAttribute(CurveNodeId, HAPI_UNREAL_ATTRIB_POSITION, 3, CurvePositions))
+			return false;
+
+		if (Rotations && Rotations->Num() == NumberOfCVs)
+		{
+			TArray<float> CurveRotations;
+			ConvertCurveRotationsToHoudini(*Rotations, NumberOfCVs, CurveRotations);
+			if (!HapiAddCurvePointFloatAttribute(CurveNodeId, HAPI_UNREAL_ATTRIB_ROTATION, 4, CurveRotations))
+				return false;
+		}
+
+		if (Scales3d && Scales3d->Num() == NumberOfCVs)
+		{
+			TArray<float> CurveScales;
+			ConvertCurveScalesToHoudini(*Scales3d, NumberOfCVs, CurveScales);
+			if (!HapiAddCurvePointFloatAttribute(CurveNodeId, HAPI_UNREAL_ATTRIB_SCALE, 3, CurveScales))
+				return false;
+		}
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(CurveNodeId), false);
+
+		// Cook the node, no need to wait for completion
+		HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
+		CookOptions.maxVerticesPerPrimitive = -1;
+		CookOptions.refineCurveToLinear = true;
+		return FHoudiniEngineUtils::HapiCookNode(CurveNodeId, &CookOptions, false);
+	}
+
 	//
 	// In order to be able to add rotations and scale attributes to the curve SOP, we need to cook it twice:
 	// 
@@ -864,8 +985,7 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForDataLegacy(
 	{
 		/*
 		HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
-		HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookNode(
-			FHoudiniEngine::Get().GetSession(), CurveNodeId, &CookOptions), false);
+		HOUDINI_CHECK_ERROR_RETURN( FHoudiniEngineUtils::HapiStartCookNode(CurveNodeId, &CookOptions), false);
 		*/
 
 		// Cook the node, no need to wait for completion
@@ -1033,7 +1153,6 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForDataLegacy(
 
 	// We need to increase the point attributes count for points in the Part Infos
 	HAPI_AttributeOwner NewAttributesOwner = HAPI_ATTROWNER_POINT;
-	HAPI_AttributeOwner OriginalAttributesOwner = HAPI_ATTROWNER_POINT;
 
 	int OriginalPointParametersCount = PartInfos.attributeCounts[NewAttributesOwner];
 	if (bAddRotations)
@@ -1349,84 +1468,18 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForDataLegacy(
 	// and properties have been reset.
 	if (bAddRotations)
 	{
-		// Create ROTATION attribute info
-		HAPI_AttributeInfo AttributeInfoRotation;
-		FHoudiniApi::AttributeInfo_Init(&AttributeInfoRotation);
-		AttributeInfoRotation.count = NumberOfCVs;
-		AttributeInfoRotation.tupleSize = 4;
-		AttributeInfoRotation.exists = true;
-		AttributeInfoRotation.owner = NewAttributesOwner;
-		AttributeInfoRotation.storage = HAPI_STORAGETYPE_FLOAT;
-		AttributeInfoRotation.originalOwner = OriginalAttributesOwner;
-
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-			FHoudiniEngine::Get().GetSession(),
-			CurveNodeId, 0,
-			HAPI_UNREAL_ATTRIB_ROTATION,
-			&AttributeInfoRotation), false);
-
-		// Convert the rotation infos
-		TArray< float > CurveRotations;
-		CurveRotations.SetNumZeroed(NumberOfCVs * 4);
-		for (int32 Idx = 0; Idx < NumberOfCVs; ++Idx)
-		{
-			// Get current quaternion
-			const FQuat& RotationQuaternion = (*Rotations)[Idx];
-
-			CurveRotations[Idx * 4 + 0] = RotationQuaternion.X;
-			CurveRotations[Idx * 4 + 1] = RotationQuaternion.Z;
-			CurveRotations[Idx * 4 + 2] = RotationQuaternion.Y;
-			CurveRotations[Idx * 4 + 3] = -RotationQuaternion.W;
-		}
-
-		//we can now upload them to our attribute.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-			FHoudiniEngine::Get().GetSession(),
-			CurveNodeId, 0,
-			HAPI_UNREAL_ATTRIB_ROTATION,
-			&AttributeInfoRotation,
-			CurveRotations.GetData(),
-			0, AttributeInfoRotation.count), false);
+		TArray<float> CurveRotations;
+		ConvertCurveRotationsToHoudini(*Rotations, NumberOfCVs, CurveRotations);
+		if (!HapiAddCurvePointFloatAttribute(CurveNodeId, HAPI_UNREAL_ATTRIB_ROTATION, 4, CurveRotations))
+			return false;
 	}
 
-	// Create SCALE attribute info.
 	if (bAddScales3d)
 	{
-		HAPI_AttributeInfo AttributeInfoScale;
-		FHoudiniApi::AttributeInfo_Init(&AttributeInfoScale);
-		AttributeInfoScale.count = NumberOfCVs;
-		AttributeInfoScale.tupleSize = 3;
-		AttributeInfoScale.exists = true;
-		AttributeInfoScale.owner = NewAttributesOwner;
-		AttributeInfoScale.storage = HAPI_STORAGETYPE_FLOAT;
-		AttributeInfoScale.originalOwner = OriginalAttributesOwner;
-
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-			FHoudiniEngine::Get().GetSession(),
-			CurveNodeId, 0,
-			HAPI_UNREAL_ATTRIB_SCALE,
-			&AttributeInfoScale), false);
-
-		// Convert the scale
-		TArray< float > CurveScales;
-		CurveScales.SetNumZeroed(NumberOfCVs * 3);
-		for (int32 Idx = 0; Idx < NumberOfCVs; ++Idx)
-		{
-			// Get current scale
-			FVector ScaleVector = (*Scales3d)[Idx];
-			CurveScales[Idx * 3 + 0] = ScaleVector.X;
-			CurveScales[Idx * 3 + 1] = ScaleVector.Z;
-			CurveScales[Idx * 3 + 2] = ScaleVector.Y;
-		}
-
-		// We can now upload them to our attribute.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-			FHoudiniEngine::Get().GetSession(),
-			CurveNodeId, 0,
-			HAPI_UNREAL_ATTRIB_SCALE,
-			&AttributeInfoScale,
-			CurveScales.GetData(),
-			0, AttributeInfoScale.count), false);
+		TArray<float> CurveScales;
+		ConvertCurveScalesToHoudini(*Scales3d, NumberOfCVs, CurveScales);
+		if (!HapiAddCurvePointFloatAttribute(CurveNodeId, HAPI_UNREAL_ATTRIB_SCALE, 3, CurveScales))
+			return false;
 	}
 
 	// Finally, commit the geo ...
@@ -1444,14 +1497,16 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForDataLegacy(
 void
 FHoudiniSplineTranslator::CreatePositionsString(const TArray<FVector>& InPositions, FString& OutPositionString)
 {
-	OutPositionString = TEXT("");
-	for (int32 Idx = 0; Idx < InPositions.Num(); ++Idx)
-	{
-		FVector Position = InPositions[Idx];	
-		// Convert to meters
-		Position /= HAPI_UNREAL_SCALE_FACTOR_POSITION;
-		// Swap Y/Z
-		OutPositionString += FString::Printf(TEXT("%f, %f, %f "), Position.X, Position.Z, Position.Y);
+	// Convert to meters and swap Y/Z, without narrowing to float before formatting
+	TArray<double> HoudiniPositions;
+	ConvertCurvePositionsToHoudini(InPositions, HoudiniPositions);
+
+	// Append in place to a string reserved up front, instead of concatenating a temporary string per point
+	OutPositionString.Empty(InPositions.Num() * 36);
+	for (int32 Idx = 0; Idx < HoudiniPositions.Num(); Idx += 3)
+	{
+		OutPositionString.Appendf(TEXT("%f, %f, %f "),
+			HoudiniPositions[Idx + 0], HoudiniPositions[Idx + 1], HoudiniPositions[Idx + 2]);
 	}
 }
 
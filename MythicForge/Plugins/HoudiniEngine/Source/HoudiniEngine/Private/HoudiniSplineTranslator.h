@@ -81,7 +81,10 @@ struct HOUDINIENGINE_API FHoudiniSplineTranslator
 		const bool & InIsLegacyCurve = false,
 		// Only used if Legacy curve:
 		const int32& InOrder = 2,
-		const EHoudiniCurveBreakpointParameterization& InBreakpointParameterization = EHoudiniCurveBreakpointParameterization::Uniform
+		const EHoudiniCurveBreakpointParameterization& InBreakpointParameterization = EHoudiniCurveBreakpointParameterization::Uniform,
+		// Only used if Legacy curve: false lets polygon curves be sent as binary geometry
+		// when the curve's coords parameter is never read back
+		const bool& InNeedsCoordsParameter = true
 	);
 
 	// Update curve node data using curve::1.0
@@ -98,7 +101,8 @@ struct HOUDINIENGINE_API FHoudiniSplineTranslator
 		const bool& InClosed,
 		const bool& InReversed,
 		const bool& InForceClose = false,
-		const FTransform& ParentTransform = FTransform::Identity);
+		const FTransform& ParentTransform = FTransform::Identity,
+		const bool& InNeedsCoordsParameter = true);
 
 	
 	// Create a default curve node.
@@ -1,5 +1,11 @@
 #include "../HoudiniEngine.h"
+#include "../HoudiniEngineString.h"
+#include "../HoudiniEngineTask.h"
+#include "../HoudiniEngineTaskQueue.h"
+#include "../HoudiniEngineUtils.h"
+#include "HoudiniApi.h"
 #include "Misc/AutomationTest.h"
+#include "Async/Async.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -10,4 +16,193 @@ bool HoudiniCoreTest::RunTest(const FString & Parameters)
 	return true;
 }
 
-#endif
\ No newline at end of file
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTaskQueueBenchmark, "Houdini.Core.Scheduler.TaskQueueBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTaskQueueBenchmark::RunTest(const FString & Parameters)
+{
+	// Enqueue 100k tasks from several producer threads while a single consumer drains them,
+	// the same access pattern as the game thread(s) feeding the scheduler thread.
+	const int32 NumTasks = 100000;
+	const int32 NumProducers = 4;
+	const int32 TasksPerProducer = NumTasks / NumProducers;
+
+	THoudiniBoundedMpscQueue<FHoudiniEngineTask> Queue(16384u);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<TFuture<void>> Producers;
+	for (int32 ProducerIdx = 0; ProducerIdx < NumProducers; ProducerIdx++)
+	{
+		Producers.Add(Async(EAsyncExecution::Thread, [&Queue, ProducerIdx, TasksPerProducer]()
+		{
+			for (int32 TaskIdx = 0; TaskIdx < TasksPerProducer; TaskIdx++)
+			{
+				FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetCooking, FGuid::NewGuid());
+				Task.AssetId = ProducerIdx * TasksPerProducer + TaskIdx;
+				Task.ActorName = TEXT("BenchmarkActor");
+				while (!Queue.TryEnqueue(MoveTemp(Task)))
+					FPlatformProcess::Yield();
+			}
+		}));
+	}
+
+	int32 NumDequeued = 0;
+	int64 AssetIdSum = 0;
+	FHoudiniEngineTask Task;
+	while (NumDequeued < NumProducers * TasksPerProducer)
+	{
+		if (Queue.TryDequeue(Task))
+		{
+			NumDequeued++;
+			AssetIdSum += Task.AssetId;
+		}
+		else
+		{
+			FPlatformProcess::Yield();
+		}
+	}
+
+	for (TFuture<void>& Producer : Producers)
+		Producer.Wait();
+
+	const double LockFreeTime = FPlatformTime::Seconds() - StartTime;
+
+	// Same workload through a ring guarded by a critical section, for reference
+	FCriticalSection CriticalSection;
+	TArray<FHoudiniEngineTask> LockedQueue;
+	LockedQueue.Reserve(NumTasks);
+	int32 LockedReadPos = 0;
+
+	const double LockedStartTime = FPlatformTime::Seconds();
+	Producers.Empty();
+	for (int32 ProducerIdx = 0; ProducerIdx < NumProducers; ProducerIdx++)
+	{
+		Producers.Add(Async(EAsyncExecution::Thread, [&CriticalSection, &LockedQueue, ProducerIdx, TasksPerProducer]()
+		{
+			for (int32 TaskIdx = 0; TaskIdx < TasksPerProducer; TaskIdx++)
+			{
+				FHoudiniEngineTask LockedTask(EHoudiniEngineTaskType::AssetCooking, FGuid::NewGuid());
+				LockedTask.AssetId = ProducerIdx * TasksPerProducer + TaskIdx;
+				LockedTask.ActorName = TEXT("BenchmarkActor");
+
+				FScopeLock ScopeLock(&CriticalSection);
+				LockedQueue.Add(MoveTemp(LockedTask));
+			}
+		}));
+	}
+
+	while (LockedReadPos < NumProducers * TasksPerProducer)
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+		if (LockedReadPos < LockedQueue.Num())
+			Task = MoveTemp(LockedQueue[LockedReadPos++]);
+	}
+
+	for (TFuture<void>& Producer : Producers)
+		Producer.Wait();
+
+	const double LockedTime = FPlatformTime::Seconds() - LockedStartTime;
+
+	AddInfo(FString::Printf(TEXT("Enqueued and drained %d tasks: lock-free queue %.3f ms, locked queue %.3f ms."),
+		NumDequeued, LockFreeTime * 1000.0, LockedTime * 1000.0));
+
+	const int64 ExpectedSum = (int64)NumDequeued * (NumDequeued - 1) / 2;
+	TestEqual(TEXT("All tasks dequeued"), NumDequeued, NumProducers * TasksPerProducer);
+	TestEqual(TEXT("Every task dequeued exactly once"), AssetIdSum, ExpectedSum);
+	TestTrue(TEXT("Queue is empty"), Queue.IsEmpty());
+
+	return true;
+}
+
+
+// Sets the detail string attribute of an input node, cooks it and returns the resolved attribute value
+static bool
+SetAndResolveDetailString(HAPI_NodeId InNodeId, const char* InValue, FString& OutValue)
+{
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	PartInfo.type = HAPI_PARTTYPE_MESH;
+	PartInfo.pointCount = 1;
+	if (FHoudiniApi::SetPartInfo(Session, InNodeId, 0, &PartInfo) != HAPI_RESULT_SUCCESS)
+		return false;
+
+	HAPI_AttributeInfo PositionInfo;
+	FHoudiniApi::AttributeInfo_Init(&PositionInfo);
+	PositionInfo.count = 1;
+	PositionInfo.tupleSize = 3;
+	PositionInfo.exists = true;
+	PositionInfo.owner = HAPI_ATTROWNER_POINT;
+	PositionInfo.storage = HAPI_STORAGETYPE_FLOAT;
+	const float Position[3] = { 0.0f, 0.0f, 0.0f };
+	if (FHoudiniApi::AddAttribute(Session, InNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &PositionInfo) != HAPI_RESULT_SUCCESS
+		|| FHoudiniApi::SetAttributeFloatData(Session, InNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &PositionInfo, Position, 0, 1) != HAPI_RESULT_SUCCESS)
+		return false;
+
+	HAPI_AttributeInfo StringInfo;
+	FHoudiniApi::AttributeInfo_Init(&StringInfo);
+	StringInfo.count = 1;
+	StringInfo.tupleSize = 1;
+	StringInfo.exists = true;
+	StringInfo.owner = HAPI_ATTROWNER_DETAIL;
+	StringInfo.storage = HAPI_STORAGETYPE_STRING;
+	const char* Values[1] = { InValue };
+	if (FHoudiniApi::AddAttribute(Session, InNodeId, 0, "test_string", &StringInfo) != HAPI_RESULT_SUCCESS
+		|| FHoudiniApi::SetAttributeStringData(Session, InNodeId, 0, "test_string", &StringInfo, Values, 0, 1) != HAPI_RESULT_SUCCESS
+		|| FHoudiniEngineUtils::HapiCommitGeo(InNodeId) != HAPI_RESULT_SUCCESS)
+		return false;
+
+	if (!FHoudiniEngineUtils::HapiCookNode(InNodeId, nullptr, true))
+		return false;
+
+	HAPI_AttributeInfo CookedInfo;
+	FHoudiniApi::AttributeInfo_Init(&CookedInfo);
+	if (FHoudiniApi::GetAttributeInfo(Session, InNodeId, 0, "test_string", HAPI_ATTROWNER_DETAIL, &CookedInfo) != HAPI_RESULT_SUCCESS
+		|| !CookedInfo.exists)
+		return false;
+
+	TArray<int32> Handles;
+	Handles.SetNumZeroed(1);
+	if (FHoudiniApi::GetAttributeStringData(Session, InNodeId, 0, "test_string", &CookedInfo, Handles.GetData(), 0, 1) != HAPI_RESULT_SUCCESS)
+		return false;
+
+	TArray<FString> Strings;
+	if (!FHoudiniEngineString::SHArrayToFStringArray(Handles, Strings) || Strings.Num() != 1)
+		return false;
+
+	OutValue = Strings[0];
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreStringCacheCook, "Houdini.Core.Strings.StringCacheCook", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreStringCacheCook::RunTest(const FString & Parameters)
+{
+	// Strings resolved before a cook must not be returned for the handles of the cooked geometry
+	if (!FHoudiniEngine::IsInitialized() || !FHoudiniEngine::Get().GetSession())
+	{
+		AddWarning(TEXT("No Houdini Engine session, skipping the string cache test."));
+		return true;
+	}
+
+	HAPI_NodeId NodeId = -1;
+	if (!TestEqual(TEXT("Input node created"), (int32)FHoudiniEngineUtils::CreateInputNode(TEXT("StringCacheTest"), NodeId), (int32)HAPI_RESULT_SUCCESS))
+		return false;
+
+	FString FirstValue;
+	FString SecondValue;
+	const bool bFirst = SetAndResolveDetailString(NodeId, "first", FirstValue);
+	const bool bSecond = SetAndResolveDetailString(NodeId, "second", SecondValue);
+
+	FHoudiniEngineUtils::DeleteHoudiniNode(NodeId);
+
+	TestTrue(TEXT("First cook resolved"), bFirst);
+	TestTrue(TEXT("Second cook resolved"), bSecond);
+	TestEqual(TEXT("String before the cook"), FirstValue, FString(TEXT("first")));
+	TestEqual(TEXT("String after the cook"), SecondValue, FString(TEXT("second")));
+
+	return true;
+}
+
+#endif
@@ -54,6 +54,154 @@
 #include "HoudiniHLODLayerUtils.h"
 #include "HoudiniLandscapeUtils.h"
 
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
+
+// Number of Houdini rows converted per task when converting landscape heights to heightfield values
+static constexpr int32 HoudiniHeightfieldConvertBlockSize = 64;
+
+// Maximum number of values sent per HAPI call when sending the changed tiles of a volume
+static constexpr int32 HoudiniHeightfieldMaxSegmentSize = 10 * 1024 * 1024 / sizeof(float);
+
+// A volume sent for a landscape heightfield input, and the hashes of its tiles when it was last sent
+struct FHoudiniHeightfieldVolumeState
+{
+	HAPI_NodeId NodeId = -1;
+	TArray<uint64> TileHashes;
+};
+
+// What was sent for a landscape heightfield input, used to only send the tiles that changed when the
+// landscape is edited, instead of recreating the whole heightfield.
+struct FHoudiniHeightfieldExportState
+{
+	TWeakObjectPtr<ALandscapeProxy> LandscapeProxy;
+	int32 UniqueHoudiniNodeId = -1;
+
+	// Size of the volumes (Houdini's X/Y), tiles are the size of the landscape components
+	int32 XSize = 0;
+	int32 YSize = 0;
+	int32 TileSize = 0;
+
+	FVector3d LandscapeScale = FVector3d::OneVector;
+	uint32 AttributesHash = 0;
+	bool bExportHeightDataPerEditLayer = false;
+	bool bExportPaintLayersPerEditLayer = false;
+	bool bExportMergedPaintLayers = false;
+
+	// The volumes of the heightfield, by name
+	TMap<FString, FHoudiniHeightfieldVolumeState> Volumes;
+};
+
+// The heightfield inputs created from a whole landscape, by heightfield node id
+static TMap<HAPI_NodeId, FHoudiniHeightfieldExportState> HeightfieldExportStates;
+
+// Set while CreateHeightfieldFromLandscape is sending a heightfield: SetHeightfieldData records the volumes it sends
+static FHoudiniHeightfieldExportState* RecordingHeightfieldExportState = nullptr;
+
+// Hashes the landscape properties sent as heightfield attributes. The heightfield needs to be recreated if they change.
+static uint32
+GetHeightfieldAttributesHash(ALandscapeProxy* LandscapeProxy)
+{
+	uint32 Hash = GetTypeHash(GetPathNameSafe(LandscapeProxy->GetLandscapeMaterial()));
+	Hash = HashCombine(Hash, GetTypeHash(GetPathNameSafe(LandscapeProxy->GetLandscapeHoleMaterial())));
+	Hash = HashCombine(Hash, GetTypeHash(GetPathNameSafe(LandscapeProxy->DefaultPhysMaterial)));
+	Hash = HashCombine(Hash, GetTypeHash(GetPathNameSafe(LandscapeProxy->GetLevel())));
+	for (const FName& Tag : LandscapeProxy->Tags)
+		Hash = HashCombine(Hash, GetTypeHash(Tag));
+
+	return Hash;
+}
+
+// Computes the hash of each InTileSize x InTileSize tile of a volume's values
+static void
+ComputeHeightfieldTileHashes(
+	const TArray<float>& InValues,
+	const int32 InXSize,
+	const int32 InYSize,
+	const int32 InTileSize,
+	TArray<uint64>& OutTileHashes)
+{
+	const int32 NumTilesX = FMath::DivideAndRoundUp(InXSize, InTileSize);
+	const int32 NumTilesY = FMath::DivideAndRoundUp(InYSize, InTileSize);
+	OutTileHashes.SetNumZeroed(NumTilesX * NumTilesY);
+	if (InValues.Num() != InXSize * InYSize)
+		return;
+
+	ParallelFor(NumTilesY, [&](int32 TileY)
+	{
+		const int32 EndY = FMath::Min((TileY + 1) * InTileSize, InYSize);
+		for (int32 Y = TileY * InTileSize; Y < EndY; Y++)
+		{
+			for (int32 TileX = 0; TileX < NumTilesX; TileX++)
+			{
+				const int32 StartX = TileX * InTileSize;
+				const int32 Count = FMath::Min(InTileSize, InXSize - StartX);
+				uint64& TileHash = OutTileHashes[TileX + TileY * NumTilesX];
+				TileHash = CityHash64WithSeed((const char*)&InValues[StartX + Y * InXSize], Count * sizeof(float), TileHash);
+			}
+		}
+	});
+}
+
+// Sends the values of the dirty tiles of a volume.
+// The rows of the tiles are sent as contiguous segments, merged when they follow each other.
+static bool
+SetHeightfieldDataTiles(
+	const HAPI_NodeId& InNodeId,
+	const FString& InVolumeName,
+	const TArray<float>& InValues,
+	const int32 InXSize,
+	const int32 InYSize,
+	const int32 InTileSize,
+	const TBitArray<>& InDirtyTiles)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(SetHeightfieldDataTiles);
+
+	std::string NameStr;
+	FHoudiniEngineUtils::ConvertUnrealString(InVolumeName, NameStr);
+
+	int32 SegmentStart = 0;
+	int32 SegmentEnd = 0;
+	auto SendSegment = [&]()
+	{
+		if (SegmentEnd <= SegmentStart)
+			return true;
+
+		const HAPI_Result Result = FHoudiniApi::SetHeightFieldData(
+			FHoudiniEngine::Get().GetSession(),
+			InNodeId, 0, NameStr.c_str(), &InValues[SegmentStart], SegmentStart, SegmentEnd - SegmentStart);
+		SegmentStart = SegmentEnd = 0;
+		return Result == HAPI_RESULT_SUCCESS;
+	};
+
+	const int32 NumTilesX = FMath::DivideAndRoundUp(InXSize, InTileSize);
+	for (int32 Y = 0; Y < InYSize; Y++)
+	{
+		const int32 TileY = Y / InTileSize;
+		for (int32 TileX = 0; TileX < NumTilesX; TileX++)
+		{
+			if (!InDirtyTiles[TileX + TileY * NumTilesX])
+				continue;
+
+			const int32 Start = TileX * InTileSize + Y * InXSize;
+			const int32 End = Start + FMath::Min(InTileSize, InXSize - TileX * InTileSize);
+			if (Start == SegmentEnd && End - SegmentStart <= HoudiniHeightfieldMaxSegmentSize)
+			{
+				SegmentEnd = End;
+				continue;
+			}
+
+			if (!SendSegment())
+				return false;
+
+			SegmentStart = Start;
+			SegmentEnd = End;
+		}
+	}
+
+	return SendSegment();
+}
+
 
 bool 
 FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
@@ -334,6 +482,18 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 	if (!CreateHeightfieldInputNode(NodeName, XSize, YSize, HeightFieldId, HeightId, MaskId, MergeId, ParentNodeId))
 		return false;
 
+	// Record the volumes sent to the heightfield, so that UpdateHeightfieldFromLandscape can send only the tiles that changed
+	FHoudiniHeightfieldExportState ExportState;
+	ExportState.LandscapeProxy = LandscapeProxy;
+	ExportState.XSize = HeightfieldVolumeInfo.xLength;
+	ExportState.YSize = HeightfieldVolumeInfo.yLength;
+	ExportState.TileSize = FMath::Max(LandscapeProxy->ComponentSizeQuads, 1);
+	ExportState.LandscapeScale = LandscapeActorTransform.GetScale3D();
+	ExportState.AttributesHash = GetHeightfieldAttributesHash(LandscapeProxy);
+	ExportState.bExportHeightDataPerEditLayer = Options.bExportHeightDataPerEditLayer;
+	ExportState.bExportPaintLayersPerEditLayer = Options.bExportPaintLayersPerEditLayer;
+	ExportState.bExportMergedPaintLayers = Options.bExportMergedPaintLayers;
+	TGuardValue<FHoudiniHeightfieldExportState*> RecordingGuard(RecordingHeightfieldExportState, &ExportState);
 
 	//--------------------------------------------------------------------------------------------------
 	// Set the HeightfieldData in Houdini
@@ -526,6 +686,227 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 
 	CreatedHeightfieldNodeId = HeightFieldId;
 
+	HAPI_NodeInfo HeightFieldNodeInfo;
+	FHoudiniApi::NodeInfo_Init(&HeightFieldNodeInfo);
+	if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetNodeInfo(FHoudiniEngine::Get().GetSession(), HeightFieldId, &HeightFieldNodeInfo))
+	{
+		// Forget the heightfields that have been deleted since they were created
+		for (auto It = HeightfieldExportStates.CreateIterator(); It; ++It)
+		{
+			if (!It->Value.LandscapeProxy.IsValid() || !FHoudiniEngineUtils::IsHoudiniNodeValid(It->Key))
+				It.RemoveCurrent();
+		}
+
+		ExportState.UniqueHoudiniNodeId = HeightFieldNodeInfo.uniqueHoudiniNodeId;
+		HeightfieldExportStates.Add(HeightFieldId, MoveTemp(ExportState));
+	}
+
+	return true;
+}
+
+bool
+FUnrealLandscapeTranslator::UpdateHeightfieldFromLandscape(
+	ALandscapeProxy* LandscapeProxy,
+	const FHoudiniLandscapeExportOptions& Options,
+	const HAPI_NodeId& HeightFieldId)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUnrealLandscapeTranslator::UpdateHeightfieldFromLandscape);
+
+	if (!IsValid(LandscapeProxy))
+		return false;
+
+	FHoudiniHeightfieldExportState* State = HeightfieldExportStates.Find(HeightFieldId);
+	if (!State)
+		return false;
+
+	// The node id could have been reused by another node since the heightfield was created
+	HAPI_NodeInfo HeightFieldNodeInfo;
+	FHoudiniApi::NodeInfo_Init(&HeightFieldNodeInfo);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetNodeInfo(FHoudiniEngine::Get().GetSession(), HeightFieldId, &HeightFieldNodeInfo)
+		|| HeightFieldNodeInfo.uniqueHoudiniNodeId != State->UniqueHoudiniNodeId)
+	{
+		return false;
+	}
+
+	// The heightfield needs to be recreated if its options or attributes changed
+	ALandscape* Landscape = LandscapeProxy->GetLandscapeActor();
+	if (!IsValid(Landscape)
+		|| State->LandscapeProxy.Get() != LandscapeProxy
+		|| State->bExportHeightDataPerEditLayer != Options.bExportHeightDataPerEditLayer
+		|| State->bExportPaintLayersPerEditLayer != Options.bExportPaintLayersPerEditLayer
+		|| State->bExportMergedPaintLayers != Options.bExportMergedPaintLayers
+		|| State->AttributesHash != GetHeightfieldAttributesHash(LandscapeProxy))
+	{
+		return false;
+	}
+
+	const FVector3d LandscapeScale = Landscape->GetActorTransform().GetScale3D();
+	if (!LandscapeScale.Equals(State->LandscapeScale))
+		return false;
+
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+	if (!LandscapeInfo)
+		return false;
+
+	TSet<FString> UpdatedVolumes;
+	bool bVolumesChanged = false;
+
+	// Sends the tiles of a volume that changed since it was last sent.
+	// Fails if the volume wasn't sent when the heightfield was created.
+	auto UpdateVolume = [&](const FString& VolumeName, const TArray<float>& Values)
+	{
+		FHoudiniHeightfieldVolumeState* VolumeState = State->Volumes.Find(VolumeName);
+		if (!VolumeState || UpdatedVolumes.Contains(VolumeName) || Values.Num() != State->XSize * State->YSize)
+			return false;
+
+		UpdatedVolumes.Add(VolumeName);
+
+		TArray<uint64> TileHashes;
+		ComputeHeightfieldTileHashes(Values, State->XSize, State->YSize, State->TileSize, TileHashes);
+		if (TileHashes.Num() != VolumeState->TileHashes.Num())
+			return false;
+
+		TBitArray<> DirtyTiles(false, TileHashes.Num());
+		int32 NumDirtyTiles = 0;
+		for (int32 TileIdx = 0; TileIdx < TileHashes.Num(); TileIdx++)
+		{
+			if (TileHashes[TileIdx] != VolumeState->TileHashes[TileIdx])
+			{
+				DirtyTiles[TileIdx] = true;
+				NumDirtyTiles++;
+			}
+		}
+
+		if (NumDirtyTiles <= 0)
+			return true;
+
+		HOUDINI_LANDSCAPE_MESSAGE(TEXT("[FUnrealLandscapeTranslator::UpdateHeightfieldFromLandscape] Sending %d/%d tiles of %s"),
+			NumDirtyTiles, TileHashes.Num(), *VolumeName);
+
+		if (!SetHeightfieldDataTiles(VolumeState->NodeId, VolumeName, Values, State->XSize, State->YSize, State->TileSize, DirtyTiles))
+			return false;
+
+		if (HAPI_RESULT_SUCCESS != FHoudiniEngineUtils::HapiCommitGeo(VolumeState->NodeId))
+			return false;
+
+		VolumeState->TileHashes = MoveTemp(TileHashes);
+		bVolumesChanged = true;
+		return true;
+	};
+
+	// The volumes are extracted the same way CreateHeightfieldFromLandscape does
+
+	// Height
+	int32 XSize, YSize;
+	FVector Min, Max;
+	{
+		TArray<uint16> HeightData;
+		if (!GetLandscapeData(LandscapeProxy, HeightData, XSize, YSize, Min, Max))
+			return false;
+
+		TArray<float> HeightfieldFloatValues;
+		HAPI_VolumeInfo HeightfieldVolumeInfo;
+		FHoudiniApi::VolumeInfo_Init(&HeightfieldVolumeInfo);
+		if (!ConvertLandscapeDataToHeightFieldData(HeightData, XSize, YSize, Min, Max, LandscapeScale, HeightfieldFloatValues, HeightfieldVolumeInfo))
+			return false;
+
+		if (!UpdateVolume(TEXT("height"), HeightfieldFloatValues))
+			return false;
+	}
+
+	// Combined target layers
+	if (Options.bExportMergedPaintLayers)
+	{
+		for (int32 TargetLayerIndex = 0; TargetLayerIndex < LandscapeInfo->Layers.Num(); TargetLayerIndex++)
+		{
+			TArray<uint8> LayerData;
+			FLinearColor TargetLayerDebugColor;
+			FString TargetLayerName;
+			if (!GetLandscapeTargetLayerData(LandscapeProxy, LandscapeInfo, TargetLayerIndex, LayerData, TargetLayerDebugColor, TargetLayerName))
+				continue;
+
+			TArray<float> CurrentLayerFloatData;
+			if (!ConvertLandscapeLayerDataToHeightfieldData(LayerData, XSize, YSize, TargetLayerDebugColor, CurrentLayerFloatData))
+				continue;
+
+			if (!UpdateVolume(TargetLayerName, CurrentLayerFloatData))
+				return false;
+		}
+	}
+
+	// Default mask, when no target layer is the mask
+	if (!UpdatedVolumes.Contains(TEXT("mask")))
+	{
+		TArray<float> MaskFloatData;
+		MaskFloatData.SetNumZeroed(State->XSize * State->YSize);
+		if (!UpdateVolume(TEXT("mask"), MaskFloatData))
+			return false;
+	}
+
+	// Target layers of each edit layer
+	if (Options.bExportPaintLayersPerEditLayer)
+	{
+		const FHoudiniExtents Extents = FHoudiniLandscapeUtils::GetLandscapeExtents(LandscapeProxy);
+		for (int32 EditLayerIndex = 0; EditLayerIndex < Landscape->GetLayerCount(); EditLayerIndex++)
+		{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5
+			const FName& EditLayerName = Landscape->GetLayerConst(EditLayerIndex)->Name;
+#else
+			const FName& EditLayerName = Landscape->GetLayer(EditLayerIndex)->Name;
+#endif
+			for (int32 TargetLayerIndex = 0; TargetLayerIndex < LandscapeInfo->Layers.Num(); TargetLayerIndex++)
+			{
+				const FName& TargetLayerName = LandscapeInfo->Layers[TargetLayerIndex].GetLayerName();
+				TArray<uint8_t> LayerData = FHoudiniLandscapeUtils::GetLayerData(Landscape, Extents, EditLayerName, TargetLayerName);
+
+				ULandscapeLayerInfoObject* LayerInfoObject = LandscapeInfo->GetLayerInfoByName(TargetLayerName);
+				FLinearColor Color = LayerInfoObject ? LayerInfoObject->LayerUsageDebugColor : FLinearColor::White;
+
+				TArray<float> CurrentLayerFloatData;
+				if (!ConvertLandscapeLayerDataToHeightfieldData(LayerData, XSize, YSize, Color, CurrentLayerFloatData))
+					continue;
+
+				const FString LayerName = FString::Format(TEXT("landscapelayer_{0}_{1}"), { EditLayerName.ToString(), TargetLayerName.ToString() });
+				if (!UpdateVolume(LayerName, CurrentLayerFloatData))
+					return false;
+			}
+		}
+	}
+
+	// Height of each edit layer
+	if (Options.bExportHeightDataPerEditLayer)
+	{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5	
+		for (const FLandscapeLayer& Layer : Landscape->GetLayers())
+#else
+		for (FLandscapeLayer& Layer : Landscape->LandscapeLayers)
+#endif
+		{
+			FScopedSetLandscapeEditingLayer Scope(Landscape, Layer.Guid);
+
+			TArray<uint16> LayerHeightData;
+			if (!GetLandscapeData(LandscapeProxy, LayerHeightData, XSize, YSize, Min, Max))
+				return false;
+
+			TArray<float> LayerHeightFloatData;
+			HAPI_VolumeInfo LayerVolumeInfo;
+			FHoudiniApi::VolumeInfo_Init(&LayerVolumeInfo);
+			if (!ConvertLandscapeDataToHeightFieldData(LayerHeightData, XSize, YSize, Min, Max, LandscapeScale, LayerHeightFloatData, LayerVolumeInfo))
+				return false;
+
+			const FString LayerVolumeName = FString::Format(TEXT("landscapelayer_{0}"), { Layer.Name.ToString() });
+			if (!UpdateVolume(LayerVolumeName, LayerHeightFloatData))
+				return false;
+		}
+	}
+
+	// Layers were added or removed
+	if (UpdatedVolumes.Num() != State->Volumes.Num())
+		return false;
+
+	if (bVolumesChanged && !FHoudiniEngineUtils::HapiCookNode(HeightFieldId, nullptr, true))
+		return false;
+
 	return true;
 }
 
@@ -866,6 +1247,27 @@ FUnrealLandscapeTranslator::CreateInputNodeForLandscapeObject(
 			InputNodeId = -1;
 		}
 
+		// When the whole landscape is exported as a heightfield, try to only send the tiles that changed
+		// to the existing heightfield instead of recreating it
+		if (ExportType == EHoudiniLandscapeExportType::Heightfield && InputNodeId >= 0
+			&& (!bExportSelectionOnly || SelectedComponents.Num() == InLandscape->LandscapeComponents.Num()))
+		{
+			FHoudiniLandscapeExportOptions ExportOptions;
+			ExportOptions.bExportHeightDataPerEditLayer = InInput->IsEditLayerHeightExportEnabled();
+			ExportOptions.bExportMergedPaintLayers = InInput->IsMergedPaintLayerExportEnabled();
+			ExportOptions.bExportPaintLayersPerEditLayer = InInput->IsPaintLayerPerEditLayerExportEnabled();
+
+			if (UpdateHeightfieldFromLandscape(InLandscape, ExportOptions, InputNodeId))
+			{
+				FUnrealObjectInputHandle UpdatedHandle;
+				HAPI_NodeId InputObjectNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(InputNodeId);
+				if (FUnrealObjectInputUtils::AddNodeOrUpdateNode(Identifier, InputNodeId, UpdatedHandle, InputObjectNodeId, nullptr, bInputNodesCanBeDeleted))
+					OutHandle = UpdatedHandle;
+
+				return true;
+			}
+		}
+
 		HAPI_NodeId GeoObjNodeId = -1;
 
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateNode(
@@ -878,6 +1280,7 @@ FUnrealLandscapeTranslator::CreateInputNodeForLandscapeObject(
 		{
 			// Get the parent OBJ node ID before deleting!
 			HAPI_NodeId PreviousInputOBJNode = FHoudiniEngineUtils::HapiGetParentNodeId(InputNodeId);
+			HeightfieldExportStates.Remove(InputNodeId);
 
 			if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
 				FHoudiniEngine::Get().GetSession(), InputNodeId))
@@ -1268,23 +1671,31 @@ FUnrealLandscapeTranslator::ConvertLandscapeDataToHeightFieldData(
 	double ZCenterOffset = 32767;
 
 	// Convert the Int data to Float
+	// We need to invert X/Y when reading the value from Unreal, so this is a transposition:
+	// process blocks of Houdini rows in parallel, and read each Unreal row segment contiguously
+	// so that the inner loop can be vectorized.
 	HeightfieldFloatValues.SetNumUninitialized(SizeInPoints);
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
+	const uint16* UnrealValues = IntHeightData.GetData();
+	float* HoudiniValues = HeightfieldFloatValues.GetData();
+	const int32 NumBlocks = FMath::DivideAndRoundUp(HoudiniYSize, HoudiniHeightfieldConvertBlockSize);
+	ParallelFor(NumBlocks, [&](int32 BlockIdx)
 	{
+		const int32 StartY = BlockIdx * HoudiniHeightfieldConvertBlockSize;
+		const int32 EndY = FMath::Min(StartY + HoudiniHeightfieldConvertBlockSize, HoudiniYSize);
 		for (int32 nX = 0; nX < HoudiniXSize; nX++)
 		{
-			// We need to invert X/Y when reading the value from Unreal
-			int32 nHoudini = nX + nY * HoudiniXSize;
-			int32 nUnreal = nY + nX * XSize;
-
-			// Convert the int values to meter
-			// Unreal's digit value have a zero value of 32768
-			// Don't apply z-position offsets to the data. This offset will be applied to the
-			// heighfield primitive itself in Houdini.
-			double DoubleValue = ((double)IntHeightData[nUnreal] - ZCenterOffset) * ZSpacing;
-			HeightfieldFloatValues[nHoudini] = (float)DoubleValue;
+			const uint16* UnrealRow = UnrealValues + nX * XSize;
+			float* HoudiniColumn = HoudiniValues + nX;
+			for (int32 nY = StartY; nY < EndY; nY++)
+			{
+				// Convert the int values to meter
+				// Unreal's digit value have a zero value of 32768
+				// Don't apply z-position offsets to the data. This offset will be applied to the
+				// heighfield primitive itself in Houdini.
+				HoudiniColumn[nY * HoudiniXSize] = (float)(((double)UnrealRow[nY] - ZCenterOffset) * ZSpacing);
+			}
 		}
-	}
+	}, NumBlocks <= 1);
 
 	//--------------------------------------------------------------------------------------------------
 	// Set the Hapi Transform. Houdini expects the scale to be set here, but we set the position
@@ -1401,6 +1812,15 @@ FUnrealLandscapeTranslator::SetHeightfieldData(
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiSetHeightFieldData(
 		GeoInfo.nodeId, PartInfo.id, FloatValues, HeightfieldName), false);
 
+	// Keep the hashes of the volume's tiles, so that only the tiles that change are sent on the next update
+	if (RecordingHeightfieldExportState)
+	{
+		FHoudiniHeightfieldVolumeState& VolumeState = RecordingHeightfieldExportState->Volumes.FindOrAdd(HeightfieldName);
+		VolumeState.NodeId = VolumeNodeId;
+		ComputeHeightfieldTileHashes(
+			FloatValues, VolumeInfo.xLength, VolumeInfo.yLength, RecordingHeightfieldExportState->TileSize, VolumeState.TileHashes);
+	}
+
 	return true;
 }
 
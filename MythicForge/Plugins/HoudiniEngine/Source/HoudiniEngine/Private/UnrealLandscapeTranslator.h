@@ -56,6 +56,14 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			HAPI_NodeId ParentNodeId,
 			bool bSetObjectTransformToWorldTransform);
 
+		// Updates a heightfield previously created by CreateHeightfieldFromLandscape by only sending
+		// the tiles (landscape component sized) of its volumes that changed since they were last sent.
+		// Returns false if the heightfield needs to be recreated (unknown node, size/options/attributes/layers changed).
+		static bool UpdateHeightfieldFromLandscape(
+			ALandscapeProxy* LandscapeProxy,
+			const FHoudiniLandscapeExportOptions& Options,
+			const HAPI_NodeId& HeightFieldId);
+
 		static bool CreateHeightfieldFromLandscapeComponentArray(
 			ALandscapeProxy* LandscapeProxy,
 			const TSet< ULandscapeComponent * > & SelectedComponents,
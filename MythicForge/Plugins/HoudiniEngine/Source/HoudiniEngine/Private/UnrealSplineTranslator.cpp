@@ -179,7 +179,10 @@ FUnrealSplineTranslator::CreateInputNodeForSplineComponent(
 		false,
 		false, 
 		FTransform::Identity,
-		bUseLegacy))
+		bUseLegacy,
+		2,
+		EHoudiniCurveBreakpointParameterization::Uniform,
+		false))
 	{
 		HOUDINI_LOG_ERROR(TEXT("Failed to create the input curve data!"));
 		return false;
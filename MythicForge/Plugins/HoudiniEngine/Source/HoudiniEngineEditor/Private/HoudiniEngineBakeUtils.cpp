@@ -95,7 +95,9 @@
 	#include "GeometryCollectionEngine/Public/GeometryCollection/GeometryCollectionObject.h"	
 #endif
 #include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
 #include "InstancedFoliageActor.h"
+#include "ISourceControlModule.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/ComponentEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
@@ -116,6 +118,7 @@
 #include "Materials/MaterialExpressionTextureSample.h" 
 #include "Materials/MaterialInstance.h"
 #include "Math/Box.h"
+#include "Misc/PackageName.h"
 #include "Misc/Paths.h"
 #include "Misc/ScopedSlowTask.h"
 #include "PackageTools.h"
@@ -126,7 +129,9 @@
 #include "SkeletalMeshTypes.h"
 #include "Sound/SoundBase.h"
 #include "UObject/MetaData.h"
+#include "UObject/ObjectSaveContext.h"
 #include "UObject/Package.h"
+#include "UObject/SavePackage.h"
 #include "UObject/UnrealType.h"
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION > 1
 	#include "Engine/SkinnedAssetCommon.h"
@@ -163,6 +168,14 @@ HOUDINI_BAKING_DEFINE_LOG_CATEGORY();
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineConcurrentBakeSave(
+	TEXT("HoudiniEngine.ConcurrentBakeSave"),
+	1,
+	TEXT("Saves the asset packages created by a bake concurrently.\n")
+	TEXT("0: Save all the baked packages one by one on the game thread\n")
+	TEXT("1: Serialize the baked asset packages in parallel: Default\n")
+);
+
 
 FHoudiniEngineBakeState::FHoudiniEngineBakeState(const int32 InNumOutputs, const TArray<FHoudiniBakedOutput>& InOldBakedOutputs)
 {
@@ -4796,6 +4809,9 @@ FHoudiniEngineBakeUtils::BakeBlueprints(UHoudiniAssetComponent* HoudiniAssetComp
 	}
 	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData.PackagesToSave);
 
+	// Collect the garbage left by the bake once everything has been saved
+	TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
 	// Sync the CB to the baked objects
 	if(GEditor && BakedObjectData.Blueprints.Num() > 0)
 	{
@@ -4813,8 +4829,6 @@ FHoudiniEngineBakeUtils::BakeBlueprints(UHoudiniAssetComponent* HoudiniAssetComp
 		FString Msg = FString::Format(*FinishedTemplate, { BakedObjectData.BakeStats.NumPackagesCreated, BakedObjectData.BakeStats.NumPackagesUpdated } );
 		FHoudiniEngine::Get().FinishTaskSlateNotification( FText::FromString(Msg) );
 	}
-	
-	TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
 
 	// Broadcast that the bake is complete
 	HoudiniAssetComponent->HandleOnPostBake(bSuccess);
@@ -6774,6 +6788,8 @@ FHoudiniEngineBakeUtils::DeleteBakedHoudiniAssetActor(UHoudiniAssetComponent* Ho
 void 
 FHoudiniEngineBakeUtils::SaveBakedPackages(TArray<UPackage*> & PackagesToSave, bool bSaveCurrentWorld) 
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineBakeUtils::SaveBakedPackages);
+
 	UWorld * CurrentWorld = nullptr;
 	if (bSaveCurrentWorld && GEditor)
 		CurrentWorld = GEditor->GetEditorWorldContext().World();
@@ -6791,7 +6807,122 @@ FHoudiniEngineBakeUtils::SaveBakedPackages(TArray<UPackage*> & PackagesToSave, b
 		}
 	}
 
-	FEditorFileUtils::PromptForCheckoutAndSave(PackagesToSave, true, false);
+	// The same package can be added several times by the bake
+	TArray<UPackage*> DirtyPackages;
+	TSet<UPackage*> UniquePackages;
+	for (UPackage* Package : PackagesToSave)
+	{
+		if (!IsValid(Package) || !Package->IsDirty())
+			continue;
+
+		bool bAlreadyInSet = false;
+		UniquePackages.Add(Package, &bAlreadyInSet);
+		if (!bAlreadyInSet)
+			DirtyPackages.Add(Package);
+	}
+
+	if (DirtyPackages.Num() <= 0)
+		return;
+
+	// Only new asset packages, never loaded from nor written to disk, are serialized concurrently.
+	// Packages that already exist (loaders to reset, read-only files, checkouts), maps and external
+	// actors go through the editor's save.
+	TArray<UPackage*> SequentialPackages;
+	TArray<FPackageSaveInfo> ConcurrentPackages;
+	const bool bSaveConcurrently = CVarHoudiniEngineConcurrentBakeSave.GetValueOnGameThread() != 0
+		&& !ISourceControlModule::Get().IsEnabled();
+	for (UPackage* Package : DirtyPackages)
+	{
+		UObject* Asset = bSaveConcurrently ? Package->FindAssetInPackage() : nullptr;
+		if (!Asset || Package->HasAnyPackageFlags(PKG_ContainsMap | PKG_ContainsMapData) || Package->GetLinker() != nullptr)
+		{
+			SequentialPackages.Add(Package);
+			continue;
+		}
+
+		const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+		if (IFileManager::Get().FileExists(*Filename))
+		{
+			SequentialPackages.Add(Package);
+			continue;
+		}
+
+		FPackageSaveInfo& SaveInfo = ConcurrentPackages.AddDefaulted_GetRef();
+		SaveInfo.Package = Package;
+		SaveInfo.Asset = Asset;
+		SaveInfo.Filename = Filename;
+	}
+
+	// Save the packages in chunks to be able to report progress
+	static const int32 ConcurrentSaveChunkSize = 64;
+	const int32 NumChunks = FMath::DivideAndRoundUp(ConcurrentPackages.Num(), ConcurrentSaveChunkSize);
+	FScopedSlowTask Progress(NumChunks + 1, FText::FromString(FString::Printf(TEXT("Saving %d baked packages ..."), DirtyPackages.Num())));
+
+	int32 NumSavedConcurrently = 0;
+	int64 SavedConcurrentlySize = 0;
+	double ConcurrentSaveTime = 0.0;
+	if (ConcurrentPackages.Num() > 0)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineBakeUtils::SaveBakedPackages_Concurrent);
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Standalone;
+		SaveArgs.SaveFlags = SAVE_NoError | SAVE_Concurrent;
+		SaveArgs.Error = GWarn;
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 ChunkStart = 0; ChunkStart < ConcurrentPackages.Num(); ChunkStart += ConcurrentSaveChunkSize)
+		{
+			Progress.EnterProgressFrame(1.0f);
+
+			const int32 ChunkNum = FMath::Min(ConcurrentSaveChunkSize, ConcurrentPackages.Num() - ChunkStart);
+			TArrayView<FPackageSaveInfo> Chunk(ConcurrentPackages.GetData() + ChunkStart, ChunkNum);
+
+			TArray<FSavePackageResultStruct> Results;
+			UPackage::SaveConcurrent(Chunk, SaveArgs, Results);
+			for (int32 Idx = 0; Idx < Chunk.Num(); Idx++)
+			{
+				if (Results.IsValidIndex(Idx) && Results[Idx].Result == ESavePackageResult::Success)
+				{
+					Chunk[Idx].Package->SetDirtyFlag(false);
+					SavedConcurrentlySize += Results[Idx].TotalFileSize;
+					NumSavedConcurrently++;
+
+					// Send the notification the editor's save would have sent
+					FObjectSaveContextData SaveContextData(Chunk[Idx].Package, nullptr, *Chunk[Idx].Filename, SaveArgs.SaveFlags);
+					UPackage::PackageSavedWithContextEvent.Broadcast(Chunk[Idx].Filename, Chunk[Idx].Package, FObjectPostSaveContext(SaveContextData));
+				}
+				else
+				{
+					// Let the editor's save handle (and report) the failure
+					SequentialPackages.Add(Chunk[Idx].Package);
+				}
+			}
+		}
+		ConcurrentSaveTime = FPlatformTime::Seconds() - StartTime;
+	}
+
+	Progress.EnterProgressFrame(1.0f);
+	double SequentialSaveTime = 0.0;
+	if (SequentialPackages.Num() > 0)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineBakeUtils::SaveBakedPackages_Sequential);
+
+		const double StartTime = FPlatformTime::Seconds();
+		FEditorFileUtils::PromptForCheckoutAndSave(SequentialPackages, true, false);
+		SequentialSaveTime = FPlatformTime::Seconds() - StartTime;
+	}
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Saved %d baked packages: %d concurrently (%.2f MB) in %.3fs (%.2f ms per package), %d sequentially in %.3fs (%.2f ms per package)."),
+		DirtyPackages.Num(),
+		NumSavedConcurrently,
+		SavedConcurrentlySize / (1024.0 * 1024.0),
+		ConcurrentSaveTime,
+		NumSavedConcurrently > 0 ? ConcurrentSaveTime * 1000.0 / NumSavedConcurrently : 0.0,
+		SequentialPackages.Num(),
+		SequentialSaveTime,
+		SequentialPackages.Num() > 0 ? SequentialSaveTime * 1000.0 / SequentialPackages.Num() : 0.0);
 }
 
 bool
@@ -8363,6 +8494,9 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeBlueprints(UHoudiniPDGAssetLink* InPDGAss
 	}
 	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData.PackagesToSave);
 
+	// Collect the garbage left by the bake once everything has been saved
+	TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
 	// Sync the CB to the baked objects
 	if(GEditor && BakedObjectData.Blueprints.Num() > 0)
 	{
@@ -8380,8 +8514,6 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeBlueprints(UHoudiniPDGAssetLink* InPDGAss
 		FString Msg = FString::Format(*FinishedTemplate, { BakedObjectData.BakeStats.NumPackagesCreated, BakedObjectData.BakeStats.NumPackagesUpdated } );
 		FHoudiniEngine::Get().FinishTaskSlateNotification( FText::FromString(Msg) );
 	}
-	
-	TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
 
 	return bSuccess;
 }
@@ -8477,6 +8609,9 @@ FHoudiniEngineBakeUtils::BakePDGAssetLinkBlueprints(UHoudiniPDGAssetLink* InPDGA
 	}
 	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData.PackagesToSave);
 
+	// Collect the garbage left by the bake once everything has been saved
+	TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
 	// Sync the CB to the baked objects
 	if(GEditor && BakedObjectData.Blueprints.Num() > 0)
 	{
@@ -8494,8 +8629,6 @@ FHoudiniEngineBakeUtils::BakePDGAssetLinkBlueprints(UHoudiniPDGAssetLink* InPDGA
 		FString Msg = FString::Format(*FinishedTemplate, { BakedObjectData.BakeStats.NumPackagesCreated, BakedObjectData.BakeStats.NumPackagesUpdated } );
 		FHoudiniEngine::Get().FinishTaskSlateNotification( FText::FromString(Msg) );
 	}
-	
-	TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
 
 	// Broadcast that the bake is complete
 	InPDGAssetLink->HandleOnPostBake(bSuccess);
@@ -738,6 +738,8 @@ public:
 
 	static bool DeleteBakedHoudiniAssetActor(UHoudiniAssetComponent* HoudiniAssetComponent);
 
+	// Saves the dirty baked packages. New asset packages are serialized concurrently, while maps
+	// and packages that already exist on disk go through the editor's save.
 	static void SaveBakedPackages(TArray<UPackage*> & PackagesToSave, bool bSaveCurrentWorld = false);
 
 	// Look for InObjectToFind among InOutputs. Return true if found and set OutOutputIndex and OutIdentifier.
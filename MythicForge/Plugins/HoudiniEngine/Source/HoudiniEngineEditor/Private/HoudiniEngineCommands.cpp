@@ -570,6 +570,9 @@ FHoudiniEngineCommands::BakeAllAssets()
 
 	// Bakes and replaces with blueprints all Houdini Assets in the current level
 	int32 BakedCount = 0;
+
+	// Save the packages of all the bakes at once, once everything has been baked
+	TArray<UPackage*> PackagesToSave;
 	for (TObjectIterator<UHoudiniAssetComponent> Itr; Itr; ++Itr)
 	{
 		UHoudiniAssetComponent * HoudiniAssetComponent = *Itr;
@@ -608,7 +611,7 @@ FHoudiniEngineCommands::BakeAllAssets()
 			BakeOptions.bRecenterBakedActors = HoudiniAssetComponent->bRecenterBakedActors;
 
 			bSuccess = FHoudiniEngineBakeUtils::BakeBlueprints(HoudiniAssetComponent, BakeOptions, BakeOutputs);
-			FHoudiniEngineBakeUtils::SaveBakedPackages(BakeOutputs.PackagesToSave);
+			PackagesToSave.Append(BakeOutputs.PackagesToSave);
 			
 			if (bSuccess)
 			{
@@ -656,6 +659,11 @@ FHoudiniEngineCommands::BakeAllAssets()
 			BakedCount++;
 	}
 
+	FHoudiniEngineBakeUtils::SaveBakedPackages(PackagesToSave);
+
+	// Collect the garbage left by all the bakes once everything has been saved
+	TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
 	// Add a slate notification
 	Notification = TEXT("Baked ") + FString::FromInt(BakedCount) + TEXT(" Houdini assets.");
 	FHoudiniEngineUtils::CreateSlateNotification(Notification);
@@ -864,6 +872,9 @@ FHoudiniEngineCommands::BakeSelection()
 
 	// Iterates over the selection and rebuilds the assets if they're in a valid state
 	int32 BakedCount = 0;
+
+	// Save the packages of all the bakes at once, once everything has been baked
+	TArray<UPackage*> PackagesToSave;
 	for (int32 Idx = 0; Idx < SelectedHoudiniAssets; Idx++)
 	{
 		AHoudiniAssetActor * HoudiniAssetActor = Cast<AHoudiniAssetActor>(WorldSelection[Idx]);
@@ -901,7 +912,7 @@ FHoudiniEngineCommands::BakeSelection()
 			BakeOptions.bRecenterBakedActors = HoudiniAssetComponent->bRecenterBakedActors;
 
 			const bool bSuccess = FHoudiniEngineBakeUtils::BakeBlueprints(HoudiniAssetComponent, BakeOptions, BakeOutputs);
-			FHoudiniEngineBakeUtils::SaveBakedPackages(BakeOutputs.PackagesToSave);
+			PackagesToSave.Append(BakeOutputs.PackagesToSave);
 			
 			if (bSuccess)
 			{
@@ -930,6 +941,11 @@ FHoudiniEngineCommands::BakeSelection()
 		}
 	}
 
+	FHoudiniEngineBakeUtils::SaveBakedPackages(PackagesToSave);
+
+	// Collect the garbage left by all the bakes once everything has been saved
+	TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
 	// Add a slate notification
 	Notification = TEXT("Baked ") + FString::FromInt(BakedCount) + TEXT(" Houdini assets.");
 	FHoudiniEngineUtils::CreateSlateNotification(Notification);
@@ -0,0 +1,473 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniActorSpatialIndex.h"
+
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+#include "EngineUtils.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "UObject/UObjectGlobals.h"
+
+#if WITH_EDITOR
+	#include "Editor.h"
+#endif
+
+static TAutoConsoleVariable<float> CVarHoudiniEngineBoundSelectorCellSize(
+	TEXT("HoudiniEngine.BoundSelectorCellSize"),
+	10000.0f,
+	TEXT("Size (in cm) of the cells of the spatial index used to find the actors inside world input bound selectors.\n")
+	TEXT("10000.0: Default\n")
+);
+
+FHoudiniSpatialHashGrid::FHoudiniSpatialHashGrid(const double InCellSize, const int32 InMaxCellsPerElement)
+	: CellSize(FMath::Max(InCellSize, 1.0))
+	, MaxCellsPerElement(FMath::Max(InMaxCellsPerElement, 1))
+{
+}
+
+void
+FHoudiniSpatialHashGrid::Reset(const double InCellSize)
+{
+	CellSize = FMath::Max(InCellSize, 1.0);
+	Elements.Reset();
+	Cells.Reset();
+	OversizedElements.Reset();
+}
+
+FIntVector
+FHoudiniSpatialHashGrid::GetCell(const FVector& InPosition) const
+{
+	// Keep far away (or invalid) positions in the int32 range
+	auto ToCell = [this](const double InValue)
+	{
+		if (FMath::IsNaN(InValue))
+			return 0;
+
+		return (int32)FMath::Clamp(FMath::FloorToDouble(InValue / CellSize), (double)MIN_int32, (double)MAX_int32);
+	};
+
+	return FIntVector(ToCell(InPosition.X), ToCell(InPosition.Y), ToCell(InPosition.Z));
+}
+
+int64
+FHoudiniSpatialHashGrid::GetNumCells(const FIntVector& InMinCell, const FIntVector& InMaxCell)
+{
+	const double NumCells =
+		((double)InMaxCell.X - InMinCell.X + 1.0)
+		* ((double)InMaxCell.Y - InMinCell.Y + 1.0)
+		* ((double)InMaxCell.Z - InMinCell.Z + 1.0);
+
+	return (int64)FMath::Min(NumCells, (double)MAX_int64);
+}
+
+void
+FHoudiniSpatialHashGrid::Update(const int32 InId, const FBox& InBounds)
+{
+	FElement NewElement;
+	NewElement.Bounds = InBounds;
+	NewElement.MinCell = GetCell(InBounds.Min);
+	NewElement.MaxCell = GetCell(InBounds.Max);
+	NewElement.bOversized = GetNumCells(NewElement.MinCell, NewElement.MaxCell) > MaxCellsPerElement;
+
+	FElement* Element = Elements.Find(InId);
+	if (!Element)
+	{
+		Link(InId, Elements.Add(InId, NewElement));
+		return;
+	}
+
+	// Moved within the same cells, only the bounds need to be updated
+	if (Element->bOversized == NewElement.bOversized
+		&& Element->MinCell == NewElement.MinCell
+		&& Element->MaxCell == NewElement.MaxCell)
+	{
+		Element->Bounds = InBounds;
+		return;
+	}
+
+	Unlink(InId, *Element);
+	*Element = NewElement;
+	Link(InId, *Element);
+}
+
+bool
+FHoudiniSpatialHashGrid::Remove(const int32 InId)
+{
+	const FElement* Element = Elements.Find(InId);
+	if (!Element)
+		return false;
+
+	Unlink(InId, *Element);
+	Elements.Remove(InId);
+
+	return true;
+}
+
+void
+FHoudiniSpatialHashGrid::Link(const int32 InId, const FElement& InElement)
+{
+	if (InElement.bOversized)
+	{
+		OversizedElements.Add(InId);
+		return;
+	}
+
+	for (int64 Z = InElement.MinCell.Z; Z <= InElement.MaxCell.Z; Z++)
+	{
+		for (int64 Y = InElement.MinCell.Y; Y <= InElement.MaxCell.Y; Y++)
+		{
+			for (int64 X = InElement.MinCell.X; X <= InElement.MaxCell.X; X++)
+			{
+				Cells.FindOrAdd(FIntVector((int32)X, (int32)Y, (int32)Z)).Add(InId);
+			}
+		}
+	}
+}
+
+void
+FHoudiniSpatialHashGrid::Unlink(const int32 InId, const FElement& InElement)
+{
+	if (InElement.bOversized)
+	{
+		OversizedElements.Remove(InId);
+		return;
+	}
+
+	for (int64 Z = InElement.MinCell.Z; Z <= InElement.MaxCell.Z; Z++)
+	{
+		for (int64 Y = InElement.MinCell.Y; Y <= InElement.MaxCell.Y; Y++)
+		{
+			for (int64 X = InElement.MinCell.X; X <= InElement.MaxCell.X; X++)
+			{
+				const FIntVector CellKey((int32)X, (int32)Y, (int32)Z);
+				TArray<int32>* Cell = Cells.Find(CellKey);
+				if (!Cell)
+					continue;
+
+				Cell->RemoveSingleSwap(InId);
+				if (Cell->Num() <= 0)
+					Cells.Remove(CellKey);
+			}
+		}
+	}
+}
+
+void
+FHoudiniSpatialHashGrid::Query(const FBox& InBox, TSet<int32>& OutIds) const
+{
+	auto TestElement = [&](const int32 InId)
+	{
+		if (OutIds.Contains(InId))
+			return;
+
+		const FElement* Element = Elements.Find(InId);
+		if (Element && Element->Bounds.Intersect(InBox))
+			OutIds.Add(InId);
+	};
+
+	for (const int32 Id : OversizedElements)
+		TestElement(Id);
+
+	const FIntVector MinCell = GetCell(InBox.Min);
+	const FIntVector MaxCell = GetCell(InBox.Max);
+	if (GetNumCells(MinCell, MaxCell) > Cells.Num())
+	{
+		// The box covers more cells than are occupied, go through the occupied ones instead
+		for (const auto& Cell : Cells)
+		{
+			const FIntVector& CellKey = Cell.Key;
+			if (CellKey.X < MinCell.X || CellKey.Y < MinCell.Y || CellKey.Z < MinCell.Z
+				|| CellKey.X > MaxCell.X || CellKey.Y > MaxCell.Y || CellKey.Z > MaxCell.Z)
+				continue;
+
+			for (const int32 Id : Cell.Value)
+				TestElement(Id);
+		}
+
+		return;
+	}
+
+	for (int64 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+	{
+		for (int64 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+		{
+			for (int64 X = MinCell.X; X <= MaxCell.X; X++)
+			{
+				const TArray<int32>* Cell = Cells.Find(FIntVector((int32)X, (int32)Y, (int32)Z));
+				if (!Cell)
+					continue;
+
+				for (const int32 Id : *Cell)
+					TestElement(Id);
+			}
+		}
+	}
+}
+
+FHoudiniActorSpatialIndex&
+FHoudiniActorSpatialIndex::Get()
+{
+	static FHoudiniActorSpatialIndex Instance;
+	return Instance;
+}
+
+FHoudiniActorSpatialIndex::FHoudiniActorSpatialIndex()
+	: bNeedsRebuild(true)
+{
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectModified.AddLambda([this](UObject* Object) { OnObjectChanged(Object); });
+	FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda([this](UObject* Object, FPropertyChangedEvent&) { OnObjectChanged(Object); });
+
+	if (GEngine)
+	{
+		GEngine->OnActorMoved().AddLambda([this](AActor* Actor) { MarkActorPending(Actor); });
+		GEngine->OnLevelActorAdded().AddLambda([this](AActor* Actor) { MarkActorPending(Actor); });
+		GEngine->OnLevelActorDeleted().AddLambda([this](AActor* Actor) { RemoveActor(Actor); });
+	}
+
+	if (GEditor)
+		GEditor->OnActorsMoved().AddLambda([this](TArray<AActor*>& Actors) { for (AActor* Actor : Actors) MarkActorPending(Actor); });
+
+	// Actors loaded/unloaded by world partition
+	ULevel::OnLoadedActorAddedToLevelPostEvent.AddLambda([this](const TArray<AActor*>& Actors) { for (AActor* Actor : Actors) MarkActorPending(Actor); });
+	ULevel::OnLoadedActorRemovedFromLevelPreEvent.AddLambda([this](const TArray<AActor*>& Actors) { for (AActor* Actor : Actors) RemoveActor(Actor); });
+
+	// Undo/Redo doesn't notify the modified actors
+	FEditorDelegates::PostUndoRedo.AddLambda([this]() { bNeedsRebuild = true; });
+#endif
+
+	FWorldDelegates::LevelAddedToWorld.AddLambda([this](ULevel* Level, UWorld* World) { OnLevelChanged(Level, World, true); });
+	FWorldDelegates::LevelRemovedFromWorld.AddLambda([this](ULevel* Level, UWorld* World) { OnLevelChanged(Level, World, false); });
+	FWorldDelegates::OnWorldCleanup.AddLambda([this](UWorld* World, bool, bool)
+	{
+		if (World && World == IndexedWorld.Get())
+			Reset();
+	});
+}
+
+void
+FHoudiniActorSpatialIndex::Reset()
+{
+	IndexedWorld.Reset();
+	Grid.Reset(Grid.GetCellSize());
+	ActorIds.Reset();
+	IdActors.Reset();
+	FreeIds.Reset();
+	PendingActors.Reset();
+	bNeedsRebuild = true;
+}
+
+void
+FHoudiniActorSpatialIndex::QueryActors(UWorld* InWorld, const TArray<FBox>& InBoxes, TArray<AActor*>& OutActors)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniActorSpatialIndex::QueryActors);
+
+	if (!IsValid(InWorld) || InBoxes.Num() <= 0)
+		return;
+
+	// Only editor worlds send the events needed to keep the index up to date
+	bool bCanUseIndex = false;
+#if WITH_EDITOR
+	bCanUseIndex = InWorld->WorldType == EWorldType::Editor;
+#endif
+
+	if (!bCanUseIndex)
+	{
+		for (TActorIterator<AActor> ActorItr(InWorld); ActorItr; ++ActorItr)
+		{
+			AActor* CurrentActor = *ActorItr;
+			if (!IsValid(CurrentActor))
+				continue;
+
+			const FBox ActorBounds = CurrentActor->GetComponentsBoundingBox(true);
+			for (const FBox& Box : InBoxes)
+			{
+				if (!ActorBounds.Intersect(Box))
+					continue;
+
+				OutActors.Add(CurrentActor);
+				break;
+			}
+		}
+
+		return;
+	}
+
+	const double CellSize = FMath::Max((double)CVarHoudiniEngineBoundSelectorCellSize.GetValueOnGameThread(), 1.0);
+	if (bNeedsRebuild || IndexedWorld.Get() != InWorld || Grid.GetCellSize() != CellSize)
+		Build(InWorld, CellSize);
+	else
+		UpdatePendingActors();
+
+	TSet<int32> FoundIds;
+	for (const FBox& Box : InBoxes)
+		Grid.Query(Box, FoundIds);
+
+	for (const int32 Id : FoundIds)
+	{
+		AActor* CurrentActor = IdActors.IsValidIndex(Id) ? IdActors[Id].Get() : nullptr;
+		if (!IsValid(CurrentActor))
+			continue;
+
+		// The index contains the actors of hidden levels, that were skipped when iterating on the world
+		ULevel* Level = CurrentActor->GetLevel();
+		if (!Level || !Level->bIsVisible)
+			continue;
+
+		OutActors.Add(CurrentActor);
+	}
+}
+
+void
+FHoudiniActorSpatialIndex::Build(UWorld* InWorld, const double InCellSize)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniActorSpatialIndex::Build);
+
+	Reset();
+	Grid.Reset(InCellSize);
+	IndexedWorld = InWorld;
+
+	for (TActorIterator<AActor> ActorItr(InWorld, AActor::StaticClass(), EActorIteratorFlags::AllActors | EActorIteratorFlags::SkipPendingKill); ActorItr; ++ActorItr)
+		UpdateActor(*ActorItr);
+
+	bNeedsRebuild = false;
+}
+
+void
+FHoudiniActorSpatialIndex::UpdatePendingActors()
+{
+	if (PendingActors.Num() <= 0)
+		return;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniActorSpatialIndex::UpdatePendingActors);
+
+	TSet<TWeakObjectPtr<AActor>> ActorsToUpdate = MoveTemp(PendingActors);
+	PendingActors.Reset();
+
+	for (const TWeakObjectPtr<AActor>& CurrentActor : ActorsToUpdate)
+	{
+		if (CurrentActor.IsValid())
+			UpdateActor(CurrentActor.Get());
+		else
+			RemoveActor(CurrentActor);
+	}
+}
+
+void
+FHoudiniActorSpatialIndex::MarkActorPending(AActor* InActor)
+{
+	if (!InActor || bNeedsRebuild || !IndexedWorld.IsValid())
+		return;
+
+	if (InActor->GetWorld() != IndexedWorld.Get())
+		return;
+
+	bool bAlreadyPending = false;
+	PendingActors.Add(InActor, &bAlreadyPending);
+	if (bAlreadyPending)
+		return;
+
+	// Attached actors have moved with their parent
+	TArray<AActor*> AttachedActors;
+	InActor->GetAttachedActors(AttachedActors);
+	for (AActor* AttachedActor : AttachedActors)
+		MarkActorPending(AttachedActor);
+}
+
+void
+FHoudiniActorSpatialIndex::UpdateActor(AActor* InActor)
+{
+	if (!IsValid(InActor) || InActor->GetWorld() != IndexedWorld.Get())
+	{
+		RemoveActor(InActor);
+		return;
+	}
+
+	int32 Id = INDEX_NONE;
+	if (const int32* FoundId = ActorIds.Find(InActor))
+	{
+		Id = *FoundId;
+	}
+	else
+	{
+		Id = FreeIds.Num() > 0 ? FreeIds.Pop() : IdActors.AddDefaulted();
+		IdActors[Id] = InActor;
+		ActorIds.Add(InActor, Id);
+	}
+
+	Grid.Update(Id, InActor->GetComponentsBoundingBox(true));
+}
+
+void
+FHoudiniActorSpatialIndex::RemoveActor(const TWeakObjectPtr<AActor>& InActor)
+{
+	int32 Id = INDEX_NONE;
+	if (!ActorIds.RemoveAndCopyValue(InActor, Id))
+		return;
+
+	Grid.Remove(Id);
+	IdActors[Id].Reset();
+	FreeIds.Add(Id);
+	PendingActors.Remove(InActor);
+}
+
+void
+FHoudiniActorSpatialIndex::OnObjectChanged(UObject* InObject)
+{
+	if (!InObject || InObject->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+		return;
+
+	// Components and other subobjects can change the bounds of their actor
+	AActor* Actor = Cast<AActor>(InObject);
+	if (!Actor)
+		Actor = InObject->GetTypedOuter<AActor>();
+
+	MarkActorPending(Actor);
+}
+
+void
+FHoudiniActorSpatialIndex::OnLevelChanged(ULevel* InLevel, UWorld* InWorld, const bool bAdded)
+{
+	if (!InLevel || bNeedsRebuild || !InWorld || InWorld != IndexedWorld.Get())
+		return;
+
+	for (AActor* CurrentActor : InLevel->Actors)
+	{
+		if (!CurrentActor)
+			continue;
+
+		if (bAdded)
+			MarkActorPending(CurrentActor);
+		else
+			RemoveActor(CurrentActor);
+	}
+}
@@ -0,0 +1,129 @@
+/*
+* Copyright (c) <2024> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+
+// Uniform hash grid of bounding boxes, identified by an integer id.
+// Elements covering too many cells are kept aside and tested by every query.
+class HOUDINIENGINERUNTIME_API FHoudiniSpatialHashGrid
+{
+public:
+
+	FHoudiniSpatialHashGrid(const double InCellSize = 10000.0, const int32 InMaxCellsPerElement = 512);
+
+	// Removes all the elements and sets the size of the cells
+	void Reset(const double InCellSize);
+
+	// Adds the element, or moves it if it is already in the grid
+	void Update(const int32 InId, const FBox& InBounds);
+
+	// Removes the element, returns false if it wasn't in the grid
+	bool Remove(const int32 InId);
+
+	// Adds the ids of the elements whose bounds intersect InBox to OutIds
+	void Query(const FBox& InBox, TSet<int32>& OutIds) const;
+
+	bool Contains(const int32 InId) const { return Elements.Contains(InId); }
+	int32 Num() const { return Elements.Num(); }
+	double GetCellSize() const { return CellSize; }
+
+private:
+
+	struct FElement
+	{
+		FBox Bounds;
+		FIntVector MinCell;
+		FIntVector MaxCell;
+		bool bOversized = false;
+	};
+
+	FIntVector GetCell(const FVector& InPosition) const;
+	static int64 GetNumCells(const FIntVector& InMinCell, const FIntVector& InMaxCell);
+
+	void Link(const int32 InId, const FElement& InElement);
+	void Unlink(const int32 InId, const FElement& InElement);
+
+	double CellSize;
+	int32 MaxCellsPerElement;
+
+	TMap<int32, FElement> Elements;
+	TMap<FIntVector, TArray<int32>> Cells;
+	TSet<int32> OversizedElements;
+};
+
+// Spatial index of a world's actors, used to find the actors selected by world input bound selectors.
+// The index is built on the first query, then kept up to date from the editor's actor events:
+// added, moved or modified actors are only re-evaluated by the next query.
+class HOUDINIENGINERUNTIME_API FHoudiniActorSpatialIndex
+{
+public:
+
+	static FHoudiniActorSpatialIndex& Get();
+
+	// Adds the actors of InWorld whose bounds intersect any of the boxes to OutActors
+	void QueryActors(UWorld* InWorld, const TArray<FBox>& InBoxes, TArray<AActor*>& OutActors);
+
+	// Drops the index, it will be rebuilt by the next query
+	void Reset();
+
+private:
+
+	FHoudiniActorSpatialIndex();
+
+	void Build(UWorld* InWorld, const double InCellSize);
+
+	// Updates the bounds of the actors that changed since the last query
+	void UpdatePendingActors();
+
+	void MarkActorPending(AActor* InActor);
+	void UpdateActor(AActor* InActor);
+	void RemoveActor(const TWeakObjectPtr<AActor>& InActor);
+
+	void OnObjectChanged(UObject* InObject);
+	void OnLevelChanged(ULevel* InLevel, UWorld* InWorld, const bool bAdded);
+
+	// The world that is currently indexed
+	TWeakObjectPtr<UWorld> IndexedWorld;
+
+	FHoudiniSpatialHashGrid Grid;
+
+	// Grid ids of the indexed actors, and the actor for each id
+	TMap<TWeakObjectPtr<AActor>, int32> ActorIds;
+	TArray<TWeakObjectPtr<AActor>> IdActors;
+	TArray<int32> FreeIds;
+
+	// Actors whose bounds need to be updated before the next query
+	TSet<TWeakObjectPtr<AActor>> PendingActors;
+
+	bool bNeedsRebuild;
+};
@@ -1795,6 +1795,7 @@ UHoudiniAssetBlueprintComponent::OnFullyLoaded()
 			// The HoudiniAsset has changed, so we need to force the PreviewInstance to re-instantiate
 			AssetState = EHoudiniAssetState::NeedInstantiation;
 			bForceNeedUpdate = true;
+			MarkAsDirtyForProcessing();
 			bHoudiniAssetChanged = false;
 			// TODO: Make this better?
 			CachedTemplateComponent->bHoudiniAssetChanged = false;
@@ -2022,6 +2023,7 @@ UHoudiniAssetBlueprintComponent::OnTemplateParametersChangedHandler(UHoudiniAsse
 		// to trigger an HDA update) so we are going to force NeedUpdate() to return true
 		// in order to get an initial cook.
 		bForceNeedUpdate = true;
+		MarkAsDirtyForProcessing();
 	}
 
 	bUpdatedFromTemplate = true;
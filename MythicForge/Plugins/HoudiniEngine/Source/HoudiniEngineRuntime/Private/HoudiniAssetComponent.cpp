@@ -481,6 +481,7 @@ UHoudiniAssetComponent::OnHoudiniAssetChanged()
 
 	// Force an update on the next tick
 	bForceNeedUpdate = true;
+	MarkAsDirtyForProcessing();
 }
 
 void UHoudiniAssetComponent::QueuePreCookCallback(const TFunction<void(UHoudiniAssetComponent*)>& CallbackFn)
@@ -890,6 +891,7 @@ UHoudiniAssetComponent::MarkAsNeedCook()
 	bPendingDelete = false;
 	bRecookRequested = true;
 	bRebuildRequested = false;
+	MarkAsDirtyForProcessing();
 
 	//bEditorPropertiesNeedFullUpdate = true;
 
@@ -2008,9 +2010,21 @@ UHoudiniAssetComponent::SetHasComponentTransformChanged(const bool& InHasChanged
 	{
 		bHasComponentTransformChanged = InHasChanged;
 		LastComponentTransform = GetComponentTransform();
+
+		if (InHasChanged)
+			MarkAsDirtyForProcessing();
 	}
 }
 
+void
+UHoudiniAssetComponent::MarkAsDirtyForProcessing()
+{
+	if (!FHoudiniEngineRuntime::IsInitialized())
+		return;
+
+	FHoudiniEngineRuntime::Get().MarkHoudiniComponentDirty(this);
+}
+
 void UHoudiniAssetComponent::SetOutputNodeIds(const TArray<int32>& OutputNodes)
 {
 	NodeIdsToCook = OutputNodes;
@@ -2498,6 +2512,10 @@ UHoudiniAssetComponent::SetAssetState(EHoudiniAssetState InNewState)
 	const EHoudiniAssetState OldState = AssetState;
 	AssetState = InNewState;
 
+	// Any state change needs to be picked up by the manager
+	if (OldState != InNewState)
+		MarkAsDirtyForProcessing();
+
 #if WITH_EDITOR
 	IHoudiniEditorAssetStateSubsystemInterface* const EditorSubsystem = IHoudiniEditorAssetStateSubsystemInterface::Get(); 
 	if (EditorSubsystem)
@@ -304,13 +304,16 @@ public:
 	void MarkAsBlueprintStructureModified();
 	// The blueprint has been modified but not structurally changed.
 	void MarkAsBlueprintModified();
+	// Queues this component for processing by the Houdini Engine Manager on its next tick.
+	// Should be called whenever the state, parameters, inputs or selection of the component change.
+	void MarkAsDirtyForProcessing();
 	
 	//
 	void SetAssetCookCount(const int32& InCount) { AssetCookCount = InCount; };
 	//
-	void SetRecookRequested(const bool& InRecook) { bRecookRequested = InRecook; };
+	void SetRecookRequested(const bool& InRecook) { bRecookRequested = InRecook; if (InRecook) MarkAsDirtyForProcessing(); };
 	//
-	void SetRebuildRequested(const bool& InRebuild) { bRebuildRequested = InRebuild; };
+	void SetRebuildRequested(const bool& InRebuild) { bRebuildRequested = InRebuild; if (InRebuild) MarkAsDirtyForProcessing(); };
 	//
 	void SetHasComponentTransformChanged(const bool& InHasChanged);
 
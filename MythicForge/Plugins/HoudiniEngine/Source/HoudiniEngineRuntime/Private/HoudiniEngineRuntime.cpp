@@ -137,7 +137,7 @@ bool
 FHoudiniEngineRuntime::IsComponentRegistered(UHoudiniAssetComponent* HAC) const
 {
 	// No need for duplicates
-	if (HAC && RegisteredHoudiniComponents.Find(HAC) != INDEX_NONE)
+	if (HAC && RegisteredHoudiniComponentSet.Contains(HAC))
 		return true;
 
 	return false;
@@ -172,9 +172,51 @@ FHoudiniEngineRuntime::RegisterHoudiniComponent(UHoudiniAssetComponent* HAC, boo
 	{
 		FScopeLock ScopeLock(&CriticalSection);
 		RegisteredHoudiniComponents.Add(HAC);
+		RegisteredHoudiniComponentSet.Add(HAC);
 	}
 
 	HAC->NotifyHoudiniRegisterCompleted();
+
+	// Newly registered components always need to be looked at by the manager
+	MarkHoudiniComponentDirty(HAC);
+}
+
+
+void
+FHoudiniEngineRuntime::MarkHoudiniComponentDirty(UHoudiniAssetComponent* HAC)
+{
+	if (!IsInitialized())
+		return;
+
+	if (!IsValid(HAC))
+		return;
+
+	FScopeLock ScopeLock(&CriticalSection);
+	DirtyHoudiniComponents.Add(HAC);
+}
+
+
+void
+FHoudiniEngineRuntime::MarkAllRegisteredHoudiniComponentsDirty()
+{
+	if (!IsInitialized())
+		return;
+
+	FScopeLock ScopeLock(&CriticalSection);
+	DirtyHoudiniComponents.Append(RegisteredHoudiniComponents);
+}
+
+
+void
+FHoudiniEngineRuntime::ConsumeDirtyHoudiniComponents(TArray<TWeakObjectPtr<UHoudiniAssetComponent>>& OutDirtyComponents)
+{
+	OutDirtyComponents.Reset();
+	if (!IsInitialized())
+		return;
+
+	FScopeLock ScopeLock(&CriticalSection);
+	OutDirtyComponents = DirtyHoudiniComponents.Array();
+	DirtyHoudiniComponents.Reset();
 }
 
 
@@ -219,6 +261,7 @@ FHoudiniEngineRuntime::UnRegisterHoudiniComponent(UHoudiniAssetComponent* HAC)
 		if (!CurHAC.IsValid() || CurHAC.IsStale())
 		{
 			// Remove stale/invalid HAC from Array?
+			RegisteredHoudiniComponentSet.Remove(CurHAC);
 			RegisteredHoudiniComponents.RemoveAt(n);
 			continue;
 		}
@@ -254,6 +297,8 @@ FHoudiniEngineRuntime::UnRegisterHoudiniComponent(const int32& ValidIndex)
 		}
 	}
 	
+	RegisteredHoudiniComponentSet.Remove(Ptr);
+	DirtyHoudiniComponents.Remove(Ptr);
 	RegisteredHoudiniComponents.RemoveAt(ValidIndex);
 }
 
@@ -68,6 +68,19 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 		UHoudiniAssetComponent* GetRegisteredHoudiniComponentAt(const int32& Index);
 
 		virtual TArray<TWeakObjectPtr<UHoudiniAssetComponent>>* GetRegisteredHoudiniComponents() { return &RegisteredHoudiniComponents; };
+
+		//
+		// Dirty component queue
+		//
+		// Components are queued here when their state, parameters, inputs or selection change,
+		// so that the Houdini Engine Manager only has to process components that actually need work.
+		void MarkHoudiniComponentDirty(UHoudiniAssetComponent* HAC);
+
+		// Queue all the registered components for processing
+		void MarkAllRegisteredHoudiniComponentsDirty();
+
+		// Moves the currently queued components to OutDirtyComponents and empties the queue
+		void ConsumeDirtyHoudiniComponents(TArray<TWeakObjectPtr<UHoudiniAssetComponent>>& OutDirtyComponents);
 		
 		//
 		// Node deletion
@@ -107,6 +120,12 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 		// 
 		TArray<TWeakObjectPtr<UHoudiniAssetComponent>> RegisteredHoudiniComponents;
 
+		// Mirror of RegisteredHoudiniComponents, for constant time registration lookups
+		TSet<TWeakObjectPtr<UHoudiniAssetComponent>> RegisteredHoudiniComponentSet;
+
+		// Components waiting to be picked up by the Houdini Engine Manager
+		TSet<TWeakObjectPtr<UHoudiniAssetComponent>> DirtyHoudiniComponents;
+
 		TArray<int32> NodeIdsPendingDelete;
 
 		TArray<int32> NodeIdsParentPendingDelete;
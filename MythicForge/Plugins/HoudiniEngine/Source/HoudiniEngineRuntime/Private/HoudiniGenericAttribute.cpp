@@ -38,8 +38,123 @@
 #include "Engine/StaticMesh.h"
 #include "Landscape.h"
 #include "PhysicsEngine/BodySetup.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/ObjectKey.h"
 
 
+#if WITH_EDITOR
+// Result of a property search by name on a struct: the struct properties leading to the
+// container of the found property, and whether the property's name matched exactly
+struct FHoudiniResolvedPropertyPath
+{
+	TArray<FStructProperty*> StructPath;
+	FProperty* Property = nullptr;
+	bool bExact = false;
+};
+
+// Resolved property paths of native structs, keyed by struct and property name.
+// The object key's serial number prevents reusing the entries of a struct that has been garbage collected.
+static TMap<TPair<TObjectKey<UStruct>, FString>, FHoudiniResolvedPropertyPath> ResolvedPropertyPaths;
+static FCriticalSection ResolvedPropertyPathsLock;
+
+// The cache is emptied when it reaches this size, as the keys come from arbitrary attribute names
+static const int32 MaxResolvedPropertyPaths = 4096;
+
+// Returns true if the properties of the struct are fixed for its whole lifetime.
+// Blueprint classes and user defined structs rebuild their properties in place when they are recompiled,
+// which would leave dangling properties in the cache.
+static bool
+HasFixedProperties(const UStruct* InStruct)
+{
+	if (const UClass* Class = Cast<UClass>(InStruct))
+		return Class->HasAnyClassFlags(CLASS_Native);
+
+	if (const UScriptStruct* ScriptStruct = Cast<UScriptStruct>(InStruct))
+		return (ScriptStruct->StructFlags & STRUCT_Native) != 0;
+
+	return false;
+}
+
+// Searches a struct's properties, and recursively the properties of its struct properties, for a
+// property whose name or display name contains InPropertyName. Stops at the first exact match,
+// otherwise keeps the last partial match (same rules as FHoudiniGenericAttribute::TryToFindProperty).
+static void
+ResolvePropertyPath(
+	UStruct* InStruct,
+	const FString& InPropertyName,
+	TArray<FStructProperty*>& InOutStructPath,
+	FHoudiniResolvedPropertyPath& OutResolvedPath)
+{
+	for (TFieldIterator<FProperty> PropIt(InStruct, EFieldIteratorFlags::IncludeSuper); PropIt; ++PropIt)
+	{
+		FProperty* CurrentProperty = *PropIt;
+		if (!CurrentProperty)
+			continue;
+
+		const FString DisplayName = CurrentProperty->GetDisplayNameText().ToString().Replace(TEXT(" "), TEXT(""));
+		const FString Name = CurrentProperty->GetName();
+		if (Name.Contains(InPropertyName) || DisplayName.Contains(InPropertyName))
+		{
+			OutResolvedPath.Property = CurrentProperty;
+			OutResolvedPath.StructPath = InOutStructPath;
+			if ((Name == InPropertyName) || (DisplayName == InPropertyName))
+			{
+				OutResolvedPath.bExact = true;
+				return;
+			}
+		}
+
+		FStructProperty* StructProperty = CastField<FStructProperty>(CurrentProperty);
+		if (!StructProperty || !IsValid(StructProperty->Struct))
+			continue;
+
+		InOutStructPath.Push(StructProperty);
+		ResolvePropertyPath(StructProperty->Struct, InPropertyName, InOutStructPath, OutResolvedPath);
+		InOutStructPath.Pop();
+
+		if (OutResolvedPath.bExact)
+			return;
+	}
+}
+
+// Returns the property path for the given struct and property name.
+// Paths of native structs are cached, other structs are searched every time.
+static FHoudiniResolvedPropertyPath
+FindOrResolvePropertyPath(UStruct* InStruct, const FString& InPropertyName)
+{
+	FHoudiniResolvedPropertyPath ResolvedPath;
+	TArray<FStructProperty*> StructPath;
+	if (!HasFixedProperties(InStruct))
+	{
+		ResolvePropertyPath(InStruct, InPropertyName, StructPath, ResolvedPath);
+		return ResolvedPath;
+	}
+
+	const TPair<TObjectKey<UStruct>, FString> Key(InStruct, InPropertyName);
+	{
+		FScopeLock Lock(&ResolvedPropertyPathsLock);
+		if (const FHoudiniResolvedPropertyPath* Found = ResolvedPropertyPaths.Find(Key))
+			return *Found;
+	}
+
+	ResolvePropertyPath(InStruct, InPropertyName, StructPath, ResolvedPath);
+
+	// Native structs can't contain user defined structs, but check the path anyway
+	for (const FStructProperty* StructProperty : ResolvedPath.StructPath)
+	{
+		if (!StructProperty || !HasFixedProperties(StructProperty->Struct))
+			return ResolvedPath;
+	}
+
+	FScopeLock Lock(&ResolvedPropertyPathsLock);
+	if (ResolvedPropertyPaths.Num() >= MaxResolvedPropertyPaths)
+		ResolvedPropertyPaths.Empty();
+
+	ResolvedPropertyPaths.Add(Key, ResolvedPath);
+	return ResolvedPath;
+}
+#endif
+
 
 FHoudiniGenericAttributeChangedProperty::FHoudiniGenericAttributeChangedProperty()
 	: Object()
@@ -887,6 +1002,31 @@ FHoudiniGenericAttribute::TryToFindProperty(
 	if (InPropertyName.IsEmpty() && !bDumpAttributes)
 		return false;
 
+	// The same uproperty attributes are usually applied to many objects of the same class,
+	// so reuse the property path resolved for this struct instead of walking all of its properties again
+	if (!bDumpAttributes && !bOutExactPropertyHasBeenFound)
+	{
+		const FHoudiniResolvedPropertyPath ResolvedPath = FindOrResolvePropertyPath(InStruct, InPropertyName);
+		if (!ResolvedPath.Property)
+			return OutFoundProperty != nullptr;
+
+		void* Container = InContainer;
+		for (FStructProperty* StructProperty : ResolvedPath.StructPath)
+			Container = StructProperty->ContainerPtrToValuePtr<void>(Container, 0);
+
+		OutFoundProperty = ResolvedPath.Property;
+		OutContainer = Container;
+		if (ResolvedPath.bExact)
+		{
+			bOutExactPropertyHasBeenFound = true;
+			for (FStructProperty* StructProperty : ResolvedPath.StructPath)
+				InPropertyChain.AddTail(StructProperty);
+			InPropertyChain.AddTail(ResolvedPath.Property);
+		}
+
+		return true;
+	}
+
 	// Iterate manually on the properties, in order to handle StructProperties correctly
 	for (TFieldIterator<FProperty> PropIt(InStruct, EFieldIteratorFlags::IncludeSuper); PropIt; ++PropIt)
 	{
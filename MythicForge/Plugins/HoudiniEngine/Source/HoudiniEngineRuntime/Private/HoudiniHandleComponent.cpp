@@ -28,6 +28,7 @@
 
 #include "HoudiniEngineRuntimePrivatePCH.h"
 
+#include "HoudiniAssetComponent.h"
 #include "HoudiniParameter.h"
 #include "HoudiniParameterFloat.h"
 #include "HoudiniParameterChoice.h"
@@ -268,6 +269,10 @@ UHoudiniHandleComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransform
 		{
 			bNeedToUpdateTransform = true;
 			dLastTransformUpdateTime = FPlatformTime::Seconds();
+
+			UHoudiniAssetComponent* HAC = Cast<UHoudiniAssetComponent>(GetAttachParent());
+			if (IsValid(HAC))
+				HAC->MarkAsDirtyForProcessing();
 		}
 	}
 #endif
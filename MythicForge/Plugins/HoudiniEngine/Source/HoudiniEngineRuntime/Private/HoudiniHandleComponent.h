@@ -121,6 +121,9 @@ public:
 
 	bool IsTransformUpdateNeeded();
 
+	// Indicates the handle has moved and is waiting to upload its transform
+	bool HasPendingTransformUpdate() const { return bNeedToUpdateTransform; };
+
 public:
 	UPROPERTY()
 	TArray<TObjectPtr<UHoudiniHandleParameter>> XformParms;
@@ -35,6 +35,7 @@
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniAssetBlueprintComponent.h"
+#include "HoudiniActorSpatialIndex.h"
 #include "UnrealObjectInputRuntimeTypes.h"
 #include "UnrealObjectInputManager.h"
 #include "UnrealObjectInputRuntimeUtils.h"
@@ -1057,6 +1058,20 @@ UHoudiniInputHoudiniSplineComponent* UHoudiniInput::GetOrCreateCurveInputObjectA
 	return CurveInputObject;
 }
 
+void
+UHoudiniInput::SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate)
+{
+	bNeedsToTriggerUpdate = bInTriggersUpdate;
+
+	// Let the owning HAC know it needs to be processed
+	if (bInTriggersUpdate)
+	{
+		UHoudiniAssetComponent* OuterHAC = GetTypedOuter<UHoudiniAssetComponent>();
+		if (IsValid(OuterHAC))
+			OuterHAC->MarkAsDirtyForProcessing();
+	}
+}
+
 void
 UHoudiniInput::MarkAllInputObjectsChanged(const bool& bInChanged)
 {
@@ -2429,12 +2444,13 @@ UHoudiniInput::UpdateWorldSelectionFromBoundSelectors()
 	USceneComponent* ParentComponent = Cast<USceneComponent>(GetOuter());
 	AActor* ParentActor = ParentComponent ? ParentComponent->GetOwner() : nullptr;
 
-	//UWorld* editorWorld = GEditor->GetEditorWorldContext().World();
-	UWorld* MyWorld = GetWorld();
+	// Only the actors intersecting the bounds are returned by the spatial index
+	TArray<AActor*> CandidateActors;
+	FHoudiniActorSpatialIndex::Get().QueryActors(GetWorld(), AllBBox, CandidateActors);
+
 	TArray<AActor*> NewSelectedActors;
-	for (TActorIterator<AActor> ActorItr(MyWorld); ActorItr; ++ActorItr)
+	for (AActor* CurrentActor : CandidateActors)
 	{
-		AActor *CurrentActor = *ActorItr;
 		if (!IsValid(CurrentActor))
 			continue;
 
@@ -2466,16 +2482,7 @@ UHoudiniInput::UpdateWorldSelectionFromBoundSelectors()
 				continue;
 		}
 
-		FBox ActorBounds = CurrentActor->GetComponentsBoundingBox(true);
-		for (auto InBounds : AllBBox)
-		{
-			// Check if both actor's bounds intersects
-			if (!ActorBounds.Intersect(InBounds))
-				continue;
-
-			NewSelectedActors.Add(CurrentActor);
-			break;
-		}
+		NewSelectedActors.Add(CurrentActor);
 	}
 	
 	return UpdateWorldSelection(NewSelectedActors);
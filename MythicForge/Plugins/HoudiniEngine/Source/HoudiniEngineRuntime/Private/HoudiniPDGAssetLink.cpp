@@ -503,6 +503,9 @@ UTOPNode::SetNotLoadedWorkResultsToLoad(bool bInAlsoSetDeletedToLoad)
 			}
 		}
 	}
+
+	if (UHoudiniPDGAssetLink* AssetLink = GetOuterAssetLink())
+		AssetLink->MarkTOPNodeWorkResultsDirty(this);
 }
 
 void
@@ -515,7 +518,10 @@ UTOPNode::SetLoadedWorkResultsToDelete()
 			if (WRO.State == EPDGWorkResultState::Loaded)
 				WRO.State = EPDGWorkResultState::ToDelete;
 		}
-    }	
+    }
+
+	if (UHoudiniPDGAssetLink* AssetLink = GetOuterAssetLink())
+		AssetLink->MarkTOPNodeWorkResultsDirty(this);
 }
 
 FGuid
@@ -545,6 +551,9 @@ UTOPNode::DeleteWorkResultObjectOutputs(const int32 InWorkResultArrayIndex, cons
 		WRO.GetOutputActorOwner().DestroyOutputActor();
 	WRO.State = EPDGWorkResultState::Deleted;
 
+	if (UHoudiniPDGAssetLink* AssetLink = GetOuterAssetLink())
+		AssetLink->MarkTOPNodeWorkResultsDirty(this);
+
 	// Ensure that the outer level (or actor in the case of OFPA) is marked as dirty so that references to the
 	// output actors / objects are saved
 	MarkPackageDirty();
@@ -573,6 +582,9 @@ UTOPNode::DeleteAllWorkResultObjectOutputs(const bool bInDeleteOutputActors)
 		DeleteWorkItemOutputs(WorkItemIndex, bInDeleteOutputActors);
 	}
 	bCachedHaveLoadedWorkResults = false;
+
+	if (UHoudiniPDGAssetLink* AssetLink = GetOuterAssetLink())
+		AssetLink->MarkTOPNodeWorkResultsDirty(this);
 }
 
 FString
@@ -1628,6 +1640,37 @@ UHoudiniPDGAssetLink::UpdateTOPNodeAutoloadAndVisibility()
 	}
 }
 
+void
+UHoudiniPDGAssetLink::MarkTOPNodeWorkResultsDirty(UTOPNode* InTOPNode)
+{
+	if (!IsValid(InTOPNode))
+		return;
+
+	DirtyTOPNodes.Add(InTOPNode);
+}
+
+void
+UHoudiniPDGAssetLink::MarkAllTOPNodeWorkResultsDirty()
+{
+	for (UTOPNetwork* TOPNetwork : AllTOPNetworks)
+	{
+		if (!IsValid(TOPNetwork))
+			continue;
+
+		for (UTOPNode* TOPNode : TOPNetwork->AllTOPNodes)
+		{
+			MarkTOPNodeWorkResultsDirty(TOPNode);
+		}
+	}
+}
+
+void
+UHoudiniPDGAssetLink::ConsumeDirtyTOPNodes(TArray<TWeakObjectPtr<UTOPNode>>& OutTOPNodes)
+{
+	OutTOPNodes = DirtyTOPNodes.Array();
+	DirtyTOPNodes.Reset();
+}
+
 void
 UHoudiniPDGAssetLink::FilterTOPNodesAndOutputs()
 {
@@ -756,6 +756,16 @@ public:
 	// result. Used when FTOPNode.bShow and/or FTOPNode.bAutoload changed.
 	void UpdateTOPNodeAutoloadAndVisibility();
 
+	// Queues InTOPNode so that the PDG manager goes through all of its work results on its next update (to load or
+	// delete their result objects and update the node's cached loaded/not loaded flags)
+	void MarkTOPNodeWorkResultsDirty(UTOPNode* InTOPNode);
+
+	// Queues all the TOP nodes of all the TOP networks, see MarkTOPNodeWorkResultsDirty()
+	void MarkAllTOPNodeWorkResultsDirty();
+
+	// Moves the queued TOP nodes to OutTOPNodes and empties the queue
+	void ConsumeDirtyTOPNodes(TArray<TWeakObjectPtr<UTOPNode>>& OutTOPNodes);
+
 #if WITH_EDITORONLY_DATA
 	// Returns true if there are any nodes left that can/must still be auto-baked.
 	bool AnyRemainingAutoBakeNodes() const;
@@ -934,4 +944,7 @@ private:
 	// The number of TOP nodes that have been successfully baked since the last time HandlePostBake has been called.
 	UPROPERTY()
 	int32 NumSuccessfulNodeAutoBakes; 
+
+	// TOP nodes whose work results were changed in bulk, waiting to be picked up by the PDG manager
+	TSet<TWeakObjectPtr<UTOPNode>> DirtyTOPNodes;
 };
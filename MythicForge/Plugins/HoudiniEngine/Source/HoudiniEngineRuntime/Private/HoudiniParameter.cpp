@@ -26,6 +26,8 @@
 
 #include "HoudiniParameter.h"
 
+#include "HoudiniAssetComponent.h"
+
 UHoudiniParameter::UHoudiniParameter(const FObjectInitializer & ObjectInitializer)
 	: Super(ObjectInitializer)
 	, ParmType(EHoudiniParameterType::Invalid)
@@ -94,6 +96,20 @@ UHoudiniParameter::RevertToDefault(const int32& InAtTupleIndex)
 	MarkChanged(true);	
 }
 
+void
+UHoudiniParameter::SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate)
+{
+	bNeedsToTriggerUpdate = bInTriggersUpdate;
+
+	// Let the owning HAC know it needs to be processed
+	if (bInTriggersUpdate)
+	{
+		UHoudiniAssetComponent* OuterHAC = GetTypedOuter<UHoudiniAssetComponent>();
+		if (IsValid(OuterHAC))
+			OuterHAC->MarkAsDirtyForProcessing();
+	}
+}
+
 void
 UHoudiniParameter::MarkDefault(const bool& bInDefault)
 {
@@ -152,6 +152,7 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	DistanceFieldResolutionScale = 2.0f; // ue default is 1.0
 
 	bPDGAsyncCommandletImportEnabled = false;
+	PDGAsyncCommandletImportProcessCount = 2;
 
 	// Curve inputs and editable output curves
 	bAddRotAndScaleAttributesOnCurves = false;
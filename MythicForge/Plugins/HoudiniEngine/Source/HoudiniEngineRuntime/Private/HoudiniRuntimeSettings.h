@@ -488,6 +488,11 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = "PDG Settings", Meta = (DisplayName = "Async Importer Enabled"))
 		bool bPDGAsyncCommandletImportEnabled;
 
+		// Number of commandlet processes importing PDG work results in parallel.
+		// Each commandlet runs its own Houdini Engine session.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = "PDG Settings", Meta = (DisplayName = "Async Importer Processes", ClampMin = "1", ClampMax = "16", UIMin = "1", UIMax = "8", EditCondition = "bPDGAsyncCommandletImportEnabled"))
+		int32 PDGAsyncCommandletImportProcessCount;
+
 
 		//-------------------------------------------------------------------------------------------------------------
 		// Houdini Tools Paths
@@ -534,6 +534,8 @@ UHoudiniSplineComponent::NeedsToTriggerUpdate() const
 void UHoudiniSplineComponent::SetNeedsToTriggerUpdate(const bool& NeedsToTriggerUpdate)
 {
 	 bNeedsToTriggerUpdate = NeedsToTriggerUpdate;
+	 if (NeedsToTriggerUpdate)
+		 MarkOwnerAsDirtyForProcessing();
 }
 
 void UHoudiniSplineComponent::SetCurveType(const EHoudiniCurveType & NewCurveType)
@@ -550,6 +552,19 @@ void UHoudiniSplineComponent::MarkChanged(const bool& Changed)
 {
 	bHasChanged = Changed;
 	bNeedsToTriggerUpdate = Changed;
+	if (Changed)
+		MarkOwnerAsDirtyForProcessing();
+}
+
+void UHoudiniSplineComponent::MarkOwnerAsDirtyForProcessing()
+{
+	// Input curves are owned by the input's HAC, editable output curves are attached to their HAC
+	UHoudiniAssetComponent* OwnerHAC = GetTypedOuter<UHoudiniAssetComponent>();
+	if (!OwnerHAC)
+		OwnerHAC = Cast<UHoudiniAssetComponent>(GetAttachParent());
+
+	if (IsValid(OwnerHAC))
+		OwnerHAC->MarkAsDirtyForProcessing();
 }
 
 void UHoudiniSplineComponent::MarkInputNodesAsPendingKill()
@@ -196,6 +196,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniSplineComponent : public USceneComponent,
 
 		void ReverseCurvePoints();
 
+		// Queue the HAC owning this curve for processing by the manager
+		void MarkOwnerAsDirtyForProcessing();
+
 	public:
 
 		UPROPERTY()
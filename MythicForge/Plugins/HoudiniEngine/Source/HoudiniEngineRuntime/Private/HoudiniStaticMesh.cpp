@@ -30,6 +30,25 @@
 #include "Async/ParallelFor.h"
 #include "MeshUtilitiesCommon.h"
 
+// Number of elements handled per task by the bulk setters
+static constexpr int32 HoudiniStaticMeshBulkChunkSize = 16384;
+
+// Runs InChunkFunc(StartIndex, EndIndex) in parallel over [0, InNum), split in HoudiniStaticMeshBulkChunkSize chunks
+template<typename ChunkFuncType>
+static void
+ParallelForBulkChunks(const int32 InNum, const ChunkFuncType& InChunkFunc)
+{
+	if (InNum <= 0)
+		return;
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(InNum, HoudiniStaticMeshBulkChunkSize);
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
+	{
+		const int32 StartIdx = ChunkIdx * HoudiniStaticMeshBulkChunkSize;
+		InChunkFunc(StartIdx, FMath::Min(StartIdx + HoudiniStaticMeshBulkChunkSize, InNum));
+	}, NumChunks <= 1);
+}
+
 UHoudiniStaticMesh::UHoudiniStaticMesh(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
 {
@@ -274,6 +293,222 @@ void UHoudiniStaticMesh::SetStaticMaterial(uint32 InMaterialIndex, const FStatic
 	StaticMaterials[InMaterialIndex] = InStaticMaterial;
 }
 
+void UHoudiniStaticMesh::SetVertexPositions(TArray<FVector3f>&& InVertexPositions)
+{
+	check(InVertexPositions.Num() == VertexPositions.Num());
+	VertexPositions = MoveTemp(InVertexPositions);
+}
+
+void UHoudiniStaticMesh::SetTriangleIndices(TArray<FIntVector>&& InTriangleIndices)
+{
+	check(InTriangleIndices.Num() == TriangleIndices.Num());
+	TriangleIndices = MoveTemp(InTriangleIndices);
+}
+
+void UHoudiniStaticMesh::SetTriangleIndices(TConstArrayView<int32> InTriangleVertexIndices)
+{
+	static_assert(sizeof(FIntVector) == 3 * sizeof(int32), "FIntVector is expected to be 3 packed int32");
+	check(InTriangleVertexIndices.Num() == TriangleIndices.Num() * 3);
+	FMemory::Memcpy(TriangleIndices.GetData(), InTriangleVertexIndices.GetData(), InTriangleVertexIndices.Num() * sizeof(int32));
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceNormals(TArray<FVector3f>&& InNormals)
+{
+	if (!bHasNormals)
+		return;
+
+	check(InNormals.Num() == VertexInstanceNormals.Num());
+	VertexInstanceNormals = MoveTemp(InNormals);
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceUTangents(TArray<FVector3f>&& InUTangents)
+{
+	if (!bHasTangents)
+		return;
+
+	check(InUTangents.Num() == VertexInstanceUTangents.Num());
+	VertexInstanceUTangents = MoveTemp(InUTangents);
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceVTangents(TArray<FVector3f>&& InVTangents)
+{
+	if (!bHasTangents)
+		return;
+
+	check(InVTangents.Num() == VertexInstanceVTangents.Num());
+	VertexInstanceVTangents = MoveTemp(InVTangents);
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceColors(TArray<FColor>&& InColors, int32 InNumConvertedColors)
+{
+	if (!bHasColors)
+		return;
+
+	check(InColors.Num() == VertexInstanceColors.Num());
+	VertexInstanceColors = MoveTemp(InColors);
+
+	const int32 NumConvertedColors = InNumConvertedColors < 0
+		? VertexInstanceColors.Num()
+		: FMath::Min(InNumConvertedColors, VertexInstanceColors.Num());
+
+	// Same conversion as SetTriangleVertexColor()
+	ParallelForBulkChunks(NumConvertedColors, [this](int32 StartIdx, int32 EndIdx)
+	{
+		for (int32 Idx = StartIdx; Idx < EndIdx; ++Idx)
+			VertexInstanceColors[Idx] = VertexInstanceColors[Idx].ReinterpretAsLinear().ToFColor(true);
+	});
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceUVs(uint32 InUVLayer, TConstArrayView<FVector2f> InUVs)
+{
+	if (InUVLayer >= NumUVLayers)
+		return;
+
+	const int32 NumVertexInstances = GetNumVertexInstances();
+	check(InUVs.Num() == NumVertexInstances);
+	FMemory::Memcpy(VertexInstanceUVs.GetData() + InUVLayer * NumVertexInstances, InUVs.GetData(), NumVertexInstances * sizeof(FVector2f));
+}
+
+void UHoudiniStaticMesh::SetMaterialIDsPerTriangle(TArray<int32>&& InMaterialIDs)
+{
+	if (!bHasPerFaceMaterials)
+		return;
+
+	check(InMaterialIDs.Num() == MaterialIDsPerTriangle.Num());
+	MaterialIDsPerTriangle = MoveTemp(InMaterialIDs);
+}
+
+void UHoudiniStaticMesh::ConvertHoudiniVectors(const float* InHoudiniVectors, FVector3f* OutVectors, int32 InNum, float InScale)
+{
+	static_assert(sizeof(FVector3f) == 3 * sizeof(float), "FVector3f is expected to be 3 packed floats");
+
+	const float* RESTRICT Src = InHoudiniVectors;
+	float* RESTRICT Dst = reinterpret_cast<float*>(OutVectors);
+	const VectorRegister4Float Scale = VectorSetFloat1(InScale);
+
+	// 4 vectors (12 floats, 3 registers) per iteration:
+	//   In:  x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+	//   Out: x0 z0 y0 x1 | z1 y1 x2 z2 | y2 x3 z3 y3
+	int32 Idx = 0;
+	for (; Idx + 4 <= InNum; Idx += 4, Src += 12, Dst += 12)
+	{
+		const VectorRegister4Float R0 = VectorMultiply(VectorLoad(Src + 0), Scale);
+		const VectorRegister4Float R1 = VectorMultiply(VectorLoad(Src + 4), Scale);
+		const VectorRegister4Float R2 = VectorMultiply(VectorLoad(Src + 8), Scale);
+
+		// x2 y2 z2 z2
+		const VectorRegister4Float X2Y2Z2 = VectorShuffle(R1, R2, 2, 3, 0, 0);
+		// y2 y2 x3 x3
+		const VectorRegister4Float Y2X3 = VectorShuffle(R1, R2, 3, 3, 1, 1);
+
+		VectorStore(VectorSwizzle(R0, 0, 2, 1, 3), Dst + 0);
+		VectorStore(VectorShuffle(R1, X2Y2Z2, 1, 0, 0, 2), Dst + 4);
+		VectorStore(VectorShuffle(Y2X3, R2, 0, 2, 3, 2), Dst + 8);
+	}
+
+	for (; Idx < InNum; ++Idx, Src += 3, Dst += 3)
+	{
+		Dst[0] = Src[0] * InScale;
+		Dst[1] = Src[2] * InScale;
+		Dst[2] = Src[1] * InScale;
+	}
+}
+
+bool UHoudiniStaticMesh::SetVertexPositionsFromHoudini(TConstArrayView<float> InHoudiniPositions, TConstArrayView<int32> InPointIndices, float InScale)
+{
+	const int32 NumVertices = VertexPositions.Num();
+	check(InPointIndices.Num() == NumVertices);
+
+	const int32 NumPoints = InHoudiniPositions.Num() / 3;
+	const float* HoudiniPositions = InHoudiniPositions.GetData();
+	const int32* PointIndices = InPointIndices.GetData();
+	FVector3f* Positions = VertexPositions.GetData();
+
+	std::atomic<bool> bAllIndicesValid(true);
+	ParallelForBulkChunks(NumVertices, [&](int32 StartIdx, int32 EndIdx)
+	{
+		const VectorRegister4Float Scale = VectorSetFloat1(InScale);
+		bool bChunkValid = true;
+		for (int32 VertexIdx = StartIdx; VertexIdx < EndIdx; ++VertexIdx)
+		{
+			const int32 PointIdx = PointIndices[VertexIdx];
+			if (PointIdx < 0 || PointIdx >= NumPoints)
+			{
+				bChunkValid = false;
+				continue;
+			}
+
+			const VectorRegister4Float Position = VectorMultiply(VectorLoadFloat3(HoudiniPositions + PointIdx * 3), Scale);
+			VectorStoreFloat3(VectorSwizzle(Position, 0, 2, 1, 3), reinterpret_cast<float*>(Positions + VertexIdx));
+		}
+
+		if (!bChunkValid)
+			bAllIndicesValid = false;
+	});
+
+	return bAllIndicesValid;
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceVectorsFromHoudini(TArray<FVector3f>& OutStream, TConstArrayView<float> InHoudiniValues, int32 InNumTriangles)
+{
+	const int32 NumTriangles = FMath::Min3(InNumTriangles, InHoudiniValues.Num() / 9, OutStream.Num() / 3);
+	const float* HoudiniValues = InHoudiniValues.GetData();
+	FVector3f* Values = OutStream.GetData();
+
+	ParallelForBulkChunks(NumTriangles, [&](int32 StartIdx, int32 EndIdx)
+	{
+		const int32 StartVertexInstance = StartIdx * 3;
+		ConvertHoudiniVectors(HoudiniValues + StartVertexInstance * 3, Values + StartVertexInstance, (EndIdx - StartIdx) * 3);
+
+		// Fix the winding order
+		for (int32 TriangleIdx = StartIdx; TriangleIdx < EndIdx; ++TriangleIdx)
+			Swap(Values[TriangleIdx * 3 + 1], Values[TriangleIdx * 3 + 2]);
+	});
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceNormalsFromHoudini(TConstArrayView<float> InHoudiniNormals, int32 InNumTriangles)
+{
+	if (bHasNormals)
+		SetVertexInstanceVectorsFromHoudini(VertexInstanceNormals, InHoudiniNormals, InNumTriangles);
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceUTangentsFromHoudini(TConstArrayView<float> InHoudiniUTangents, int32 InNumTriangles)
+{
+	if (bHasTangents)
+		SetVertexInstanceVectorsFromHoudini(VertexInstanceUTangents, InHoudiniUTangents, InNumTriangles);
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceVTangentsFromHoudini(TConstArrayView<float> InHoudiniVTangents, int32 InNumTriangles)
+{
+	if (bHasTangents)
+		SetVertexInstanceVectorsFromHoudini(VertexInstanceVTangents, InHoudiniVTangents, InNumTriangles);
+}
+
+void UHoudiniStaticMesh::SetVertexInstanceUVsFromHoudini(uint32 InUVLayer, TConstArrayView<float> InHoudiniUVs, int32 InNumTriangles)
+{
+	if (InUVLayer >= NumUVLayers)
+		return;
+
+	const int32 NumVertexInstances = GetNumVertexInstances();
+	const int32 NumTriangles = FMath::Min3(InNumTriangles, InHoudiniUVs.Num() / 6, (int32)GetNumTriangles());
+	const float* HoudiniUVs = InHoudiniUVs.GetData();
+	FVector2f* UVs = VertexInstanceUVs.GetData() + InUVLayer * NumVertexInstances;
+
+	ParallelForBulkChunks(NumTriangles, [&](int32 StartIdx, int32 EndIdx)
+	{
+		const int32 Winding[3] = { 0, 2, 1 };
+		for (int32 TriangleIdx = StartIdx; TriangleIdx < EndIdx; ++TriangleIdx)
+		{
+			const float* TriangleUVs = HoudiniUVs + TriangleIdx * 6;
+			for (int32 ElementIdx = 0; ElementIdx < 3; ++ElementIdx)
+			{
+				// We need to flip V coordinate when it's coming from HAPI.
+				UVs[TriangleIdx * 3 + Winding[ElementIdx]] = FVector2f(TriangleUVs[ElementIdx * 2], 1.0f - TriangleUVs[ElementIdx * 2 + 1]);
+			}
+		}
+	});
+}
+
 void UHoudiniStaticMesh::CalculateNormals(bool bInComputeWeightedNormals)
 {
 	const int32 NumVertexInstances = GetNumVertexInstances();
@@ -126,6 +126,38 @@ public:
 	UFUNCTION()
 	uint32 AddStaticMaterial(const FStaticMaterial& InStaticMaterial) { return StaticMaterials.Add(InStaticMaterial); }
 
+	// Bulk setters: replace a whole stream at once instead of going through the per element setters above.
+	// The streams must have the sizes set by Initialize(): NumVertices, NumTriangles or NumVertexInstances elements.
+	void SetVertexPositions(TArray<FVector3f>&& InVertexPositions);
+	void SetTriangleIndices(TArray<FIntVector>&& InTriangleIndices);
+	// Copies flat (3 per triangle) vertex indices.
+	void SetTriangleIndices(TConstArrayView<int32> InTriangleVertexIndices);
+	void SetVertexInstanceNormals(TArray<FVector3f>&& InNormals);
+	void SetVertexInstanceUTangents(TArray<FVector3f>&& InUTangents);
+	void SetVertexInstanceVTangents(TArray<FVector3f>&& InVTangents);
+	// Only the first InNumConvertedColors colors (all by default) are converted the same way SetTriangleVertexColor() does,
+	// the others are kept as is.
+	void SetVertexInstanceColors(TArray<FColor>&& InColors, int32 InNumConvertedColors = INDEX_NONE);
+	void SetVertexInstanceUVs(uint32 InUVLayer, TConstArrayView<FVector2f> InUVs);
+	void SetMaterialIDsPerTriangle(TArray<int32>&& InMaterialIDs);
+
+	// Bulk setters taking raw Houdini data (Y up, meters, flat float arrays). They swap Y and Z, scale
+	// and fix the winding order (Houdini's triangle vertices 0 1 2 become 0 2 1) in parallel chunks.
+
+	// Sets the position of each vertex from the Houdini point InPointIndices[VertexIndex] in InHoudiniPositions.
+	// Returns false if some point indices were out of range (these vertices are left untouched).
+	bool SetVertexPositionsFromHoudini(TConstArrayView<float> InHoudiniPositions, TConstArrayView<int32> InPointIndices, float InScale);
+	// Set the first InNumTriangles triangles' vertex instance values from Houdini per triangle-vertex float3 values.
+	void SetVertexInstanceNormalsFromHoudini(TConstArrayView<float> InHoudiniNormals, int32 InNumTriangles);
+	void SetVertexInstanceUTangentsFromHoudini(TConstArrayView<float> InHoudiniUTangents, int32 InNumTriangles);
+	void SetVertexInstanceVTangentsFromHoudini(TConstArrayView<float> InHoudiniVTangents, int32 InNumTriangles);
+	// Same for the UVs (float2 values), V is flipped.
+	void SetVertexInstanceUVsFromHoudini(uint32 InUVLayer, TConstArrayView<float> InHoudiniUVs, int32 InNumTriangles);
+
+	// Converts InNum Houdini float3 vectors to Unreal FVector3f: swaps Y and Z and multiplies by InScale.
+	// Processes 4 vectors per iteration with SIMD. InHoudiniVectors and OutVectors must not overlap.
+	static void ConvertHoudiniVectors(const float* InHoudiniVectors, FVector3f* OutVectors, int32 InNum, float InScale = 1.0f);
+
 	/** Calculate the normals of the mesh by calculating the face normal of each triangle (if a triangle has vertices
 	 * V0, V1, V2, get the vector perpendicular to the face Pf = (V2 - V0) x (V1 - V0). To calculate the
 	 * vertex normal for V0 sum and then normalize all its shared face normals. If bInComputeWeightedNormals is true
@@ -203,6 +235,9 @@ public:
 
 protected:
 
+	// Converts the first InNumTriangles triangles of Houdini float3 values into a vertex instance stream
+	static void SetVertexInstanceVectorsFromHoudini(TArray<FVector3f>& OutStream, TConstArrayView<float> InHoudiniValues, int32 InNumTriangles);
+
 	UPROPERTY()
 	bool bHasNormals;
 
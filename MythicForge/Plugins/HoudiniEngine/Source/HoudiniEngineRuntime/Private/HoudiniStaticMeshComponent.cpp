@@ -30,10 +30,38 @@
 #include "Engine/CollisionProfile.h"
 #include "SceneInterface.h"
 #include "Engine/Texture2D.h" 
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 #include "HoudiniStaticMesh.h"
 #include "HoudiniStaticMeshSceneProxy.h"
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineProxyMeshStaticDrawPath(
+	TEXT("HoudiniEngine.ProxyMeshStaticDrawPath"),
+	1,
+	TEXT("Whether proxy meshes are rendered using cached mesh draw commands (static draw path).\n")
+	TEXT("0: Always use the dynamic draw path\n")
+	TEXT("1: Use the static draw path, unless the mesh is being updated by live cooks (Default)\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineProxyMeshIncrementalUpdates(
+	TEXT("HoudiniEngine.ProxyMeshIncrementalUpdates"),
+	1,
+	TEXT("Whether proxy mesh updates that keep the same triangles and materials only upload the modified streams to the existing scene proxy.\n")
+	TEXT("Only the proxies of meshes being updated by live cooks keep the CPU copies of their vertex buffers this needs.\n")
+	TEXT("0: Always recreate the scene proxy\n")
+	TEXT("1: Update the existing buffers of live updated meshes when possible (Default)\n")
+);
+
+static TAutoConsoleVariable<float> CVarHoudiniEngineProxyMeshLiveUpdateDelay(
+	TEXT("HoudiniEngine.ProxyMeshLiveUpdateDelay"),
+	1.0f,
+	TEXT("Proxy meshes updated again within this delay (in s) use the dynamic draw path,\n")
+	TEXT("until they haven't been updated for that long.\n")
+	TEXT("<= 0.0: Always use the static draw path when enabled\n")
+	TEXT("1.0: Default\n")
+);
+
 
 UHoudiniStaticMeshComponent::UHoudiniStaticMeshComponent(const FObjectInitializer &InInitialzer) :
 	Super(InInitialzer)
@@ -44,6 +72,8 @@ UHoudiniStaticMeshComponent::UHoudiniStaticMeshComponent(const FObjectInitialize
 
 	Mesh = nullptr;
 	bHoudiniIconVisible = true;
+	LastMeshUpdateTime = 0.0;
+	bIsLiveUpdating = false;
 
 #if WITH_EDITOR
 	bVisualizeComponent = true;
@@ -63,6 +93,52 @@ void UHoudiniStaticMeshComponent::OnRegister()
 #endif
 }
 
+void UHoudiniStaticMeshComponent::OnUnregister()
+{
+	if (LiveUpdateTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(LiveUpdateTickerHandle);
+		LiveUpdateTickerHandle.Reset();
+	}
+	bIsLiveUpdating = false;
+	ProxyStreamHashes.Reset();
+
+	Super::OnUnregister();
+}
+
+bool UHoudiniStaticMeshComponent::ShouldUseIncrementalProxyUpdates() const
+{
+	if (CVarHoudiniEngineProxyMeshIncrementalUpdates.GetValueOnGameThread() <= 0)
+		return false;
+
+	// Meshes that aren't updated repeatedly don't need their proxy to keep CPU copies
+	return bIsLiveUpdating;
+}
+
+bool UHoudiniStaticMeshComponent::ShouldUseStaticDrawPath() const
+{
+	if (CVarHoudiniEngineProxyMeshStaticDrawPath.GetValueOnGameThread() <= 0)
+		return false;
+
+	return !bIsLiveUpdating;
+}
+
+bool UHoudiniStaticMeshComponent::TickLiveUpdate(float DeltaTime)
+{
+	const double Delay = CVarHoudiniEngineProxyMeshLiveUpdateDelay.GetValueOnGameThread();
+	if (bIsLiveUpdating && Delay > 0.0 && (FPlatformTime::Seconds() - LastMeshUpdateTime) < Delay)
+		return true;
+
+	// The mesh has stopped changing, recreate the proxy so it uses the cached draw commands
+	LiveUpdateTickerHandle.Reset();
+	if (bIsLiveUpdating)
+	{
+		bIsLiveUpdating = false;
+		MarkRenderStateDirty();
+	}
+	return false;
+}
+
 //void
 //UHoudiniStaticMeshComponent::PostLoad()
 //{
@@ -90,6 +166,18 @@ FPrimitiveSceneProxy* UHoudiniStaticMeshComponent::CreateSceneProxy()
 		NewProxy = new FHoudiniStaticMeshSceneProxy(this, GetScene()->GetFeatureLevel());
 		NewProxy->Build();
 	}
+
+	// Keep track of what was sent to the proxy, to only update the modified streams later on
+	if (NewProxy && NewProxy->HasCPUBufferData())
+	{
+		ProxyStreamHashes = MakeShared<FHoudiniStaticMeshStreamHashes>();
+		ProxyStreamHashes->Compute(Mesh, this);
+	}
+	else
+	{
+		ProxyStreamHashes.Reset();
+	}
+
 	return NewProxy;
 }
 
@@ -136,9 +224,69 @@ void UHoudiniStaticMeshComponent::SetHoudiniIconVisible(bool bInHoudiniIconVisib
 #endif
 }
 
+bool UHoudiniStaticMeshComponent::UpdateSceneProxyBuffers()
+{
+	if (!ShouldUseIncrementalProxyUpdates())
+		return false;
+
+	// Our proxy is the only type of proxy created by this component.
+	// Proxies created while incremental updates were disabled don't have the CPU data needed to update them.
+	FHoudiniStaticMeshSceneProxy* Proxy = static_cast<FHoudiniStaticMeshSceneProxy*>(SceneProxy);
+	if (!Proxy || !Mesh || !ProxyStreamHashes.IsValid() || IsRenderStateDirty() || !Proxy->HasCPUBufferData())
+		return false;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHoudiniStaticMeshComponent::UpdateSceneProxyBuffers);
+
+	TSharedPtr<FHoudiniStaticMeshStreamHashes> NewStreamHashes = MakeShared<FHoudiniStaticMeshStreamHashes>();
+	NewStreamHashes->Compute(Mesh, this);
+	if (!NewStreamHashes->HasSameLayout(*ProxyStreamHashes))
+		return false;
+
+	TSharedPtr<FHoudiniStaticMeshBufferUpdate> Update = MakeShared<FHoudiniStaticMeshBufferUpdate>();
+	FHoudiniStaticMeshSceneProxy::CreateBufferUpdate(Mesh, *ProxyStreamHashes, *NewStreamHashes, *Update);
+	ProxyStreamHashes = NewStreamHashes;
+
+	if (!Update->IsEmpty())
+	{
+		ENQUEUE_RENDER_COMMAND(FHoudiniStaticMeshComponent_UpdateSceneProxyBuffers)(
+			[Proxy, Update](FRHICommandListImmediate& RHICmdList)
+		{
+			Proxy->UpdateBuffers_RenderThread(RHICmdList, *Update);
+		});
+	}
+
+	return true;
+}
+
 void UHoudiniStaticMeshComponent::NotifyMeshUpdated()
 {
-	MarkRenderStateDirty();
+	// When only vertex data changed, the existing proxy (and its cached draw commands) is kept
+	const double Now = FPlatformTime::Seconds();
+	const bool bUpdatedProxyBuffers = UpdateSceneProxyBuffers();
+	if (bUpdatedProxyBuffers)
+	{
+		// Still live updating, keep the proxy and its CPU copies until the updates settle
+		LastMeshUpdateTime = Now;
+	}
+	else
+	{
+		// Rebuilding the cached draw commands on every update is wasteful when the mesh keeps changing:
+		// consecutive updates switch the proxy to the dynamic draw path, and to incremental updates, until they settle.
+		const double Delay = CVarHoudiniEngineProxyMeshLiveUpdateDelay.GetValueOnGameThread();
+		if (IsRegistered() && Delay > 0.0 && LastMeshUpdateTime > 0.0 && (Now - LastMeshUpdateTime) < Delay)
+		{
+			bIsLiveUpdating = true;
+			if (!LiveUpdateTickerHandle.IsValid())
+			{
+				LiveUpdateTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+					FTickerDelegate::CreateUObject(this, &UHoudiniStaticMeshComponent::TickLiveUpdate), Delay);
+			}
+		}
+		LastMeshUpdateTime = Now;
+
+		MarkRenderStateDirty();
+	}
+
 	if (Mesh)
 	{
 		LocalBounds = Mesh->CalcBounds();
@@ -150,6 +298,10 @@ void UHoudiniStaticMeshComponent::NotifyMeshUpdated()
 
 	UpdateBounds();
 
+	// Send the new bounds to the proxy we kept
+	if (bUpdatedProxyBuffers)
+		MarkRenderTransformDirty();
+
 #if WITH_EDITORONLY_DATA
 	UpdateSpriteComponent();
 #endif
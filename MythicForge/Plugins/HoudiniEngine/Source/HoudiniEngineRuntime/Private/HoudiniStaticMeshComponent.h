@@ -28,11 +28,13 @@
 
 #include "CoreMinimal.h"
 #include "Components/MeshComponent.h"
+#include "Containers/Ticker.h"
 
 #include "HoudiniStaticMeshComponent.generated.h"
 
 class UHoudiniStaticMesh;
 class UBillboardComponent;
+struct FHoudiniStaticMeshStreamHashes;
 
 UCLASS(EditInlineNew, ClassGroup = "Houdini Engine | Rendering")
 class HOUDINIENGINERUNTIME_API UHoudiniStaticMeshComponent : public UMeshComponent
@@ -56,6 +58,16 @@ public:
 	
 	virtual void OnRegister() override;
 
+	virtual void OnUnregister() override;
+
+	// Returns true if the scene proxy can use the cached (static) draw path.
+	// Meshes that are updated repeatedly (live cooks) use the dynamic path until the updates settle.
+	bool ShouldUseStaticDrawPath() const;
+
+	// Returns true if the scene proxy is updated in place when only vertex data changes,
+	// the proxy then keeps CPU copies of its vertex buffers. Only done while the mesh is live updating.
+	bool ShouldUseIncrementalProxyUpdates() const;
+
 	//virtual void PostLoad() override;
 
 	// UPrimitiveComponent interface
@@ -86,6 +98,13 @@ protected:
 	virtual void UpdateSpriteComponent();
 #endif
 
+	// Sends the streams of the mesh that changed since the scene proxy was built to the proxy's buffers.
+	// Returns false if the proxy needs to be recreated (no proxy, different topology or materials...)
+	bool UpdateSceneProxyBuffers();
+
+	// Ticker callback: recreates the render state with the static draw path once the mesh stopped updating.
+	bool TickLiveUpdate(float DeltaTime);
+
 	/** The mesh. */
 	UPROPERTY(EditAnywhere, Category = "Mesh")
 	TObjectPtr<UHoudiniStaticMesh> Mesh;
@@ -97,4 +116,16 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Icons")
 	bool bHoudiniIconVisible;
 
+	// Time (in s) of the last NotifyMeshUpdated call
+	double LastMeshUpdateTime;
+
+	// Indicates the mesh is being updated repeatedly and the proxy should use the dynamic draw path
+	bool bIsLiveUpdating;
+
+	// Ticker handle used to switch back to the static draw path once updates have settled
+	FTSTicker::FDelegateHandle LiveUpdateTickerHandle;
+
+	// Hashes of the mesh streams currently in the scene proxy's buffers
+	TSharedPtr<FHoudiniStaticMeshStreamHashes> ProxyStreamHashes;
+
 };
\ No newline at end of file
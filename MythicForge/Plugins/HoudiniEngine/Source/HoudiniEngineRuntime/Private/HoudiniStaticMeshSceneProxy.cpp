@@ -31,6 +31,7 @@
 #include "PrimitiveViewRelevance.h"
 #include "Engine/Engine.h"
 #include "Runtime/Launch/Resources/Version.h"
+#include "Hash/CityHash.h"
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION > 1
 	#include "MaterialDomain.h"
 	#include "Materials/MaterialRenderProxy.h"
@@ -42,8 +43,131 @@
 #include "HoudiniStaticMeshComponent.h"
 #include "HoudiniStaticMesh.h"
 
+DECLARE_STATS_GROUP(TEXT("HoudiniEngine"), STATGROUP_HoudiniEngine, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Proxy Mesh Static Batches"), STAT_HoudiniProxyMeshStaticBatches, STATGROUP_HoudiniEngine);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Proxy Mesh Static Proxies"), STAT_HoudiniProxyMeshStaticProxies, STATGROUP_HoudiniEngine);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Proxy Mesh Dynamic Proxies"), STAT_HoudiniProxyMeshDynamicProxies, STATGROUP_HoudiniEngine);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Proxy Mesh Dynamic Batches"), STAT_HoudiniProxyMeshDynamicBatches, STATGROUP_HoudiniEngine);
+DECLARE_CYCLE_STAT(TEXT("Proxy Mesh GetDynamicMeshElements"), STAT_HoudiniProxyMeshGetDynamicMeshElements, STATGROUP_HoudiniEngine);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Proxy Mesh Incremental Updates"), STAT_HoudiniProxyMeshIncrementalUpdates, STATGROUP_HoudiniEngine);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Proxy Mesh Incremental Upload Bytes"), STAT_HoudiniProxyMeshIncrementalUploadBytes, STATGROUP_HoudiniEngine);
+
 // Based on: Plugins\Experimental\MeshModelingToolset\Source\ModelingComponents\Private\BaseDynamicMeshSceneProxy.h
 
+//
+// FHoudiniStaticMeshStreamHashes
+//
+
+template<typename ElementType>
+static uint64
+HashStreamRange(const ElementType* InData, int32 InNum, uint64 InSeed)
+{
+	return CityHash64WithSeed(reinterpret_cast<const char*>(InData), InNum * sizeof(ElementType), InSeed);
+}
+
+// Number of triangles in the given chunk, only the last chunk of a mesh can be partial
+static int32
+GetNumChunkTriangles(int32 InChunkIdx, int32 InNumTriangles)
+{
+	return FMath::Min(FHoudiniStaticMeshStreamHashes::TrianglesPerChunk, InNumTriangles - InChunkIdx * FHoudiniStaticMeshStreamHashes::TrianglesPerChunk);
+}
+
+void FHoudiniStaticMeshStreamHashes::Compute(const UHoudiniStaticMesh* InMesh, const UHoudiniStaticMeshComponent* InComponent)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniStaticMeshStreamHashes::Compute);
+
+	check(InMesh);
+
+	NumTriangles = InMesh->GetNumTriangles();
+	NumUVLayers = InMesh->GetNumUVLayers();
+	bHasNormals = InMesh->HasNormals();
+	bHasTangents = InMesh->HasTangents();
+	bHasColors = InMesh->HasColors();
+
+	const TArray<FVector3f>& VertexPositions = InMesh->GetVertexPositions();
+	const TArray<FIntVector>& TriangleIndices = InMesh->GetTriangleIndices();
+	const TArray<FColor>& VertexInstanceColors = InMesh->GetVertexInstanceColors();
+	const TArray<FVector3f>& VertexInstanceNormals = InMesh->GetVertexInstanceNormals();
+	const TArray<FVector3f>& VertexInstanceUTangents = InMesh->GetVertexInstanceUTangents();
+	const TArray<FVector3f>& VertexInstanceVTangents = InMesh->GetVertexInstanceVTangents();
+	const TArray<FVector2f>& VertexInstanceUVs = InMesh->GetVertexInstanceUVs();
+	const int32 NumVertexInstances = InMesh->GetNumVertexInstances();
+
+	// The buffer sets depend on the triangles, their materials and the component's materials
+	LayoutHash = HashStreamRange(TriangleIndices.GetData(), TriangleIndices.Num(), 0);
+	if (InMesh->HasPerFaceMaterials())
+	{
+		const TArray<int32>& MaterialIDsPerTriangle = InMesh->GetMaterialIDsPerTriangle();
+		LayoutHash = HashStreamRange(MaterialIDsPerTriangle.GetData(), MaterialIDsPerTriangle.Num(), LayoutHash);
+	}
+	if (InComponent)
+	{
+		const int32 NumMaterials = InComponent->GetNumMaterials();
+		LayoutHash = HashStreamRange(&NumMaterials, 1, LayoutHash);
+		for (int32 MaterialIdx = 0; MaterialIdx < NumMaterials; ++MaterialIdx)
+		{
+			const UMaterialInterface* Material = InComponent->GetMaterial(MaterialIdx);
+			LayoutHash = HashStreamRange(&Material, 1, LayoutHash);
+		}
+	}
+
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumTriangles, TrianglesPerChunk);
+	PositionHashes.SetNumUninitialized(NumChunks);
+	ColorHashes.SetNumUninitialized(NumChunks);
+	TangentHashes.SetNumUninitialized(NumChunks);
+	UVHashes.SetNumUninitialized(NumChunks);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
+	{
+		const int32 FirstTriangle = ChunkIdx * TrianglesPerChunk;
+		const int32 NumChunkTriangles = GetNumChunkTriangles(ChunkIdx, NumTriangles);
+		const int32 FirstVertexInstance = FirstTriangle * 3;
+		const int32 NumChunkVertexInstances = NumChunkTriangles * 3;
+
+		// Positions are hashed per triangle vertex, as they are stored in the buffers
+		TArray<FVector3f> ChunkPositions;
+		ChunkPositions.SetNumUninitialized(NumChunkVertexInstances);
+		for (int32 TriangleIdx = 0; TriangleIdx < NumChunkTriangles; ++TriangleIdx)
+		{
+			const FIntVector& TriIndices = TriangleIndices[FirstTriangle + TriangleIdx];
+			for (int32 TriVertIdx = 0; TriVertIdx < 3; ++TriVertIdx)
+				ChunkPositions[TriangleIdx * 3 + TriVertIdx] = VertexPositions[TriIndices[TriVertIdx]];
+		}
+		PositionHashes[ChunkIdx] = HashStreamRange(ChunkPositions.GetData(), ChunkPositions.Num(), 0);
+
+		ColorHashes[ChunkIdx] = bHasColors ? HashStreamRange(VertexInstanceColors.GetData() + FirstVertexInstance, NumChunkVertexInstances, 0) : 0;
+
+		uint64 TangentHash = 0;
+		if (bHasNormals)
+			TangentHash = HashStreamRange(VertexInstanceNormals.GetData() + FirstVertexInstance, NumChunkVertexInstances, TangentHash);
+		if (bHasTangents)
+		{
+			TangentHash = HashStreamRange(VertexInstanceUTangents.GetData() + FirstVertexInstance, NumChunkVertexInstances, TangentHash);
+			TangentHash = HashStreamRange(VertexInstanceVTangents.GetData() + FirstVertexInstance, NumChunkVertexInstances, TangentHash);
+		}
+		TangentHashes[ChunkIdx] = TangentHash;
+
+		uint64 UVHash = 0;
+		for (uint32 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
+			UVHash = HashStreamRange(VertexInstanceUVs.GetData() + UVLayerIdx * NumVertexInstances + FirstVertexInstance, NumChunkVertexInstances, UVHash);
+		UVHashes[ChunkIdx] = UVHash;
+	});
+}
+
+bool FHoudiniStaticMeshStreamHashes::HasSameLayout(const FHoudiniStaticMeshStreamHashes& InOther) const
+{
+	return NumTriangles == InOther.NumTriangles
+		&& NumUVLayers == InOther.NumUVLayers
+		&& bHasNormals == InOther.bHasNormals
+		&& bHasTangents == InOther.bHasTangents
+		&& bHasColors == InOther.bHasColors
+		&& LayoutHash == InOther.LayoutHash;
+}
+
+//
+// End - FHoudiniStaticMeshStreamHashes
+//
+
 //
 // FHoudiniStaticMeshRenderBufferSet
 //
@@ -158,16 +282,30 @@ FHoudiniStaticMeshSceneProxy::FHoudiniStaticMeshSceneProxy(UHoudiniStaticMeshCom
 	, FeatureLevel(InFeatureLevel)
 	, Component(InComponent)
 	, MaterialRelevance(InComponent ? InComponent->GetMaterialRelevance(InFeatureLevel) : FMaterialRelevance())
+	, bUseStaticDrawPath(InComponent ? InComponent->ShouldUseStaticDrawPath() : false)
+	, NumStaticBatches(0)
+	, bKeepCPUBufferData(InComponent ? InComponent->ShouldUseIncrementalProxyUpdates() : false)
+	, SingleBufferSetIdx(INDEX_NONE)
 #if STATICMESH_ENABLE_DEBUG_RENDERING
 	, Owner(InComponent ? InComponent->GetOwner() : nullptr)
 #endif
 {
+	if (bUseStaticDrawPath)
+		INC_DWORD_STAT(STAT_HoudiniProxyMeshStaticProxies);
+	else
+		INC_DWORD_STAT(STAT_HoudiniProxyMeshDynamicProxies);
 }
 
 FHoudiniStaticMeshSceneProxy::~FHoudiniStaticMeshSceneProxy()
 {
 	//check(IsInRenderingThread());
 
+	if (bUseStaticDrawPath)
+		DEC_DWORD_STAT(STAT_HoudiniProxyMeshStaticProxies);
+	else
+		DEC_DWORD_STAT(STAT_HoudiniProxyMeshDynamicProxies);
+	DEC_DWORD_STAT_BY(STAT_HoudiniProxyMeshStaticBatches, NumStaticBatches);
+
 	for (FHoudiniStaticMeshRenderBufferSet* BufferSet : BufferSets)
 	{
 		FHoudiniStaticMeshRenderBufferSet::DestroyRenderBufferSet(BufferSet);
@@ -252,8 +390,75 @@ void FHoudiniStaticMeshSceneProxy::Build()
 	}
 }
 
+void FHoudiniStaticMeshSceneProxy::DrawStaticElements(FStaticPrimitiveDrawInterface* PDI)
+{
+	if (!bUseStaticDrawPath)
+		return;
+
+	// The buffer sets have been copied to the GPU by render commands queued in Build(), before the proxy was added to the scene.
+	// The resulting mesh batches are cached by the renderer until the proxy is recreated.
+	for (const FHoudiniStaticMeshRenderBufferSet* BufferSet : BufferSets)
+	{
+		if (!BufferSet || BufferSet->NumTriangles == 0 || BufferSet->TriangleIndexBuffer.Indices.Num() <= 0)
+			continue;
+
+		UMaterialInterface* Material = BufferSet->Material ? BufferSet->Material : UMaterial::GetDefaultMaterial(MD_Surface);
+
+		FMeshBatch MeshBatch;
+		if (PopulateStaticMeshElement(MeshBatch, *BufferSet, Material->GetRenderProxy()))
+		{
+			PDI->DrawMesh(MeshBatch, FLT_MAX);
+			NumStaticBatches++;
+			INC_DWORD_STAT(STAT_HoudiniProxyMeshStaticBatches);
+		}
+	}
+}
+
+bool FHoudiniStaticMeshSceneProxy::PopulateStaticMeshElement(
+	FMeshBatch& InMeshBatch,
+	const FHoudiniStaticMeshRenderBufferSet& Buffers,
+	FMaterialRenderProxy* Material) const
+{
+	FMeshBatchElement& BatchElement = InMeshBatch.Elements[0];
+	BatchElement.IndexBuffer = &Buffers.TriangleIndexBuffer;
+	// No primitive uniform buffer: the renderer uses this proxy's own uniform buffer for static elements
+	BatchElement.PrimitiveUniformBuffer = nullptr;
+	BatchElement.FirstIndex = 0;
+	BatchElement.NumPrimitives = Buffers.NumTriangles;
+	BatchElement.MinVertexIndex = 0;
+	BatchElement.MaxVertexIndex = Buffers.PositionVertexBuffer.GetNumVertices() - 1;
+
+	InMeshBatch.VertexFactory = &Buffers.LocalVertexFactory;
+	InMeshBatch.MaterialRenderProxy = Material;
+	InMeshBatch.ReverseCulling = IsLocalToWorldDeterminantNegative();
+	InMeshBatch.Type = PT_TriangleList;
+	InMeshBatch.DepthPriorityGroup = SDPG_World;
+	InMeshBatch.LODIndex = 0;
+	InMeshBatch.CastShadow = true;
+	InMeshBatch.bUseAsOccluder = ShouldUseAsOccluder();
+	InMeshBatch.bUseForDepthPass = true;
+	InMeshBatch.bUseForMaterial = true;
+	InMeshBatch.bCanApplyViewModeOverrides = true;
+
+	return true;
+}
+
+bool FHoudiniStaticMeshSceneProxy::UseStaticDrawPathForView(const FSceneView* View) const
+{
+	if (!bUseStaticDrawPath || !View || !View->Family)
+		return false;
+
+	const FEngineShowFlags& EngineShowFlags = View->Family->EngineShowFlags;
+	if (IsRichView(*View->Family) || EngineShowFlags.Wireframe || EngineShowFlags.Bounds)
+		return false;
+
+	return !HasViewDependentDPG();
+}
+
 void FHoudiniStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_HoudiniProxyMeshGetDynamicMeshElements);
+
 	const FEngineShowFlags EngineShowFlags = ViewFamily.EngineShowFlags;
 	const bool bRenderAsWireframe = (AllowDebugViewmodes() && EngineShowFlags.Wireframe);
 
@@ -317,6 +522,7 @@ void FHoudiniStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<const FSc
 				if (PopulateMeshElement(Mesh, *BufferSet, MaterialProxy, false, DepthPriority, ViewIdx, DynamicPrimitiveUniformBuffer))
 				{
 					Collector.AddMesh(ViewIdx, Mesh);
+					INC_DWORD_STAT(STAT_HoudiniProxyMeshDynamicBatches);
 				}
 				if (bRenderAsWireframe)
 				{
@@ -373,7 +579,15 @@ FPrimitiveViewRelevance FHoudiniStaticMeshSceneProxy::GetViewRelevance(const FSc
 	FPrimitiveViewRelevance Result;
 
 	Result.bDrawRelevance = IsShown(View);
-	Result.bDynamicRelevance = true;
+	if (UseStaticDrawPathForView(View))
+	{
+		// Rendered with the cached mesh draw commands registered in DrawStaticElements
+		Result.bStaticRelevance = true;
+	}
+	else
+	{
+		Result.bDynamicRelevance = true;
+	}
 	Result.bRenderCustomDepth = ShouldRenderCustomDepth();
 	Result.bRenderInMainPass = ShouldRenderInMainPass();
 	Result.bShadowRelevance = IsShadowCast(View);
@@ -390,6 +604,38 @@ bool FHoudiniStaticMeshSceneProxy::CanBeOccluded() const
 	return !MaterialRelevance.bDisableDepthTest;
 }
 
+void FHoudiniStaticMeshSceneProxy::GetVertexInstanceTangentBasis(const UHoudiniStaticMesh* InMesh, uint32 InVertexInstanceIdx, FVector3f& OutTangentX, FVector3f& OutTangentY, FVector3f& OutTangentZ)
+{
+	OutTangentZ = InMesh->HasNormals() ? InMesh->GetVertexInstanceNormals()[InVertexInstanceIdx] : FVector3f(0, 0, 1);
+	if (InMesh->HasTangents())
+	{
+		OutTangentX = InMesh->GetVertexInstanceUTangents()[InVertexInstanceIdx];
+		OutTangentY = InMesh->GetVertexInstanceVTangents()[InVertexInstanceIdx];
+	}
+	else
+	{
+		OutTangentZ.FindBestAxisVectors(OutTangentX, OutTangentY);
+	}
+}
+
+bool FHoudiniStaticMeshSceneProxy::GetTriangleBufferSlot(uint32 InTriangleID, int32& OutBufferSetIdx, uint32& OutSlot) const
+{
+	if (TriangleBufferSetIndices.Num() == 0)
+	{
+		OutBufferSetIdx = SingleBufferSetIdx;
+		OutSlot = InTriangleID;
+	}
+	else
+	{
+		if (!TriangleBufferSetIndices.IsValidIndex(InTriangleID))
+			return false;
+		OutBufferSetIdx = TriangleBufferSetIndices[InTriangleID];
+		OutSlot = TriangleSlots[InTriangleID];
+	}
+
+	return BufferSets.IsValidIndex(OutBufferSetIdx) && OutSlot < (uint32)BufferSets[OutBufferSetIdx]->NumTriangles;
+}
+
 void FHoudiniStaticMeshSceneProxy::PopulateBuffers(const UHoudiniStaticMesh *InMesh, FHoudiniStaticMeshRenderBufferSet *InBuffers, const TArray<uint32>* InTriangleIDs, uint32 InTriangleGroupStartIdx, uint32 InNumTrianglesInGroup)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniStaticMeshSceneProxy::PopulateBuffers);
@@ -405,60 +651,49 @@ void FHoudiniStaticMeshSceneProxy::PopulateBuffers(const UHoudiniStaticMesh *InM
 
 	const uint32 NumVertices = NumTriangles * 3;
 	const uint32 NumUVLayers = InMesh->GetNumUVLayers();
+	const uint32 NumVertexInstances = InMesh->GetNumVertexInstances();
 
-	InBuffers->PositionVertexBuffer.Init(NumVertices);
+	// The CPU copies of the vertex buffers are only kept for the incremental updates (see UpdateBuffers_RenderThread)
+	InBuffers->PositionVertexBuffer.Init(NumVertices, bKeepCPUBufferData);
 	// There must be at least one UV layer
 	// TODO: Would it be possible to have no UV layers and bind to a dummy 0/black SRV?
-	InBuffers->StaticMeshVertexBuffer.Init(NumVertices, NumUVLayers > 0 ? NumUVLayers : 1);
-	InBuffers->ColorVertexBuffer.Init(NumVertices);
+	InBuffers->StaticMeshVertexBuffer.Init(NumVertices, NumUVLayers > 0 ? NumUVLayers : 1, bKeepCPUBufferData);
+	InBuffers->ColorVertexBuffer.Init(NumVertices, bKeepCPUBufferData);
 	InBuffers->TriangleIndexBuffer.Indices.AddUninitialized(NumTriangles * 3);
 
 	const TArray<FVector3f>& VertexPositions = InMesh->GetVertexPositions();
 	const TArray<FIntVector>& TriangleIndices = InMesh->GetTriangleIndices();
 	const TArray<FColor>& VertexInstanceColors = InMesh->GetVertexInstanceColors();
-	const TArray<FVector3f>& VertexInstanceNormals = InMesh->GetVertexInstanceNormals();
-	const TArray<FVector3f>& VertexInstanceUTangents = InMesh->GetVertexInstanceUTangents();
-	const TArray<FVector3f>& VertexInstanceVTangents = InMesh->GetVertexInstanceVTangents();
 	const TArray<FVector2f>& VertexInstanceUVs = InMesh->GetVertexInstanceUVs();
 
 	const bool bHasColors = InMesh->HasColors();
-	const bool bHasNormals = InMesh->HasNormals();
-	const bool bHasTangents = InMesh->HasTangents();
 
-	FThreadSafeCounter VertCounter(0);
 	//for (uint32 TriangleIDIdx = 0; TriangleIDIdx < NumTriangles; ++TriangleIDIdx)
 	ParallelFor(NumTriangles, [&](uint32 TriangleIDIdx)
 	{
 		const uint32 TriangleID = InTriangleIDs ? (*InTriangleIDs)[InTriangleGroupStartIdx + TriangleIDIdx] : TriangleIDIdx;
 		const FIntVector &TriIndices = TriangleIndices[TriangleID];
 
-		FVector3f TangentU;
-		FVector3f TangentV;
-		uint32 VertIdx = VertCounter.Add(3);
+		// Buffer vertices are in the same order as the triangles, so a triangle can be found again for incremental updates
+		FVector3f TangentX;
+		FVector3f TangentY;
+		FVector3f TangentZ;
+		uint32 VertIdx = TriangleIDIdx * 3;
 		for (uint8 TriVertIdx = 0; TriVertIdx < 3; ++TriVertIdx)
 		{
-			const uint32 MeshVtxIdx = TriIndices[TriVertIdx];
 			const uint32 MeshVtxInstanceIdx = TriangleID * 3 + TriVertIdx;
 
 			InBuffers->PositionVertexBuffer.VertexPosition(VertIdx) = VertexPositions[TriIndices[TriVertIdx]];
 
-			FVector3f Normal = bHasNormals ? VertexInstanceNormals[MeshVtxInstanceIdx] : FVector3f(0, 0, 1);
-			if (bHasTangents)
-			{
-				TangentU = VertexInstanceUTangents[MeshVtxInstanceIdx];
-				TangentV = VertexInstanceVTangents[MeshVtxInstanceIdx];
-			}
-			else
-			{
-				Normal.FindBestAxisVectors(TangentU, TangentV);
-			}
-			InBuffers->StaticMeshVertexBuffer.SetVertexTangents(VertIdx, TangentU, TangentV, Normal);
+			GetVertexInstanceTangentBasis(InMesh, MeshVtxInstanceIdx, TangentX, TangentY, TangentZ);
+			InBuffers->StaticMeshVertexBuffer.SetVertexTangents(VertIdx, TangentX, TangentY, TangentZ);
 
 			if (NumUVLayers > 0)
 			{
+				// UVs are stored per layer in the mesh
 				for (uint8 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
 				{
-					InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, UVLayerIdx, VertexInstanceUVs[MeshVtxInstanceIdx]);
+					InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, UVLayerIdx, VertexInstanceUVs[UVLayerIdx * NumVertexInstances + MeshVtxInstanceIdx]);
 				}
 			}
 			else
@@ -488,7 +723,8 @@ void FHoudiniStaticMeshSceneProxy::BuildSingleBufferSet()
 	if (BufferSets.Num() == 0)
 		return;
 
-	FHoudiniStaticMeshRenderBufferSet *Buffers = BufferSets.Last();
+	SingleBufferSetIdx = BufferSets.Num() - 1;
+	FHoudiniStaticMeshRenderBufferSet *Buffers = BufferSets[SingleBufferSetIdx];
 
 	PopulateBuffers(Mesh, Buffers);
 
@@ -518,42 +754,43 @@ void FHoudiniStaticMeshSceneProxy::BuildBufferSetsByMaterial()
 
 	const uint32 NumTriangles = MaterialIDsPerTriangle.Num();
 	const uint32 NumMaterials = GetNumMaterials();
-	TArray<FThreadSafeCounter> TriCountPerMaterialSafe;
-	TriCountPerMaterialSafe.Init(FThreadSafeCounter(0), NumMaterials);
 
-	ParallelFor(NumTriangles, [&](uint32 TriangleID)
+	// Group the triangles by material, keeping them in mesh order in each group,
+	// and remember where each triangle went for the incremental buffer updates.
+	TArray<uint32> TriCountPerMaterial;
+	TriCountPerMaterial.SetNumZeroed(NumMaterials);
+	TriangleBufferSetIndices.SetNumUninitialized(NumTriangles);
+	TriangleSlots.SetNumUninitialized(NumTriangles);
+	for (uint32 TriangleID = 0; TriangleID < NumTriangles; ++TriangleID)
 	{
 		const int32 MatID = MaterialIDsPerTriangle[TriangleID];
 		if (MatID >= 0 && (uint32) MatID < NumMaterials)
 		{
-			TriCountPerMaterialSafe[MatID].Increment();
+			TriangleBufferSetIndices[TriangleID] = MatID;
+			TriangleSlots[TriangleID] = TriCountPerMaterial[MatID]++;
 		}
-	});
+		else
+		{
+			TriangleBufferSetIndices[TriangleID] = INDEX_NONE;
+			TriangleSlots[TriangleID] = 0;
+		}
+	}
 
-	TArray<uint32> TriCountPerMaterial;
-	TriCountPerMaterial.SetNumZeroed(NumMaterials);
 	TArray<uint32> OffsetPerMaterial;
 	OffsetPerMaterial.SetNumZeroed(NumMaterials);
-	TArray<FThreadSafeCounter> WrittenPerMaterial;
-	WrittenPerMaterial.Init(FThreadSafeCounter(0), NumMaterials);
-	for (int32 MatID = 0; (uint32) MatID < NumMaterials; ++MatID)
+	for (int32 MatID = 1; (uint32) MatID < NumMaterials; ++MatID)
 	{
-		const uint32 Count = TriCountPerMaterialSafe[MatID].GetValue();
-		TriCountPerMaterial[MatID] = Count;
-		if (MatID > 0)
-		{
-			OffsetPerMaterial[MatID] = OffsetPerMaterial[MatID - 1] + TriCountPerMaterial[MatID - 1];
-		}
+		OffsetPerMaterial[MatID] = OffsetPerMaterial[MatID - 1] + TriCountPerMaterial[MatID - 1];
 	}
 
 	TArray<uint32> GroupTriangleIDs;
 	GroupTriangleIDs.SetNumZeroed(NumTriangles);
 	ParallelFor(NumTriangles, [&](uint32 TriangleID) 
 	{
-		const int32 MatID = MaterialIDsPerTriangle[TriangleID];
-		if (MatID >= 0 && (uint32) MatID < NumMaterials)
+		const int32 MatID = TriangleBufferSetIndices[TriangleID];
+		if (MatID != INDEX_NONE)
 		{
-			GroupTriangleIDs[OffsetPerMaterial[MatID] + WrittenPerMaterial[MatID].Add(1)] = TriangleID;
+			GroupTriangleIDs[OffsetPerMaterial[MatID] + TriangleSlots[TriangleID]] = TriangleID;
 		}
 	});
 
@@ -577,6 +814,263 @@ void FHoudiniStaticMeshSceneProxy::BuildBufferSetsByMaterial()
 	}
 }
 
+void FHoudiniStaticMeshSceneProxy::CreateBufferUpdate(
+	const UHoudiniStaticMesh* InMesh,
+	const FHoudiniStaticMeshStreamHashes& InOldHashes,
+	const FHoudiniStaticMeshStreamHashes& InNewHashes,
+	FHoudiniStaticMeshBufferUpdate& OutUpdate)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniStaticMeshSceneProxy::CreateBufferUpdate);
+
+	check(InMesh);
+	check(InNewHashes.HasSameLayout(InOldHashes));
+
+	const int32 NumTriangles = InNewHashes.NumTriangles;
+	const int32 NumChunks = InNewHashes.GetNumChunks();
+	for (int32 ChunkIdx = 0; ChunkIdx < NumChunks; ++ChunkIdx)
+	{
+		if (InNewHashes.PositionHashes[ChunkIdx] != InOldHashes.PositionHashes[ChunkIdx])
+			OutUpdate.PositionChunks.Add(ChunkIdx);
+		if (InNewHashes.ColorHashes[ChunkIdx] != InOldHashes.ColorHashes[ChunkIdx])
+			OutUpdate.ColorChunks.Add(ChunkIdx);
+		if (InNewHashes.TangentHashes[ChunkIdx] != InOldHashes.TangentHashes[ChunkIdx])
+			OutUpdate.TangentChunks.Add(ChunkIdx);
+		if (InNewHashes.UVHashes[ChunkIdx] != InOldHashes.UVHashes[ChunkIdx])
+			OutUpdate.UVChunks.Add(ChunkIdx);
+	}
+
+	const uint32 NumUVLayers = InNewHashes.NumUVLayers;
+	OutUpdate.NumUVLayers = NumUVLayers;
+
+	// Only the last chunk of the mesh can be partial, so a chunk's data starts at its index in the dirty list * TrianglesPerChunk
+	auto GetNumDirtyVertices = [NumTriangles](const TArray<int32>& InChunks)
+	{
+		if (InChunks.Num() == 0)
+			return 0;
+		return ((InChunks.Num() - 1) * FHoudiniStaticMeshStreamHashes::TrianglesPerChunk + GetNumChunkTriangles(InChunks.Last(), NumTriangles)) * 3;
+	};
+
+	auto ForEachDirtyTriangle = [NumTriangles](const TArray<int32>& InChunks, TFunctionRef<void(int32 TriangleID, int32 DataVertIdx)> InFunc)
+	{
+		ParallelFor(InChunks.Num(), [&](int32 DirtyIdx)
+		{
+			const int32 ChunkIdx = InChunks[DirtyIdx];
+			const int32 FirstTriangle = ChunkIdx * FHoudiniStaticMeshStreamHashes::TrianglesPerChunk;
+			const int32 NumChunkTriangles = GetNumChunkTriangles(ChunkIdx, NumTriangles);
+			for (int32 TriangleIdx = 0; TriangleIdx < NumChunkTriangles; ++TriangleIdx)
+			{
+				InFunc(FirstTriangle + TriangleIdx, (DirtyIdx * FHoudiniStaticMeshStreamHashes::TrianglesPerChunk + TriangleIdx) * 3);
+			}
+		});
+	};
+
+	if (OutUpdate.PositionChunks.Num() > 0)
+	{
+		const TArray<FVector3f>& VertexPositions = InMesh->GetVertexPositions();
+		const TArray<FIntVector>& TriangleIndices = InMesh->GetTriangleIndices();
+		OutUpdate.Positions.SetNumUninitialized(GetNumDirtyVertices(OutUpdate.PositionChunks));
+		ForEachDirtyTriangle(OutUpdate.PositionChunks, [&](int32 TriangleID, int32 DataVertIdx)
+		{
+			const FIntVector& TriIndices = TriangleIndices[TriangleID];
+			for (int32 TriVertIdx = 0; TriVertIdx < 3; ++TriVertIdx)
+				OutUpdate.Positions[DataVertIdx + TriVertIdx] = VertexPositions[TriIndices[TriVertIdx]];
+		});
+	}
+
+	if (OutUpdate.ColorChunks.Num() > 0)
+	{
+		// Colors can only change if the mesh has colors
+		const TArray<FColor>& VertexInstanceColors = InMesh->GetVertexInstanceColors();
+		OutUpdate.Colors.SetNumUninitialized(GetNumDirtyVertices(OutUpdate.ColorChunks));
+		ForEachDirtyTriangle(OutUpdate.ColorChunks, [&](int32 TriangleID, int32 DataVertIdx)
+		{
+			FMemory::Memcpy(&OutUpdate.Colors[DataVertIdx], &VertexInstanceColors[TriangleID * 3], 3 * sizeof(FColor));
+		});
+	}
+
+	if (OutUpdate.TangentChunks.Num() > 0)
+	{
+		OutUpdate.Tangents.SetNumUninitialized(GetNumDirtyVertices(OutUpdate.TangentChunks) * 3);
+		ForEachDirtyTriangle(OutUpdate.TangentChunks, [&](int32 TriangleID, int32 DataVertIdx)
+		{
+			for (int32 TriVertIdx = 0; TriVertIdx < 3; ++TriVertIdx)
+			{
+				FVector3f* Tangents = &OutUpdate.Tangents[(DataVertIdx + TriVertIdx) * 3];
+				GetVertexInstanceTangentBasis(InMesh, TriangleID * 3 + TriVertIdx, Tangents[0], Tangents[1], Tangents[2]);
+			}
+		});
+	}
+
+	if (OutUpdate.UVChunks.Num() > 0)
+	{
+		const TArray<FVector2f>& VertexInstanceUVs = InMesh->GetVertexInstanceUVs();
+		const uint32 NumVertexInstances = InMesh->GetNumVertexInstances();
+		OutUpdate.UVs.SetNumUninitialized(GetNumDirtyVertices(OutUpdate.UVChunks) * NumUVLayers);
+		ForEachDirtyTriangle(OutUpdate.UVChunks, [&](int32 TriangleID, int32 DataVertIdx)
+		{
+			for (int32 TriVertIdx = 0; TriVertIdx < 3; ++TriVertIdx)
+			{
+				for (uint32 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
+				{
+					OutUpdate.UVs[(DataVertIdx + TriVertIdx) * NumUVLayers + UVLayerIdx] = VertexInstanceUVs[UVLayerIdx * NumVertexInstances + TriangleID * 3 + TriVertIdx];
+				}
+			}
+		});
+	}
+}
+
+// A range of buffer vertices to upload
+struct FHoudiniVertexRange
+{
+	int32 BufferSetIdx;
+	uint32 FirstVertex;
+	uint32 NumVertices;
+};
+
+// Appends the given vertex range to OutRanges, merging it with the last range if contiguous
+static void
+AddVertexRange(TArray<FHoudiniVertexRange>& OutRanges, int32 InBufferSetIdx, uint32 InFirstVertex, uint32 InNumVertices)
+{
+	if (OutRanges.Num() > 0)
+	{
+		FHoudiniVertexRange& LastRange = OutRanges.Last();
+		if (LastRange.BufferSetIdx == InBufferSetIdx && LastRange.FirstVertex + LastRange.NumVertices == InFirstVertex)
+		{
+			LastRange.NumVertices += InNumVertices;
+			return;
+		}
+	}
+
+	OutRanges.Add({ InBufferSetIdx, InFirstVertex, InNumVertices });
+}
+
+// Copies the given vertex range of the buffer's CPU data to the GPU
+static void
+UploadVertexRange(FRHICommandListImmediate& RHICmdList, FRHIBuffer* InBuffer, const void* InData, uint32 InStride, const FHoudiniVertexRange& InRange)
+{
+	if (!InBuffer || !InData || InStride == 0)
+		return;
+
+	const uint32 Offset = InRange.FirstVertex * InStride;
+	const uint32 Size = InRange.NumVertices * InStride;
+	void* Dest = RHICmdList.LockBuffer(InBuffer, Offset, Size, RLM_WriteOnly);
+	FMemory::Memcpy(Dest, static_cast<const uint8*>(InData) + Offset, Size);
+	RHICmdList.UnlockBuffer(InBuffer);
+
+	INC_DWORD_STAT_BY(STAT_HoudiniProxyMeshIncrementalUploadBytes, Size);
+}
+
+void FHoudiniStaticMeshSceneProxy::UpdateBuffers_RenderThread(FRHICommandListImmediate& RHICmdList, const FHoudiniStaticMeshBufferUpdate& InUpdate)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniStaticMeshSceneProxy::UpdateBuffers_RenderThread);
+
+	check(IsInRenderingThread());
+
+	if (!bKeepCPUBufferData)
+		return;
+
+	INC_DWORD_STAT(STAT_HoudiniProxyMeshIncrementalUpdates);
+
+	// Writes the dirty chunks of a stream to the buffers' CPU data, and returns the modified vertex ranges
+	auto WriteStream = [this](const TArray<int32>& InChunks, TFunctionRef<void(FHoudiniStaticMeshRenderBufferSet& Buffers, uint32 VertIdx, int32 DataVertIdx)> InWrite, TArray<FHoudiniVertexRange>& OutRanges)
+	{
+		TArray<TArray<FHoudiniVertexRange>> RangesPerChunk;
+		RangesPerChunk.SetNum(InChunks.Num());
+		ParallelFor(InChunks.Num(), [&](int32 DirtyIdx)
+		{
+			const int32 ChunkIdx = InChunks[DirtyIdx];
+			const uint32 FirstTriangle = ChunkIdx * FHoudiniStaticMeshStreamHashes::TrianglesPerChunk;
+			for (uint32 TriangleIdx = 0; TriangleIdx < (uint32)FHoudiniStaticMeshStreamHashes::TrianglesPerChunk; ++TriangleIdx)
+			{
+				int32 BufferSetIdx = INDEX_NONE;
+				uint32 Slot = 0;
+				if (!GetTriangleBufferSlot(FirstTriangle + TriangleIdx, BufferSetIdx, Slot))
+					continue;
+
+				// Partial chunks are only ever the last one, their missing triangles don't have a slot
+				const int32 DataVertIdx = (DirtyIdx * FHoudiniStaticMeshStreamHashes::TrianglesPerChunk + TriangleIdx) * 3;
+				FHoudiniStaticMeshRenderBufferSet& Buffers = *BufferSets[BufferSetIdx];
+				for (uint32 TriVertIdx = 0; TriVertIdx < 3; ++TriVertIdx)
+					InWrite(Buffers, Slot * 3 + TriVertIdx, DataVertIdx + TriVertIdx);
+
+				AddVertexRange(RangesPerChunk[DirtyIdx], BufferSetIdx, Slot * 3, 3);
+			}
+		});
+
+		for (const TArray<FHoudiniVertexRange>& ChunkRanges : RangesPerChunk)
+		{
+			for (const FHoudiniVertexRange& Range : ChunkRanges)
+				AddVertexRange(OutRanges, Range.BufferSetIdx, Range.FirstVertex, Range.NumVertices);
+		}
+	};
+
+	TArray<FHoudiniVertexRange> Ranges;
+	if (InUpdate.PositionChunks.Num() > 0)
+	{
+		WriteStream(InUpdate.PositionChunks, [&InUpdate](FHoudiniStaticMeshRenderBufferSet& Buffers, uint32 VertIdx, int32 DataVertIdx)
+		{
+			Buffers.PositionVertexBuffer.VertexPosition(VertIdx) = InUpdate.Positions[DataVertIdx];
+		}, Ranges);
+
+		for (const FHoudiniVertexRange& Range : Ranges)
+		{
+			FPositionVertexBuffer& Buffer = BufferSets[Range.BufferSetIdx]->PositionVertexBuffer;
+			UploadVertexRange(RHICmdList, Buffer.VertexBufferRHI.GetReference(), Buffer.GetVertexData(), Buffer.GetStride(), Range);
+		}
+		Ranges.Reset();
+	}
+
+	if (InUpdate.ColorChunks.Num() > 0)
+	{
+		WriteStream(InUpdate.ColorChunks, [&InUpdate](FHoudiniStaticMeshRenderBufferSet& Buffers, uint32 VertIdx, int32 DataVertIdx)
+		{
+			Buffers.ColorVertexBuffer.VertexColor(VertIdx) = InUpdate.Colors[DataVertIdx];
+		}, Ranges);
+
+		for (const FHoudiniVertexRange& Range : Ranges)
+		{
+			FColorVertexBuffer& Buffer = BufferSets[Range.BufferSetIdx]->ColorVertexBuffer;
+			UploadVertexRange(RHICmdList, Buffer.VertexBufferRHI.GetReference(), Buffer.GetVertexData(), Buffer.GetStride(), Range);
+		}
+		Ranges.Reset();
+	}
+
+	if (InUpdate.TangentChunks.Num() > 0)
+	{
+		WriteStream(InUpdate.TangentChunks, [&InUpdate](FHoudiniStaticMeshRenderBufferSet& Buffers, uint32 VertIdx, int32 DataVertIdx)
+		{
+			const FVector3f* Tangents = &InUpdate.Tangents[DataVertIdx * 3];
+			Buffers.StaticMeshVertexBuffer.SetVertexTangents(VertIdx, Tangents[0], Tangents[1], Tangents[2]);
+		}, Ranges);
+
+		for (const FHoudiniVertexRange& Range : Ranges)
+		{
+			FStaticMeshVertexBuffer& Buffer = BufferSets[Range.BufferSetIdx]->StaticMeshVertexBuffer;
+			const uint32 Stride = Buffer.GetNumVertices() > 0 ? Buffer.GetTangentSize() / Buffer.GetNumVertices() : 0;
+			UploadVertexRange(RHICmdList, Buffer.TangentsVertexBuffer.VertexBufferRHI.GetReference(), Buffer.GetTangentData(), Stride, Range);
+		}
+		Ranges.Reset();
+	}
+
+	if (InUpdate.UVChunks.Num() > 0 && InUpdate.NumUVLayers > 0)
+	{
+		const uint32 NumUVLayers = InUpdate.NumUVLayers;
+		WriteStream(InUpdate.UVChunks, [&InUpdate, NumUVLayers](FHoudiniStaticMeshRenderBufferSet& Buffers, uint32 VertIdx, int32 DataVertIdx)
+		{
+			for (uint32 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
+				Buffers.StaticMeshVertexBuffer.SetVertexUV(VertIdx, UVLayerIdx, InUpdate.UVs[DataVertIdx * NumUVLayers + UVLayerIdx]);
+		}, Ranges);
+
+		for (const FHoudiniVertexRange& Range : Ranges)
+		{
+			FStaticMeshVertexBuffer& Buffer = BufferSets[Range.BufferSetIdx]->StaticMeshVertexBuffer;
+			const uint32 Stride = Buffer.GetNumVertices() > 0 ? Buffer.GetTexCoordSize() / Buffer.GetNumVertices() : 0;
+			UploadVertexRange(RHICmdList, Buffer.TexCoordVertexBuffer.VertexBufferRHI.GetReference(), Buffer.GetTexCoordData(), Stride, Range);
+		}
+		Ranges.Reset();
+	}
+}
+
 UMaterialInterface* FHoudiniStaticMeshSceneProxy::GetMaterial(uint32 InMaterialIdx) const
 {
 	if (!Component)
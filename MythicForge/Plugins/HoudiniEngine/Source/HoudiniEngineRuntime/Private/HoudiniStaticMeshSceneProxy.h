@@ -42,6 +42,61 @@
 
 class UHoudiniStaticMesh;
 
+// Per chunk hashes of the UHoudiniStaticMesh streams that were last sent to a proxy.
+// Comparing two sets of hashes tells which streams / triangle ranges changed between two cooks.
+struct FHoudiniStaticMeshStreamHashes
+{
+	// Number of triangles per hashed chunk
+	static constexpr int32 TrianglesPerChunk = 1024;
+
+	// Hash the streams of InMesh, as rendered by InComponent
+	void Compute(const UHoudiniStaticMesh* InMesh, const UHoudiniStaticMeshComponent* InComponent);
+
+	// Returns true if the buffers built for both meshes have the same layout (triangles, materials and attributes),
+	// and can thus be updated in place.
+	bool HasSameLayout(const FHoudiniStaticMeshStreamHashes& InOther) const;
+
+	int32 GetNumChunks() const { return PositionHashes.Num(); }
+
+	int32 NumTriangles = 0;
+	uint32 NumUVLayers = 0;
+	bool bHasNormals = false;
+	bool bHasTangents = false;
+	bool bHasColors = false;
+
+	// Hash of the triangle indices, per face material IDs and materials
+	uint64 LayoutHash = 0;
+
+	TArray<uint64> PositionHashes;
+	TArray<uint64> ColorHashes;
+	// Normals and tangents
+	TArray<uint64> TangentHashes;
+	TArray<uint64> UVHashes;
+};
+
+// Vertex data of the mesh chunks that changed since the proxy was built.
+// Created on the game thread and applied to the proxy's buffers on the render thread.
+struct FHoudiniStaticMeshBufferUpdate
+{
+	bool IsEmpty() const { return PositionChunks.Num() == 0 && ColorChunks.Num() == 0 && TangentChunks.Num() == 0 && UVChunks.Num() == 0; }
+
+	uint32 NumUVLayers = 0;
+
+	// Dirty chunks (of FHoudiniStaticMeshStreamHashes::TrianglesPerChunk triangles) for each stream
+	TArray<int32> PositionChunks;
+	TArray<int32> ColorChunks;
+	TArray<int32> TangentChunks;
+	TArray<int32> UVChunks;
+
+	// Vertex data of the dirty chunks, 3 vertices per triangle, in chunk order
+	TArray<FVector3f> Positions;
+	TArray<FColor> Colors;
+	// TangentX, TangentY, TangentZ per vertex
+	TArray<FVector3f> Tangents;
+	// NumUVLayers per vertex
+	TArray<FVector2f> UVs;
+};
+
 class FHoudiniStaticMeshRenderBufferSet
 {
 public:
@@ -109,7 +164,24 @@ public:
 	// Build buffer sets to render the mesh.
 	virtual void Build();
 
+	// Fills OutUpdate with the vertex data of the chunks that differ between InOldHashes and InNewHashes.
+	// InNewHashes must have been computed from InMesh and have the same layout as InOldHashes.
+	static void CreateBufferUpdate(
+		const UHoudiniStaticMesh* InMesh,
+		const FHoudiniStaticMeshStreamHashes& InOldHashes,
+		const FHoudiniStaticMeshStreamHashes& InNewHashes,
+		FHoudiniStaticMeshBufferUpdate& OutUpdate);
+
+	// Returns true if the vertex buffers keep a CPU copy of their data, required by UpdateBuffers_RenderThread.
+	bool HasCPUBufferData() const { return bKeepCPUBufferData; }
+
+	// Writes the update to the CPU copies of the buffers and only uploads the modified vertex ranges.
+	// @warning Render thread only.
+	void UpdateBuffers_RenderThread(FRHICommandListImmediate& RHICmdList, const FHoudiniStaticMeshBufferUpdate& InUpdate);
+
 	// FPrimitiveSceneProxy
+	virtual void DrawStaticElements(FStaticPrimitiveDrawInterface* PDI) override;
+
 	virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const override;
 
 	virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const override;
@@ -132,6 +204,13 @@ public:
 	ERHIFeatureLevel::Type FeatureLevel;
 
 protected:
+	// Returns the tangent basis used for the given vertex instance of InMesh
+	static void GetVertexInstanceTangentBasis(const UHoudiniStaticMesh* InMesh, uint32 InVertexInstanceIdx, FVector3f& OutTangentX, FVector3f& OutTangentY, FVector3f& OutTangentZ);
+
+	// Finds the buffer set and the index of the triangle in that buffer set for the mesh triangle InTriangleID.
+	// Returns false if the triangle is not rendered.
+	bool GetTriangleBufferSlot(uint32 InTriangleID, int32& OutBufferSetIdx, uint32& OutSlot) const;
+
 	void PopulateBuffers(const UHoudiniStaticMesh *InMesh, FHoudiniStaticMeshRenderBufferSet *InBuffers, const TArray<uint32>* InTriangleIDs=nullptr, uint32 InTriangleGroupStartIdx=0u, uint32 InNumTrianglesInGroup=0u);
 
 	// Virtual function for creating a new buffer set instances.
@@ -156,12 +235,38 @@ protected:
 		int ViewIndex,
 		FDynamicPrimitiveUniformBuffer& DynamicPrimitiveUniformBuffer) const;
 
+	// Fills the mesh batch used by the cached (static) draw path.
+	virtual bool PopulateStaticMeshElement(
+		FMeshBatch& InMeshBatch,
+		const FHoudiniStaticMeshRenderBufferSet& Buffers,
+		FMaterialRenderProxy* Material) const;
+
+	// Returns true if View should be rendered with the static elements.
+	// Views needing debug rendering (wireframe, bounds...) always go through GetDynamicMeshElements.
+	bool UseStaticDrawPathForView(const FSceneView* View) const;
+
 	virtual UMaterialInterface* GetMaterial(uint32 InMaterialIdx) const;
 
 	UHoudiniStaticMeshComponent *Component;
 
+	// Whether the buffers are stable enough to use cached mesh draw commands (DrawStaticElements).
+	// False while the mesh is being updated by live cooks, we then only render via GetDynamicMeshElements.
+	bool bUseStaticDrawPath;
+
+	// Number of batches registered via DrawStaticElements, for stats.
+	uint32 NumStaticBatches;
+
+	// Whether the vertex buffers keep their CPU data after being uploaded, only needed for incremental updates.
+	bool bKeepCPUBufferData;
+
 	TArray<FHoudiniStaticMeshRenderBufferSet*> BufferSets;
 
+	// Buffer set index and triangle index in that set, for each mesh triangle, when the mesh is split by material.
+	// Empty if the whole mesh is in SingleBufferSetIdx, in mesh triangle order.
+	TArray<int32> TriangleBufferSetIndices;
+	TArray<uint32> TriangleSlots;
+	int32 SingleBufferSetIdx;
+
 	FCriticalSection BufferSetsLock;
 
 	FMaterialRelevance MaterialRelevance;
@@ -3,7 +3,12 @@
 #if WITH_DEV_AUTOMATION_TESTS
 
 #include "HoudiniRuntimeTests.h"
+#include "HoudiniActorSpatialIndex.h"
 #include "HoudiniEngineRuntime.h"
+#include "HoudiniGenericAttribute.h"
+#include "HoudiniStaticMesh.h"
+#include "HoudiniStaticMeshSceneProxy.h"
+#include "Components/StaticMeshComponent.h"
 #include "Misc/AutomationTest.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniRuntimeTestAutomation, "Houdini.Runtime.TestAutomation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
@@ -14,4 +19,188 @@ bool HoudiniRuntimeTestAutomation::RunTest(const FString & Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniRuntimeStaticMeshBulkSetters, "Houdini.Runtime.StaticMesh.BulkSetters", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniRuntimeStaticMeshBulkSetters::RunTest(const FString & Parameters)
+{
+	// ConvertHoudiniVectors: SIMD body (4 vectors) + scalar tail (3 vectors)
+	const int32 NumVectors = 7;
+	TArray<float> HoudiniVectors;
+	for (int32 Idx = 0; Idx < NumVectors * 3; ++Idx)
+		HoudiniVectors.Add((float)Idx);
+
+	TArray<FVector3f> Converted;
+	Converted.SetNumZeroed(NumVectors);
+	UHoudiniStaticMesh::ConvertHoudiniVectors(HoudiniVectors.GetData(), Converted.GetData(), NumVectors, 100.0f);
+	for (int32 Idx = 0; Idx < NumVectors; ++Idx)
+	{
+		const FVector3f Expected(HoudiniVectors[Idx * 3 + 0] * 100.0f, HoudiniVectors[Idx * 3 + 2] * 100.0f, HoudiniVectors[Idx * 3 + 1] * 100.0f);
+		TestEqual(FString::Printf(TEXT("Converted vector %d"), Idx), Converted[Idx], Expected);
+	}
+
+	// Two triangles sharing an edge, built from 3 of 4 Houdini points
+	UHoudiniStaticMesh* Mesh = NewObject<UHoudiniStaticMesh>();
+	Mesh->Initialize(4, 2, 1, 0, true, false, false, false);
+
+	const TArray<float> PartPositions = { 0, 0, 0,  9, 9, 9,  1, 2, 3,  4, 5, 6,  7, 8, 9 };
+	const TArray<int32> PointIndices = { 0, 2, 3, 4 };
+	TestTrue(TEXT("Valid point indices"), Mesh->SetVertexPositionsFromHoudini(PartPositions, PointIndices, 100.0f));
+	TestEqual(TEXT("Gathered position"), Mesh->GetVertexPositions()[1], FVector3f(100.0f, 300.0f, 200.0f));
+
+	const TArray<int32> TriangleVertexIndices = { 0, 2, 1, 1, 2, 3 };
+	Mesh->SetTriangleIndices(TriangleVertexIndices);
+	TestEqual(TEXT("Triangle indices"), Mesh->GetTriangleIndices()[1], FIntVector(1, 2, 3));
+
+	// Per triangle-vertex normals in Houdini order, the mesh stores them as 0 2 1
+	TArray<float> HoudiniNormals;
+	for (int32 Idx = 0; Idx < 2 * 3 * 3; ++Idx)
+		HoudiniNormals.Add((float)Idx);
+	Mesh->SetVertexInstanceNormalsFromHoudini(HoudiniNormals, 2);
+	TestEqual(TEXT("Normal winding 0"), Mesh->GetVertexInstanceNormals()[3], FVector3f(9.0f, 11.0f, 10.0f));
+	TestEqual(TEXT("Normal winding 1"), Mesh->GetVertexInstanceNormals()[4], FVector3f(15.0f, 17.0f, 16.0f));
+	TestEqual(TEXT("Normal winding 2"), Mesh->GetVertexInstanceNormals()[5], FVector3f(12.0f, 14.0f, 13.0f));
+
+	const TArray<float> HoudiniUVs = { 0.0f, 0.0f, 0.1f, 0.2f, 0.3f, 0.4f,  0.5f, 0.5f, 0.6f, 0.7f, 0.8f, 0.9f };
+	Mesh->SetVertexInstanceUVsFromHoudini(0, HoudiniUVs, 2);
+	TestEqual(TEXT("UV flip and winding"), Mesh->GetVertexInstanceUVs()[4], FVector2f(0.8f, 1.0f - 0.9f));
+
+	TestFalse(TEXT("Invalid point indices"), Mesh->SetVertexPositionsFromHoudini(PartPositions, TArray<int32>({ 0, 1, 2, 5 }), 1.0f));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniRuntimeStaticMeshIncrementalUpdate, "Houdini.Runtime.StaticMesh.IncrementalUpdate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniRuntimeStaticMeshIncrementalUpdate::RunTest(const FString & Parameters)
+{
+	// Two full chunks and a partial one, triangles don't share points
+	const int32 ChunkSize = FHoudiniStaticMeshStreamHashes::TrianglesPerChunk;
+	const int32 NumTriangles = ChunkSize * 2 + 10;
+	UHoudiniStaticMesh* Mesh = NewObject<UHoudiniStaticMesh>();
+	Mesh->Initialize(NumTriangles * 3, NumTriangles, 0, 0, false, false, true, false);
+
+	TArray<FVector3f> Positions;
+	TArray<FIntVector> Triangles;
+	for (int32 TriangleIdx = 0; TriangleIdx < NumTriangles; ++TriangleIdx)
+	{
+		Triangles.Add(FIntVector(TriangleIdx * 3, TriangleIdx * 3 + 1, TriangleIdx * 3 + 2));
+		for (int32 TriVertIdx = 0; TriVertIdx < 3; ++TriVertIdx)
+			Positions.Add(FVector3f((float)TriangleIdx, (float)TriVertIdx, 0.0f));
+	}
+	Mesh->SetVertexPositions(CopyTemp(Positions));
+	Mesh->SetTriangleIndices(CopyTemp(Triangles));
+
+	FHoudiniStaticMeshStreamHashes OldHashes;
+	OldHashes.Compute(Mesh, nullptr);
+	TestEqual(TEXT("Number of chunks"), OldHashes.GetNumChunks(), 3);
+
+	// Move a point of the second chunk and one of the partial chunk
+	Positions[(ChunkSize + 5) * 3].Z = 1.0f;
+	Positions[(NumTriangles - 1) * 3 + 2].Z = 1.0f;
+	Mesh->SetVertexPositions(CopyTemp(Positions));
+
+	FHoudiniStaticMeshStreamHashes NewHashes;
+	NewHashes.Compute(Mesh, nullptr);
+	TestTrue(TEXT("Same layout"), NewHashes.HasSameLayout(OldHashes));
+
+	FHoudiniStaticMeshBufferUpdate Update;
+	FHoudiniStaticMeshSceneProxy::CreateBufferUpdate(Mesh, OldHashes, NewHashes, Update);
+	TestEqual(TEXT("Dirty position chunks"), Update.PositionChunks, TArray<int32>({ 1, 2 }));
+	TestEqual(TEXT("No dirty colors"), Update.ColorChunks.Num(), 0);
+	TestEqual(TEXT("No dirty tangents"), Update.TangentChunks.Num(), 0);
+	TestEqual(TEXT("Dirty positions"), Update.Positions.Num(), (ChunkSize + 10) * 3);
+	TestEqual(TEXT("Moved position"), Update.Positions[5 * 3], FVector3f((float)(ChunkSize + 5), 0.0f, 1.0f));
+	TestEqual(TEXT("Moved position in partial chunk"), Update.Positions.Last(), FVector3f((float)(NumTriangles - 1), 2.0f, 1.0f));
+
+	// Changing the triangles requires a new proxy
+	Triangles.Swap(0, 1);
+	Mesh->SetTriangleIndices(CopyTemp(Triangles));
+	FHoudiniStaticMeshStreamHashes TopologyHashes;
+	TopologyHashes.Compute(Mesh, nullptr);
+	TestFalse(TEXT("Different layout"), TopologyHashes.HasSameLayout(NewHashes));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniRuntimeSpatialHashGrid, "Houdini.Runtime.SpatialHashGrid", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniRuntimeSpatialHashGrid::RunTest(const FString & Parameters)
+{
+	// 100 unit cells, elements covering more than 8 cells are oversized
+	FHoudiniSpatialHashGrid Grid(100.0, 8);
+	Grid.Update(0, FBox(FVector(10.0), FVector(20.0)));
+	Grid.Update(1, FBox(FVector(-150.0), FVector(-120.0)));
+	Grid.Update(2, FBox(FVector(90.0), FVector(110.0)));
+	Grid.Update(3, FBox(FVector(-1000.0), FVector(1000.0)));
+	TestEqual(TEXT("Number of elements"), Grid.Num(), 4);
+
+	auto Query = [&Grid](const FBox& InBox)
+	{
+		TSet<int32> Ids;
+		Grid.Query(InBox, Ids);
+		TArray<int32> SortedIds = Ids.Array();
+		SortedIds.Sort();
+		return SortedIds;
+	};
+
+	TestEqual(TEXT("Query in a single cell"), Query(FBox(FVector(0.0), FVector(15.0))), TArray<int32>({ 0, 3 }));
+	TestEqual(TEXT("Element spanning cells"), Query(FBox(FVector(105.0), FVector(150.0))), TArray<int32>({ 2, 3 }));
+	TestEqual(TEXT("Negative cells"), Query(FBox(FVector(-130.0), FVector(-100.0))), TArray<int32>({ 1, 3 }));
+	TestEqual(TEXT("Query larger than the occupied cells"), Query(FBox(FVector(-500.0), FVector(500.0))), TArray<int32>({ 0, 1, 2, 3 }));
+	TestEqual(TEXT("Empty cell"), Query(FBox(FVector(2000.0), FVector(2100.0))), TArray<int32>());
+
+	// Move within the same cell, then to another cell
+	Grid.Update(0, FBox(FVector(30.0), FVector(40.0)));
+	TestEqual(TEXT("Moved in the same cell"), Query(FBox(FVector(0.0), FVector(15.0))), TArray<int32>({ 3 }));
+	Grid.Update(0, FBox(FVector(510.0), FVector(520.0)));
+	TestEqual(TEXT("Moved to another cell"), Query(FBox(FVector(500.0), FVector(600.0))), TArray<int32>({ 0, 3 }));
+	TestEqual(TEXT("Removed from the old cell"), Query(FBox(FVector(0.0), FVector(50.0))), TArray<int32>({ 3 }));
+
+	TestTrue(TEXT("Remove element"), Grid.Remove(2));
+	TestFalse(TEXT("Remove missing element"), Grid.Remove(2));
+	TestTrue(TEXT("Remove oversized element"), Grid.Remove(3));
+	TestEqual(TEXT("Removed elements"), Query(FBox(FVector(-500.0), FVector(500.0))), TArray<int32>({ 1 }));
+
+	return true;
+}
+
+#if WITH_EDITOR
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniRuntimeGenericAttributePropertyCache, "Houdini.Runtime.GenericAttribute.PropertyCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniRuntimeGenericAttributePropertyCache::RunTest(const FString & Parameters)
+{
+	UStaticMeshComponent* SMC = NewObject<UStaticMeshComponent>();
+
+	auto FindProperty = [SMC](const FString& InPropertyName, void*& OutContainer, int32& OutChainNum)
+	{
+		FEditPropertyChain PropertyChain;
+		FProperty* FoundProperty = nullptr;
+		bool bExact = false;
+		OutContainer = nullptr;
+		FHoudiniGenericAttribute::TryToFindProperty(
+			SMC, SMC->GetClass(), InPropertyName, PropertyChain, FoundProperty, bExact, OutContainer, false);
+		OutChainNum = PropertyChain.Num();
+		return bExact ? FoundProperty : nullptr;
+	};
+
+	// Nested in the component's body instance: resolved once, then served from the cache
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		void* Container = nullptr;
+		int32 ChainNum = 0;
+		FProperty* Property = FindProperty(TEXT("bSimulatePhysics"), Container, ChainNum);
+		TestNotNull(TEXT("Nested property found"), Property);
+		TestTrue(TEXT("Nested property container"), Container == &SMC->BodyInstance);
+		TestEqual(TEXT("Nested property chain"), ChainNum, 2);
+	}
+
+	void* Container = nullptr;
+	int32 ChainNum = 0;
+	TestNotNull(TEXT("Property found by display name"), FindProperty(TEXT("SimulatePhysics"), Container, ChainNum));
+	TestNull(TEXT("Unknown property"), FindProperty(TEXT("NotAPropertyName"), Container, ChainNum));
+
+	return true;
+}
+#endif
+
 #endif
\ No newline at end of file
@@ -25,6 +25,7 @@
 #include "HoudiniPointCache.h"
 
 #include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
 #include "NiagaraCommon.h"
 #include "NiagaraDataInterface.h"
 #include "NiagaraShared.h"
@@ -119,6 +120,8 @@ public:
 #else
 	BEGIN_SHADER_PARAMETER_STRUCT(FShaderParameters, )
 		SHADER_PARAMETER(int32, NumberOfSamples)
+		SHADER_PARAMETER(int32, SampleWindowStart)
+		SHADER_PARAMETER(int32, SampleWindowStride)
 		SHADER_PARAMETER(int32, NumberOfAttributes)
 		SHADER_PARAMETER(int32, NumberOfPoints)
 		SHADER_PARAMETER(int32, MaxNumberOfIndexesPerPoint)
@@ -349,6 +352,8 @@ public:
 	static const FString LastSpawnTimeBaseName;
 	static const FString LastSpawnTimeRequestBaseName;
 	static const FString FunctionIndexToAttributeIndexBufferBaseName;
+	static const FString SampleWindowStartBaseName;
+	static const FString SampleWindowStrideBaseName;
 
 	// Member variables accessors
 	FORCEINLINE int32 GetNumberOfSamples()const { return HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetNumberOfSamples() : 0; }
@@ -374,6 +379,10 @@ protected:
 
 	virtual bool CopyToInternal(UNiagaraDataInterface* Destination) const override;
 
+	// Sequential playback cursor used by the CPU functions reading points at a given time
+	FHoudiniPointCacheCursor PointCacheCursor;
+	FCriticalSection PlaybackCursorLock;
+
 	// The following state variables are now stored in Niagara on the emitter itself
 	// as opposed to being stored internally.
 	// // Last Spawned PointID
@@ -27,7 +27,10 @@
 #include "HoudiniPointCacheLoaderCSV.h"
 #include "HoudiniPointCacheLoaderJSON.h"
 
+#include "Algo/BinarySearch.h"
+#include "Async/Async.h"
 #include "CoreMinimal.h"
+#include "HAL/FileManager.h"
 #include "HAL/PlatformProcess.h"
 #include "Math/NumericLimits.h"
 #include "Misc/CoreMiscDefines.h" 
@@ -57,7 +60,14 @@ UHoudiniPointCache::UHoudiniPointCache( const FObjectInitializer& ObjectInitiali
 	LastFrame( -FLT_MAX ),
 	MinSampleTime( FLT_MAX ),
 	MaxSampleTime( -FLT_MAX ),
-	Resource(nullptr)
+	bStreamSamples( false ),
+	StreamingWindowFrames( 16 ),
+	Resource(nullptr),
+	SampleTimeIndexSerial(0),
+	StreamingWindowFirstFrame(INDEX_NONE),
+	StreamingWindowCapacity(0),
+	RequestedStreamingWindowTime(0.0f),
+	bStreamingWindowUpdatePending(false)
 {
 	SpecialAttributeIndexes.Init(INDEX_NONE, EHoudiniAttributes::HOUDINI_ATTR_SIZE);
 
@@ -117,10 +127,280 @@ bool UHoudiniPointCache::UpdateFromFile( const FString& TheFileName )
 	if (!Loader)
 		return false;
 
-	return Loader->LoadToAsset(this);
+	// The loaders fill the float sample data, stop reading from the previous streaming file
+	StreamingFile.Reset();
+
+	if (!Loader->LoadToAsset(this))
+	{
+		if (bStreamSamples && !StreamingFileName.IsEmpty())
+			StreamingFile = FHoudiniPointCacheBinaryFile::Open(GetStreamingFilePath());
+
+		return false;
+	}
+
+	BuildSampleTimeIndex();
+
+	UpdateStreamingFile();
+
+	return true;
+}
+
+void UHoudiniPointCache::UpdateStreamingFile()
+{
+	if (bStreamSamples && !StreamingFile.IsValid())
+	{
+		// Move the samples from the asset to a new binary file.
+		// A new file name is used so that the previous file (which might still be mapped) isn't overwritten.
+		const FString PreviousFilePath = StreamingFileName.IsEmpty() ? FString() : GetStreamingFilePath();
+		StreamingFileName = MakeStreamingFileName();
+
+		const FString FilePath = GetStreamingFilePath();
+		if (FHoudiniPointCacheBinaryFile::Write(FilePath, FloatSampleData, NumberOfSamples, NumberOfAttributes, GetAttributeAttributeIndex(EHoudiniAttributes::TIME)))
+			StreamingFile = FHoudiniPointCacheBinaryFile::Open(FilePath);
+
+		if (!StreamingFile.IsValid())
+		{
+			UE_LOG(LogHoudiniNiagara, Warning, TEXT("Could not create the streaming file for %s, its samples will be stored in the asset."), *GetName());
+			IFileManager::Get().Delete(*FilePath, false, true, true);
+			StreamingFileName.Empty();
+			return;
+		}
+
+		FloatSampleData.Empty();
+
+		if (!PreviousFilePath.IsEmpty())
+			IFileManager::Get().Delete(*PreviousFilePath, false, true, true);
+	}
+	else if (!bStreamSamples && StreamingFile.IsValid())
+	{
+		// Bring the samples back in the asset
+		const TArrayView<const float> StreamedValues = StreamingFile->GetFloatData();
+		FloatSampleData = TArray<float>(StreamedValues.GetData(), StreamedValues.Num());
+
+		StreamingFile.Reset();
+		IFileManager::Get().Delete(*GetStreamingFilePath(), false, true, true);
+		StreamingFileName.Empty();
+	}
+}
+
+FString UHoudiniPointCache::MakeStreamingFileName() const
+{
+	return FString::Printf(TEXT("HoudiniNiagara/%s_%s.hpcbin"), *GetName(), *FGuid::NewGuid().ToString());
+}
+
+void UHoudiniPointCache::DeleteStreamingFile()
+{
+	if (StreamingFileName.IsEmpty())
+		return;
+
+	// Unmap the file before removing it
+	StreamingFile.Reset();
+	IFileManager::Get().Delete(*GetStreamingFilePath(), false, true, true);
+	StreamingFileName.Empty();
+}
+#endif
+
+void UHoudiniPointCache::PostLoad()
+{
+	Super::PostLoad();
+
+	if (bStreamSamples && !StreamingFileName.IsEmpty())
+	{
+		StreamingFile = FHoudiniPointCacheBinaryFile::Open(GetStreamingFilePath());
+		if (!StreamingFile.IsValid())
+			UE_LOG(LogHoudiniNiagara, Error, TEXT("Could not open the streaming file %s for %s."), *StreamingFileName, *GetName());
+	}
+
+	BuildSampleTimeIndex();
 }
+
+void UHoudiniPointCache::PostDuplicate(bool bDuplicateForPIE)
+{
+	Super::PostDuplicate(bDuplicateForPIE);
+
+	if (!bStreamSamples || StreamingFileName.IsEmpty())
+		return;
+
+#if WITH_EDITOR
+	if (!bDuplicateForPIE)
+	{
+		// The copy needs its own streaming file, as updating or deleting either asset removes its file
+		const FString SourceFilePath = GetStreamingFilePath();
+		StreamingFileName = MakeStreamingFileName();
+		if (IFileManager::Get().Copy(*GetStreamingFilePath(), *SourceFilePath) != COPY_OK)
+		{
+			UE_LOG(LogHoudiniNiagara, Warning, TEXT("Could not copy the streaming file %s for %s, its samples will be stored in the asset."), *SourceFilePath, *GetName());
+			StreamingFileName.Empty();
+
+			// Bring the samples from the source file back in the asset
+			TUniquePtr<FHoudiniPointCacheBinaryFile> SourceFile = FHoudiniPointCacheBinaryFile::Open(SourceFilePath);
+			if (SourceFile.IsValid())
+			{
+				const TArrayView<const float> StreamedValues = SourceFile->GetFloatData();
+				FloatSampleData = TArray<float>(StreamedValues.GetData(), StreamedValues.Num());
+			}
+
+			bStreamSamples = false;
+			BuildSampleTimeIndex();
+			return;
+		}
+	}
 #endif
 
+	StreamingFile = FHoudiniPointCacheBinaryFile::Open(GetStreamingFilePath());
+	if (!StreamingFile.IsValid())
+		UE_LOG(LogHoudiniNiagara, Error, TEXT("Could not open the streaming file %s for %s."), *StreamingFileName, *GetName());
+
+	BuildSampleTimeIndex();
+}
+
+FString UHoudiniPointCache::GetStreamingFilePath() const
+{
+	return FPaths::ProjectContentDir() / StreamingFileName;
+}
+
+void UHoudiniPointCache::ReadStreamingWindow(int32 FirstFrame, int32& OutFirstSample, TArray<float>& OutFloatData) const
+{
+	OutFirstSample = 0;
+	OutFloatData.SetNumZeroed(StreamingWindowCapacity * FMath::Max(NumberOfAttributes, 0));
+
+	const TArray<FHoudiniPointCacheBinaryFile::FFrame>& Frames = StreamingFile->GetFrames();
+	if (!Frames.IsValidIndex(FirstFrame))
+		return;
+
+	const int32 WindowLastFrame = FMath::Min(FirstFrame + FMath::Max(StreamingWindowFrames, 2), Frames.Num()) - 1;
+	OutFirstSample = Frames[FirstFrame].FirstSample;
+	const int32 NumWindowSamples = Frames[WindowLastFrame].FirstSample + Frames[WindowLastFrame].NumSamples - OutFirstSample;
+
+	StreamingFile->ReadSamples(OutFirstSample, FMath::Min(NumWindowSamples, StreamingWindowCapacity), StreamingWindowCapacity, OutFloatData.GetData());
+}
+
+void UHoudiniPointCache::RequestStreamingWindowUpdate(float Time)
+{
+	if (IsInGameThread())
+	{
+		UpdateStreamingWindow(Time);
+		return;
+	}
+
+	{
+		FScopeLock Lock(&StreamingWindowLock);
+		RequestedStreamingWindowTime = Time;
+		if (bStreamingWindowUpdatePending)
+			return;
+
+		bStreamingWindowUpdatePending = true;
+	}
+
+	// Moving the window reads the file and enqueues render commands, leave that to the game thread
+	TWeakObjectPtr<UHoudiniPointCache> WeakPointCache(this);
+	AsyncTask(ENamedThreads::GameThread, [WeakPointCache]()
+	{
+		UHoudiniPointCache* PointCache = WeakPointCache.Get();
+		if (!PointCache)
+			return;
+
+		float RequestedTime = 0.0f;
+		{
+			FScopeLock Lock(&PointCache->StreamingWindowLock);
+			RequestedTime = PointCache->RequestedStreamingWindowTime;
+			PointCache->bStreamingWindowUpdatePending = false;
+		}
+
+		PointCache->UpdateStreamingWindow(RequestedTime);
+	});
+}
+
+void UHoudiniPointCache::UpdateStreamingWindow(float Time)
+{
+	check(IsInGameThread());
+
+	// Only needed once the samples have been pushed to the GPU, CPU reads go through the mapped file
+	if (!StreamingFile.IsValid() || !Resource.IsValid())
+		return;
+
+	const int32 NumFrames = StreamingFile->GetFrames().Num();
+	const int32 NumWindowFrames = FMath::Max(StreamingWindowFrames, 2);
+	const int32 Frame = StreamingFile->GetFrameIndexAtTime(Time);
+
+	// Values at Time are interpolated with the next frame, keep the previous one for small steps back in time
+	const int32 FirstNeededFrame = FMath::Max(Frame - 1, 0);
+	const int32 LastNeededFrame = FMath::Min(Frame + 1, NumFrames - 1);
+
+	FScopeLock Lock(&StreamingWindowLock);
+	if (StreamingWindowFirstFrame != INDEX_NONE
+		&& FirstNeededFrame >= StreamingWindowFirstFrame
+		&& LastNeededFrame < StreamingWindowFirstFrame + NumWindowFrames)
+		return;
+
+	StreamingWindowFirstFrame = FMath::Clamp(FirstNeededFrame, 0, FMath::Max(NumFrames - NumWindowFrames, 0));
+
+	int32 WindowFirstSample = 0;
+	TArray<float> WindowData;
+	ReadStreamingWindow(StreamingWindowFirstFrame, WindowFirstSample, WindowData);
+
+	FHoudiniPointCacheResource* ThisResource = Resource.Get();
+	ENQUEUE_RENDER_COMMAND(FHoudiniPointCache_UpdateSampleWindow) (
+		[ThisResource, WindowFirstSample, RTWindowData = MoveTemp(WindowData)](FRHICommandListImmediate& CmdList)
+		{
+			if (ThisResource)
+			{
+				ThisResource->UpdateSampleWindow(CmdList, WindowFirstSample, RTWindowData);
+			}
+		}
+	);
+}
+
+void FHoudiniPointCacheCursor::Reset()
+{
+	PointCache = nullptr;
+	SampleTimeIndexSerial = 0;
+	PointSamplePositions.Reset();
+}
+
+void UHoudiniPointCache::BuildSampleTimeIndex()
+{
+	PointSampleOffsets.Reset();
+	PointSampleIndexes.Reset();
+	PointSampleTimes.Reset();
+	SampleTimeIndexSerial++;
+
+	// Without time values, lookups at a given time fall back to the search (and fail)
+	const int32 TimeAttrIndex = GetAttributeAttributeIndex(EHoudiniAttributes::TIME);
+	if (TimeAttrIndex == INDEX_NONE || NumberOfPoints <= 0)
+		return;
+
+	int32 NumIndexes = 0;
+	for (const FPointIndexes& Indexes : PointValueIndexes)
+		NumIndexes += Indexes.SampleIndexes.Num();
+
+	PointSampleOffsets.Reserve(PointValueIndexes.Num() + 1);
+	PointSampleIndexes.Reserve(NumIndexes);
+	PointSampleTimes.Reserve(NumIndexes);
+
+	PointSampleOffsets.Add(0);
+	for (const FPointIndexes& Indexes : PointValueIndexes)
+	{
+		for (int32 SampleIndex : Indexes.SampleIndexes)
+		{
+			float Time = 0.0f;
+			if (!GetFloatValue(SampleIndex, TimeAttrIndex, Time))
+			{
+				// Invalid sample, keep using the search that handles those
+				PointSampleOffsets.Reset();
+				PointSampleIndexes.Reset();
+				PointSampleTimes.Reset();
+				return;
+			}
+
+			PointSampleIndexes.Add(SampleIndex);
+			PointSampleTimes.Add(Time);
+		}
+
+		PointSampleOffsets.Add(PointSampleIndexes.Num());
+	}
+}
+
 // Returns the float value at a given point in the Point Cache
 bool UHoudiniPointCache::GetFloatValue( const int32& sampleIndex, const int32& attrIndex, float& value ) const
 {
@@ -130,10 +410,11 @@ bool UHoudiniPointCache::GetFloatValue( const int32& sampleIndex, const int32& a
     if ( attrIndex < 0 || attrIndex >= NumberOfAttributes )
 		return false;
 
+    const TArrayView<const float> FloatValues = GetFloatSampleValues();
     int32 Index = sampleIndex + ( attrIndex * NumberOfSamples );
-    if ( FloatSampleData.IsValidIndex( Index ) )
+    if ( FloatValues.IsValidIndex( Index ) )
     {
-		value = FloatSampleData[ Index ];
+		value = FloatValues[ Index ];
 		return true;
     }
 
@@ -543,22 +824,11 @@ bool UHoudiniPointCache::GetPointLifeAtTime( const int32& PointID, const float&
 
 bool UHoudiniPointCache::GetPointValueAtTime( const int32& PointID, const int32& AttributeIndex, const float& desiredTime, float& Value ) const
 {
-	int32 PrevSampleIndex = -1;
-	int32 NextSampleIndex = -1;
-	float PrevWeight = 1.0f;
-
-	if ( !GetSampleIndexesForPointAtTime( PointID, desiredTime, PrevSampleIndex, NextSampleIndex, PrevWeight ) )
-		return false;
-
-	float PrevValue, NextValue;
-	if ( !GetFloatValue( PrevSampleIndex, AttributeIndex, PrevValue ) )
-		return false;
-	if ( !GetFloatValue( NextSampleIndex, AttributeIndex, NextValue ) )
+	FHoudiniPointSampleBlend Blend;
+	if ( !GetSampleBlendForPointAtTime( PointID, desiredTime, Blend ) )
 		return false;
 
-	Value = FMath::Lerp( PrevValue, NextValue, PrevWeight );
-
-	return true;
+	return GetFloatValueForBlend( Blend, AttributeIndex, Value );
 }
 
 bool UHoudiniPointCache::GetPointValueAtTimeForString(const int32& PointID, const FString& Attribute, const float& desiredTime, float& Value) const
@@ -583,22 +853,11 @@ bool UHoudiniPointCache::GetPointPositionAtTime( const int32& PointID, const flo
 
 bool UHoudiniPointCache::GetPointVectorValueAtTime( int32 PointID, int32 AttributeIndex, float desiredTime, FVector& Vector, bool DoSwap, bool DoScale ) const
 {
-	int32 PrevSampleIndex = -1;
-	int32 NextSampleIndex = -1;
-	float PrevWeight = 1.0f;
-
-	if ( !GetSampleIndexesForPointAtTime( PointID, desiredTime, PrevSampleIndex, NextSampleIndex, PrevWeight ) )
-		return false;
-
-	FVector PrevVector, NextVector;
-	if ( !GetVectorValue( PrevSampleIndex, AttributeIndex, PrevVector, DoSwap, DoScale ) )
+	FHoudiniPointSampleBlend Blend;
+	if ( !GetSampleBlendForPointAtTime( PointID, desiredTime, Blend ) )
 		return false;
-	if ( !GetVectorValue( NextSampleIndex, AttributeIndex, NextVector, DoSwap, DoScale ) )
-		return false;
-
-	Vector = FMath::Lerp(PrevVector, NextVector, PrevWeight);
 
-	return true;
+	return GetVectorValueForBlend( Blend, AttributeIndex, Vector, DoSwap, DoScale );
 }
 
 bool UHoudiniPointCache::GetPointVectorValueAtTimeForString(int32 PointID, const FString& Attribute, float desiredTime, FVector& Vector, bool DoSwap, bool DoScale) const
@@ -612,22 +871,11 @@ bool UHoudiniPointCache::GetPointVectorValueAtTimeForString(int32 PointID, const
 
 bool UHoudiniPointCache::GetPointVector4ValueAtTime( int32 PointID, int32 AttributeIndex, float desiredTime, FVector4& Vector ) const
 {
-	int32 PrevSampleIndex = -1;
-	int32 NextSampleIndex = -1;
-	float PrevWeight = 1.0f;
-
-	if ( !GetSampleIndexesForPointAtTime( PointID, desiredTime, PrevSampleIndex, NextSampleIndex, PrevWeight ) )
+	FHoudiniPointSampleBlend Blend;
+	if ( !GetSampleBlendForPointAtTime( PointID, desiredTime, Blend ) )
 		return false;
 
-	FVector4 PrevVector, NextVector;
-	if ( !GetVector4Value( PrevSampleIndex, AttributeIndex, PrevVector ) )
-		return false;
-	if ( !GetVector4Value( NextSampleIndex, AttributeIndex, NextVector ) )
-		return false;
-
-	Vector = FMath::Lerp(PrevVector, NextVector, PrevWeight);
-
-	return true;
+	return GetVector4ValueForBlend( Blend, AttributeIndex, Vector );
 }
 
 bool UHoudiniPointCache::GetPointVector4ValueAtTimeForString(int32 PointID, const FString& Attribute, float desiredTime, FVector4& Vector ) const
@@ -641,22 +889,11 @@ bool UHoudiniPointCache::GetPointVector4ValueAtTimeForString(int32 PointID, cons
 
 bool UHoudiniPointCache::GetPointQuatValueAtTime( int32 PointID, int32 AttributeIndex, float desiredTime, FQuat& Quat, bool DoHoudiniToUnrealConversion ) const
 {
-	int32 PrevSampleIndex = -1;
-	int32 NextSampleIndex = -1;
-	float PrevWeight = 1.0f;
-
-	if ( !GetSampleIndexesForPointAtTime( PointID, desiredTime, PrevSampleIndex, NextSampleIndex, PrevWeight ) )
+	FHoudiniPointSampleBlend Blend;
+	if ( !GetSampleBlendForPointAtTime( PointID, desiredTime, Blend ) )
 		return false;
 
-	FQuat PrevQuat, NextQuat;
-	if ( !GetQuatValue( PrevSampleIndex, AttributeIndex, PrevQuat, DoHoudiniToUnrealConversion ) )
-		return false;
-	if ( !GetQuatValue( NextSampleIndex, AttributeIndex, NextQuat, DoHoudiniToUnrealConversion ) )
-		return false;
-
-	Quat = FQuat::Slerp(PrevQuat, NextQuat, PrevWeight);
-
-	return true;
+	return GetQuatValueForBlend( Blend, AttributeIndex, Quat, DoHoudiniToUnrealConversion );
 }
 
 bool UHoudiniPointCache::GetPointQuatValueAtTimeForString(int32 PointID, const FString& Attribute, float desiredTime, FQuat& Quat, bool DoHoudiniToUnrealConversion ) const
@@ -670,53 +907,95 @@ bool UHoudiniPointCache::GetPointQuatValueAtTimeForString(int32 PointID, const F
 
 bool UHoudiniPointCache::GetPointFloatValueAtTime( int32 PointID, int32 AttributeIndex, float desiredTime, float& Value) const
 {
-	int32 PrevSampleIndex = -1;
-	int32 NextSampleIndex = -1;
-	float PrevWeight = 1.0f;
+	FHoudiniPointSampleBlend Blend;
+	if ( !GetSampleBlendForPointAtTime( PointID, desiredTime, Blend ) )
+		return false;
 
-	if ( !GetSampleIndexesForPointAtTime( PointID, desiredTime, PrevSampleIndex, NextSampleIndex, PrevWeight ) )
+	return GetFloatValueForBlend( Blend, AttributeIndex, Value );
+}
+
+bool UHoudiniPointCache::GetPointInt32ValueAtTime( int32 PointID, int32 AttributeIndex, float desiredTime, int32& Value) const
+{
+	FHoudiniPointSampleBlend Blend;
+	if ( !GetSampleBlendForPointAtTime( PointID, desiredTime, Blend ) )
 		return false;
 
+	return GetInt32ValueForBlend( Blend, AttributeIndex, Value );
+}
+
+bool UHoudiniPointCache::GetFloatValueForBlend( const FHoudiniPointSampleBlend& Blend, int32 AttributeIndex, float& Value ) const
+{
 	// Handle the case where we only need one value
-	if (PrevSampleIndex == NextSampleIndex || PrevWeight == 1.0f)
-	{
-		if (!GetFloatValue(PrevSampleIndex, AttributeIndex, Value))
-			return false;
-		return true;
-	}
-	else if (PrevWeight == 0.0f)
-	{
-		if (!GetFloatValue(NextSampleIndex, AttributeIndex, Value))
-			return false;
-		return true;
-	}
+	if ( Blend.PrevSampleIndex == Blend.NextSampleIndex )
+		return GetFloatValue( Blend.PrevSampleIndex, AttributeIndex, Value );
 
 	// Get Previous/Next values and Lerp
 	float PrevValue, NextValue;
-	if ( !GetFloatValue( PrevSampleIndex, AttributeIndex, PrevValue) )
+	if ( !GetFloatValue( Blend.PrevSampleIndex, AttributeIndex, PrevValue ) )
 		return false;
-	if ( !GetFloatValue( NextSampleIndex, AttributeIndex, NextValue) )
+	if ( !GetFloatValue( Blend.NextSampleIndex, AttributeIndex, NextValue ) )
 		return false;
 
-	Value = FMath::Lerp(PrevValue, NextValue, PrevWeight);
+	Value = FMath::Lerp( PrevValue, NextValue, Blend.PrevWeight );
 
 	return true;
 }
 
-bool UHoudiniPointCache::GetPointInt32ValueAtTime( int32 PointID, int32 AttributeIndex, float desiredTime, int32& Value) const
+bool UHoudiniPointCache::GetVectorValueForBlend( const FHoudiniPointSampleBlend& Blend, int32 AttributeIndex, FVector& Vector, bool DoSwap, bool DoScale ) const
+{
+	if ( Blend.PrevSampleIndex == Blend.NextSampleIndex )
+		return GetVectorValue( Blend.PrevSampleIndex, AttributeIndex, Vector, DoSwap, DoScale );
+
+	FVector PrevVector, NextVector;
+	if ( !GetVectorValue( Blend.PrevSampleIndex, AttributeIndex, PrevVector, DoSwap, DoScale ) )
+		return false;
+	if ( !GetVectorValue( Blend.NextSampleIndex, AttributeIndex, NextVector, DoSwap, DoScale ) )
+		return false;
+
+	Vector = FMath::Lerp( PrevVector, NextVector, Blend.PrevWeight );
+
+	return true;
+}
+
+bool UHoudiniPointCache::GetVector4ValueForBlend( const FHoudiniPointSampleBlend& Blend, int32 AttributeIndex, FVector4& Vector ) const
 {
-	int32 PrevSampleIndex = -1;
-	int32 NextSampleIndex = -1;
-	float PrevWeight = 1.0f;
+	if ( Blend.PrevSampleIndex == Blend.NextSampleIndex )
+		return GetVector4Value( Blend.PrevSampleIndex, AttributeIndex, Vector );
 
-	if ( !GetSampleIndexesForPointAtTime( PointID, desiredTime, PrevSampleIndex, NextSampleIndex, PrevWeight ) )
+	FVector4 PrevVector, NextVector;
+	if ( !GetVector4Value( Blend.PrevSampleIndex, AttributeIndex, PrevVector ) )
+		return false;
+	if ( !GetVector4Value( Blend.NextSampleIndex, AttributeIndex, NextVector ) )
 		return false;
 
+	Vector = FMath::Lerp( PrevVector, NextVector, Blend.PrevWeight );
+
+	return true;
+}
+
+bool UHoudiniPointCache::GetQuatValueForBlend( const FHoudiniPointSampleBlend& Blend, int32 AttributeIndex, FQuat& Quat, bool DoHoudiniToUnrealConversion ) const
+{
+	if ( Blend.PrevSampleIndex == Blend.NextSampleIndex )
+		return GetQuatValue( Blend.PrevSampleIndex, AttributeIndex, Quat, DoHoudiniToUnrealConversion );
+
+	FQuat PrevQuat, NextQuat;
+	if ( !GetQuatValue( Blend.PrevSampleIndex, AttributeIndex, PrevQuat, DoHoudiniToUnrealConversion ) )
+		return false;
+	if ( !GetQuatValue( Blend.NextSampleIndex, AttributeIndex, NextQuat, DoHoudiniToUnrealConversion ) )
+		return false;
+
+	Quat = FQuat::Slerp( PrevQuat, NextQuat, Blend.PrevWeight );
+
+	return true;
+}
+
+bool UHoudiniPointCache::GetInt32ValueForBlend( const FHoudiniPointSampleBlend& Blend, int32 AttributeIndex, int32& Value ) const
+{
 	float FloatValue;
-	if ( !GetFloatValue( PrevSampleIndex, AttributeIndex, FloatValue) )
+	if ( !GetFloatValue( Blend.PrevSampleIndex, AttributeIndex, FloatValue ) )
 		return false;
 
-	Value = FMath::FloorToInt(FloatValue);
+	Value = FMath::FloorToInt( FloatValue );
 	return true;
 }
 
@@ -734,13 +1013,121 @@ int32 UHoudiniPointCache::GetMaxNumberOfPointValueIndexes() const
 
 bool UHoudiniPointCache::GetSampleIndexesForPointAtTime(const int32& PointID, const float& desiredTime, int32& PrevSampleIndex, int32& NextSampleIndex, float& PrevWeight ) const
 {
-	float PrevTime = -FLT_MAX;
-	float NextTime = -FLT_MAX;
+	FHoudiniPointSampleBlend Blend;
+	if ( !GetSampleBlendForPointAtTime( PointID, desiredTime, Blend ) )
+		return false;
+
+	PrevSampleIndex = Blend.PrevSampleIndex;
+	NextSampleIndex = Blend.NextSampleIndex;
+	PrevWeight = Blend.PrevWeight;
+
+	return true;
+}
 
+bool UHoudiniPointCache::GetSampleBlendForPointAtTime(int32 PointID, float DesiredTime, FHoudiniPointSampleBlend& OutBlend, FHoudiniPointCacheCursor* InOutCursor) const
+{
 	// Invalid PointID
 	if ( PointID < 0 || PointID >= NumberOfPoints )
 		return false;
 
+	if ( !HasSampleTimeIndex() )
+		return SearchSampleBlendForPointAtTime( PointID, DesiredTime, OutBlend );
+
+	if ( PointID >= PointSampleOffsets.Num() - 1 )
+		return false;
+
+	const int32 Offset = PointSampleOffsets[ PointID ];
+	const int32 NumPointSamples = PointSampleOffsets[ PointID + 1 ] - Offset;
+	if ( NumPointSamples <= 0 )
+		return false;
+
+	const int32* SampleIndexes = PointSampleIndexes.GetData() + Offset;
+	const float* SampleTimes = PointSampleTimes.GetData() + Offset;
+
+	if ( NumPointSamples == 1 )
+	{
+		OutBlend.PrevSampleIndex = SampleIndexes[ 0 ];
+		OutBlend.NextSampleIndex = SampleIndexes[ 0 ];
+		OutBlend.PrevWeight = 0.0f;
+		return true;
+	}
+
+	// Find the segment [Pos, Pos + 1] containing the desired time, clamped to the first/last segment
+	const int32 LastSegment = NumPointSamples - 2;
+	int32 Pos = INDEX_NONE;
+	if ( InOutCursor )
+	{
+		if ( InOutCursor->PointCache != this || InOutCursor->SampleTimeIndexSerial != SampleTimeIndexSerial )
+		{
+			InOutCursor->PointCache = this;
+			InOutCursor->SampleTimeIndexSerial = SampleTimeIndexSerial;
+			InOutCursor->PointSamplePositions.Init( 0, PointSampleOffsets.Num() - 1 );
+		}
+
+		// Playback usually moves forward by less than a sample per lookup, so step forward a few
+		// samples from the last position before falling back to a search
+		int32 CursorPos = FMath::Clamp( InOutCursor->PointSamplePositions[ PointID ], 0, LastSegment );
+		if ( SampleTimes[ CursorPos ] <= DesiredTime )
+		{
+			constexpr int32 MaxForwardSteps = 4;
+			for ( int32 Step = 0; Step < MaxForwardSteps && CursorPos < LastSegment && SampleTimes[ CursorPos + 1 ] <= DesiredTime; ++Step )
+				CursorPos++;
+
+			if ( CursorPos >= LastSegment || SampleTimes[ CursorPos + 1 ] > DesiredTime )
+				Pos = CursorPos;
+		}
+		else if ( CursorPos == 0 )
+		{
+			// Before the point's first sample
+			Pos = 0;
+		}
+	}
+
+	if ( Pos == INDEX_NONE )
+	{
+		const int32 NumAfter = Algo::UpperBound( TArrayView<const float>( SampleTimes, NumPointSamples ), DesiredTime );
+		Pos = FMath::Clamp( NumAfter - 1, 0, LastSegment );
+	}
+
+	if ( InOutCursor )
+		InOutCursor->PointSamplePositions[ PointID ] = Pos;
+
+	const float PrevTime = SampleTimes[ Pos ];
+	const float NextTime = SampleTimes[ Pos + 1 ];
+
+	// Almost matching values
+	if ( FMath::IsNearlyEqual( PrevTime, DesiredTime ) )
+	{
+		OutBlend.PrevSampleIndex = SampleIndexes[ Pos ];
+		OutBlend.NextSampleIndex = SampleIndexes[ Pos ];
+		OutBlend.PrevWeight = 1.0f;
+		return true;
+	}
+
+	if ( FMath::IsNearlyEqual( NextTime, DesiredTime ) )
+	{
+		OutBlend.PrevSampleIndex = SampleIndexes[ Pos + 1 ];
+		OutBlend.NextSampleIndex = SampleIndexes[ Pos + 1 ];
+		OutBlend.PrevWeight = 1.0f;
+		return true;
+	}
+
+	OutBlend.PrevSampleIndex = SampleIndexes[ Pos ];
+	OutBlend.NextSampleIndex = SampleIndexes[ Pos + 1 ];
+	OutBlend.PrevWeight = ( DesiredTime - PrevTime ) / ( NextTime - PrevTime );
+
+	return true;
+}
+
+bool UHoudiniPointCache::SearchSampleBlendForPointAtTime(int32 PointID, float desiredTime, FHoudiniPointSampleBlend& OutBlend) const
+{
+	float PrevTime = -FLT_MAX;
+	float NextTime = -FLT_MAX;
+
+	int32& PrevSampleIndex = OutBlend.PrevSampleIndex;
+	int32& NextSampleIndex = OutBlend.NextSampleIndex;
+	float& PrevWeight = OutBlend.PrevWeight;
+
 	// VA: Replace PointValueIndexes with TMAP for direct PointID lookups
 	// Get the sample indexes for this point
 	const TArray<int32>* SampleIndexes = nullptr;
@@ -1038,6 +1425,10 @@ UHoudiniPointCache::PostEditChangeProperty(FPropertyChangedEvent & PropertyChang
 		UseCustomCSVTitleRow = true;
 		UpdateFromFile( FileName );
 	}
+	else if ( PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED( UHoudiniPointCache, bStreamSamples ) )
+	{
+		UpdateStreamingFile();
+	}
 	
 }
 #endif
@@ -1218,7 +1609,22 @@ void UHoudiniPointCache::RequestPushToGPU()
 	DataToPass->NumPoints = GetNumberOfPoints();
 	DataToPass->MaxNumIndexesPerPoint = GetMaxNumberOfPointValueIndexes() + 1;
 
+	if (StreamingFile.IsValid())
+	{
+		// Only upload the first window of samples, UpdateStreamingWindow() moves it afterwards
+		FScopeLock Lock(&StreamingWindowLock);
+		StreamingWindowCapacity = StreamingFile->GetMaxNumSamplesInFrames(FMath::Max(StreamingWindowFrames, 2));
+		StreamingWindowFirstFrame = 0;
+
+		DataToPass->bStreamedFloatData = true;
+		DataToPass->SampleWindowStride = StreamingWindowCapacity;
+		ReadStreamingWindow(StreamingWindowFirstFrame, DataToPass->SampleWindowStart, DataToPass->FloatData);
+	}
+	else
 	{
+		DataToPass->SampleWindowStart = 0;
+		DataToPass->SampleWindowStride = GetNumberOfSamples();
+
 		uint32 NumElements = FloatSampleData.Num() ;
 		if (NumElements > 0)
 		{
@@ -1326,10 +1732,13 @@ void FHoudiniPointCacheResource::InitRHI()
 	{
 		int32 NumElements = CachedData->FloatData.Num();
 		FloatValuesGPUBuffer.Release();
+
+		// The sample window of streamed point caches is updated as time goes
+		const EBufferUsageFlags FloatBufferUsage = CachedData->bStreamedFloatData ? BUF_Dynamic : BUF_Static;
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
-		FloatValuesGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferFloat"), sizeof(float), NumElements, EPixelFormat::PF_R32_FLOAT, ERHIAccess::SRVCompute, BUF_Static);
+		FloatValuesGPUBuffer.Initialize(RHICmdList, TEXT("HoudiniGPUBufferFloat"), sizeof(float), NumElements, EPixelFormat::PF_R32_FLOAT, ERHIAccess::SRVCompute, FloatBufferUsage);
 #else
-		FloatValuesGPUBuffer.Initialize(TEXT("HoudiniGPUBufferFloat"), sizeof(float), NumElements, EPixelFormat::PF_R32_FLOAT, BUF_Static);
+		FloatValuesGPUBuffer.Initialize(TEXT("HoudiniGPUBufferFloat"), sizeof(float), NumElements, EPixelFormat::PF_R32_FLOAT, FloatBufferUsage);
 #endif
 
 		uint32 BufferSize = NumElements * sizeof(float);
@@ -1493,10 +1902,36 @@ void FHoudiniPointCacheResource::InitRHI()
 	NumAttributes = CachedData->NumAttributes;
 	NumPoints = CachedData->NumPoints;
 	MaxNumberOfIndexesPerPoint = CachedData->MaxNumIndexesPerPoint;
+	SampleWindowStart = CachedData->SampleWindowStart;
+	SampleWindowStride = CachedData->SampleWindowStride;
 
 	CachedData.Reset();
 }
 
+void FHoudiniPointCacheResource::UpdateSampleWindow(FRHICommandListImmediate& RHICmdList, int32 InSampleWindowStart, const TArray<float>& InFloatData)
+{
+	// The window's size never changes, only its content
+	const uint32 BufferSize = InFloatData.Num() * sizeof(float);
+	if (!FloatValuesGPUBuffer.Buffer.IsValid() || BufferSize == 0 || BufferSize != FloatValuesGPUBuffer.NumBytes)
+		return;
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	float* BufferData = static_cast<float*>(RHICmdList.LockBuffer(FloatValuesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#else
+	float* BufferData = static_cast<float*>(RHILockBuffer(FloatValuesGPUBuffer.Buffer, 0, BufferSize, EResourceLockMode::RLM_WriteOnly));
+#endif
+
+	FPlatformMemory::Memcpy(BufferData, InFloatData.GetData(), BufferSize);
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	RHICmdList.UnlockBuffer(FloatValuesGPUBuffer.Buffer);
+#else
+	RHIUnlockBuffer(FloatValuesGPUBuffer.Buffer);
+#endif
+
+	SampleWindowStart = InSampleWindowStart;
+}
+
 void FHoudiniPointCacheResource::ReleaseRHI()
 {
 	FloatValuesGPUBuffer.Release();
@@ -0,0 +1,228 @@
+/*
+* Copyright (c) <2018> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "HoudiniPointCacheBinaryFile.h"
+
+#include "HoudiniPointCache.h"
+
+#include "Algo/BinarySearch.h"
+#include "Async/MappedFileHandle.h"
+#include "CoreMinimal.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+// "HPCB"
+const uint32 FHoudiniPointCacheBinaryFile::FileMagic = 0x42435048;
+const uint32 FHoudiniPointCacheBinaryFile::FileVersion = 1;
+
+static const int64 HoudiniPointCacheBinaryAlignment = 16;
+
+static void PadArchiveToAlignment(FArchive& Ar)
+{
+	uint8 Zero = 0;
+	while (Ar.Tell() % HoudiniPointCacheBinaryAlignment != 0)
+		Ar.Serialize(&Zero, 1);
+}
+
+FHoudiniPointCacheBinaryFile::FHoudiniPointCacheBinaryFile()
+	: NumSamples(0)
+	, NumAttributes(0)
+	, FloatData(nullptr)
+{
+}
+
+FHoudiniPointCacheBinaryFile::~FHoudiniPointCacheBinaryFile()
+{
+	// The region must be unmapped before its file handle is closed
+	MappedRegion.Reset();
+	MappedFile.Reset();
+}
+
+bool FHoudiniPointCacheBinaryFile::Write(const FString& InFilePath, const TArray<float>& InFloatData, int32 InNumSamples, int32 InNumAttributes, int32 InTimeAttributeIndex)
+{
+	if (InNumSamples <= 0 || InNumAttributes <= 0 || InFloatData.Num() != InNumSamples * InNumAttributes)
+		return false;
+
+	// Split the samples in frames of identical time values
+	TArray<FFrame> NewFrames;
+	if (InTimeAttributeIndex >= 0 && InTimeAttributeIndex < InNumAttributes)
+	{
+		const float* TimeValues = InFloatData.GetData() + (int64)InTimeAttributeIndex * InNumSamples;
+		for (int32 SampleIndex = 0; SampleIndex < InNumSamples; SampleIndex++)
+		{
+			if (NewFrames.Num() == 0 || NewFrames.Last().Time != TimeValues[SampleIndex])
+				NewFrames.Add({ SampleIndex, 0, TimeValues[SampleIndex] });
+
+			NewFrames.Last().NumSamples++;
+		}
+	}
+	else
+	{
+		NewFrames.Add({ 0, InNumSamples, 0.0f });
+	}
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*InFilePath, FILEWRITE_EvenIfReadOnly));
+	if (!Writer)
+	{
+		UE_LOG(LogHoudiniNiagara, Error, TEXT("Could not create the point cache binary file %s"), *InFilePath);
+		return false;
+	}
+
+	FHeader Header;
+	FMemory::Memzero(Header);
+	Header.Magic = FileMagic;
+	Header.Version = FileVersion;
+	Header.NumSamples = InNumSamples;
+	Header.NumAttributes = InNumAttributes;
+	Header.NumFrames = NewFrames.Num();
+	Header.FramesOffset = Align((int64)sizeof(FHeader), HoudiniPointCacheBinaryAlignment);
+	Header.FloatDataOffset = Align(Header.FramesOffset + (int64)NewFrames.Num() * sizeof(FFrame), HoudiniPointCacheBinaryAlignment);
+
+	Writer->Serialize(&Header, sizeof(FHeader));
+	PadArchiveToAlignment(*Writer);
+	Writer->Serialize(NewFrames.GetData(), (int64)NewFrames.Num() * sizeof(FFrame));
+	PadArchiveToAlignment(*Writer);
+	Writer->Serialize(const_cast<float*>(InFloatData.GetData()), (int64)InFloatData.Num() * sizeof(float));
+
+	const bool bSuccess = !Writer->IsError() && Writer->Close();
+	if (!bSuccess)
+		UE_LOG(LogHoudiniNiagara, Error, TEXT("Failed to write the point cache binary file %s"), *InFilePath);
+
+	return bSuccess;
+}
+
+TUniquePtr<FHoudiniPointCacheBinaryFile> FHoudiniPointCacheBinaryFile::Open(const FString& InFilePath)
+{
+	// Read and validate the header and frame table
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*InFilePath));
+	if (!Reader)
+	{
+		UE_LOG(LogHoudiniNiagara, Warning, TEXT("Could not open the point cache binary file %s"), *InFilePath);
+		return nullptr;
+	}
+
+	const int64 FileSize = Reader->TotalSize();
+	FHeader Header;
+	if (FileSize < (int64)sizeof(FHeader))
+		return nullptr;
+
+	Reader->Serialize(&Header, sizeof(FHeader));
+
+	const int64 NumFloats = (int64)Header.NumSamples * Header.NumAttributes;
+	if (Header.Magic != FileMagic || Header.Version != FileVersion
+		|| Header.NumSamples <= 0 || Header.NumAttributes <= 0 || Header.NumFrames <= 0
+		|| Header.FramesOffset < (int64)sizeof(FHeader)
+		|| Header.FloatDataOffset % HoudiniPointCacheBinaryAlignment != 0
+		|| Header.FloatDataOffset < Header.FramesOffset + (int64)Header.NumFrames * sizeof(FFrame)
+		|| Header.FloatDataOffset + NumFloats * (int64)sizeof(float) > FileSize)
+	{
+		UE_LOG(LogHoudiniNiagara, Warning, TEXT("Invalid point cache binary file %s"), *InFilePath);
+		return nullptr;
+	}
+
+	TUniquePtr<FHoudiniPointCacheBinaryFile> File(new FHoudiniPointCacheBinaryFile());
+	File->NumSamples = Header.NumSamples;
+	File->NumAttributes = Header.NumAttributes;
+	File->Frames.SetNumUninitialized(Header.NumFrames);
+	Reader->Seek(Header.FramesOffset);
+	Reader->Serialize(File->Frames.GetData(), (int64)Header.NumFrames * sizeof(FFrame));
+
+	if (Reader->IsError())
+		return nullptr;
+
+	// Map the whole file, the float values are read in place
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+	FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*InFilePath);
+	if (MappedResult.HasValue())
+		File->MappedFile = MappedResult.StealValue();
+#else
+	File->MappedFile.Reset(PlatformFile.OpenMapped(*InFilePath));
+#endif
+
+	if (File->MappedFile)
+		File->MappedRegion.Reset(File->MappedFile->MapRegion(0, FileSize));
+
+	if (File->MappedRegion)
+	{
+		File->FloatData = reinterpret_cast<const float*>(File->MappedRegion->GetMappedPtr() + Header.FloatDataOffset);
+	}
+	else
+	{
+		// No file mapping on this platform, keep all the values in memory
+		UE_LOG(LogHoudiniNiagara, Warning, TEXT("Could not map the point cache binary file %s, its samples will be fully loaded in memory."), *InFilePath);
+		File->MappedFile.Reset();
+		File->FallbackFloatData.SetNumUninitialized(NumFloats);
+		Reader->Seek(Header.FloatDataOffset);
+		Reader->Serialize(File->FallbackFloatData.GetData(), NumFloats * sizeof(float));
+		if (Reader->IsError())
+			return nullptr;
+
+		File->FloatData = File->FallbackFloatData.GetData();
+	}
+
+	return File;
+}
+
+int32 FHoudiniPointCacheBinaryFile::GetFrameIndexAtTime(float Time) const
+{
+	// Frames are sorted by time
+	const int32 NextFrameIndex = Algo::UpperBoundBy(Frames, Time, &FFrame::Time);
+	return FMath::Max(NextFrameIndex - 1, 0);
+}
+
+int32 FHoudiniPointCacheBinaryFile::GetMaxNumSamplesInFrames(int32 NumFramesInWindow) const
+{
+	NumFramesInWindow = FMath::Clamp(NumFramesInWindow, 1, Frames.Num());
+
+	// Sliding sum over the frames' sample counts
+	int32 NumInWindow = 0;
+	int32 MaxNumInWindow = 0;
+	for (int32 FrameIndex = 0; FrameIndex < Frames.Num(); FrameIndex++)
+	{
+		NumInWindow += Frames[FrameIndex].NumSamples;
+		if (FrameIndex >= NumFramesInWindow)
+			NumInWindow -= Frames[FrameIndex - NumFramesInWindow].NumSamples;
+
+		MaxNumInWindow = FMath::Max(MaxNumInWindow, NumInWindow);
+	}
+
+	return MaxNumInWindow;
+}
+
+bool FHoudiniPointCacheBinaryFile::ReadSamples(int32 FirstSample, int32 NumSamplesToRead, int32 Stride, float* OutData) const
+{
+	if (!FloatData || !OutData || FirstSample < 0 || NumSamplesToRead < 0 || NumSamplesToRead > Stride || FirstSample + NumSamplesToRead > NumSamples)
+		return false;
+
+	for (int32 AttrIndex = 0; AttrIndex < NumAttributes; AttrIndex++)
+	{
+		FMemory::Memcpy(
+			OutData + (int64)AttrIndex * Stride,
+			FloatData + (int64)AttrIndex * NumSamples + FirstSample,
+			NumSamplesToRead * sizeof(float));
+	}
+
+	return true;
+}
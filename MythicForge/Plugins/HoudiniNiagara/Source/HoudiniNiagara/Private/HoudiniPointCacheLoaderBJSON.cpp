@@ -26,6 +26,8 @@
 #include "HoudiniPointCache.h"
 
 #include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "HAL/ThreadSafeBool.h"
 #include "Misc/CoreMiscDefines.h" 
 #include "Serialization/MemoryReader.h"
 #include "ShaderCompiler.h"
@@ -110,16 +112,6 @@ bool FHoudiniPointCacheLoaderBJSON::LoadToAsset(UHoudiniPointCache *InAsset)
     uint32 NumAttributesPerFileSample = Header.NumAttributeComponents;
     ParseAttributesAndInitAsset(InAsset, Header);
 
-    // Get Age attribute index, we'll use this to ensure we sort point spawn time correctly
-    int32 IDAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::POINTID);
-	int32 AgeAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::AGE);
-
-	// Due to the way that some of the DI functions work,
-	// we expect that the point IDs start at zero, and increment as the points are spawned
-	// Make sure this is the case by converting the point IDs as we read them
-	int32 NextPointID = 0;
-	TMap<int32, int32> HoudiniIDToNiagaraIDMap;
-
     // Expect cache_data key, object start, frames key
     if (!ReadNonContainerValue(ObjectKey, false, MarkerTypeString) || ObjectKey != TEXT("cache_data"))
         return false;
@@ -135,35 +127,49 @@ bool FHoudiniPointCacheLoaderBJSON::LoadToAsset(UHoudiniPointCache *InAsset)
     if (!ReadMarker(Marker) || Marker != MarkerArrayStart)
         return false;
 
-    uint32 NumFramesRead = 0;
-    uint32 FrameStartSampleIndex = 0;
-    TArray<TArray<float>> TempFrameData;
+    // The size, in bytes, of a sample in the file: its values and the array start/end markers
+    uint32 SampleSize = 2;
+    for (uint32 AttrIndex = 0; AttrIndex < NumAttributesPerFileSample; ++AttrIndex)
+    {
+        const uint32 ValueSize = GetMarkerTypeSize(Header.AttributeComponentDataTypes[AttrIndex], sizeof(float));
+        if (ValueSize == 0 || ValueSize > sizeof(double))
+        {
+            UE_LOG(LogHoudiniNiagara, Error, TEXT("Unknown marker type %c"), TCHAR(Header.AttributeComponentDataTypes[AttrIndex]));
+            return false;
+        }
+        SampleSize += ValueSize;
+    }
+
+    // First pass: only read the frame entries and record where each frame's samples are in the buffer.
+    // The samples all have the same size, so the frame data can be skipped over.
+    TArray<FHoudiniPointCacheJSONFrame> Frames;
+    TArray<int64> FrameDataOffsets;
+    Frames.Reserve(Header.NumFrames);
+    FrameDataOffsets.Reserve(Header.NumFrames);
     while (!Reader->AtEnd() && !IsNext(MarkerArrayEnd))
     {
         // Expect object start
         if (!ReadMarker(Marker) || Marker != MarkerObjectStart)
             return false;
 
-        float FrameNumber = 0.0f;
-        float Time = 0;
-        uint32 NumPointsInFrame = 0;
+        FHoudiniPointCacheJSONFrame& Frame = Frames.AddDefaulted_GetRef();
 
         // Read 'number' (frame number)
         if (!ReadNonContainerValue(ObjectKey, false, MarkerTypeString) || ObjectKey != TEXT("number"))
             return false;
-        if (!ReadNonContainerValue(FrameNumber, false, MarkerTypeUInt32))
+        if (!ReadNonContainerValue(Frame.FrameNumber, false, MarkerTypeUInt32))
             return false;
 
         // Read 'time'
         if (!ReadNonContainerValue(ObjectKey, false, MarkerTypeString) || ObjectKey != TEXT("time"))
             return false;
-        if (!ReadNonContainerValue(Time, false, MarkerTypeFloat32))
+        if (!ReadNonContainerValue(Frame.Time, false, MarkerTypeFloat32))
             return false;
 
         // Read 'num_points' (number of points in frame)
         if (!ReadNonContainerValue(ObjectKey, false, MarkerTypeString) || ObjectKey != TEXT("num_points"))
             return false;
-        if (!ReadNonContainerValue(NumPointsInFrame, false, MarkerTypeUInt32))
+        if (!ReadNonContainerValue(Frame.NumPoints, false, MarkerTypeUInt32))
             return false;
 
         // Expect 'frame_data' key
@@ -174,51 +180,16 @@ bool FHoudiniPointCacheLoaderBJSON::LoadToAsset(UHoudiniPointCache *InAsset)
         if (!ReadMarker(Marker) || Marker != MarkerArrayStart)
             return false;
 
-        // Ensure we have enough space in our FrameData array to read the samples for this frame
-        TempFrameData.SetNum(NumPointsInFrame);
-        float PreviousAge = 0.0f;
-        bool bNeedToSort = false;
-        for (uint32 SampleIndex = 0; SampleIndex < NumPointsInFrame; ++SampleIndex)
+        // Skip the samples
+        const int64 FrameDataOffset = Reader->Tell();
+        const int64 FrameDataSize = static_cast<int64>(Frame.NumPoints) * SampleSize;
+        if (FrameDataOffset + FrameDataSize > Reader->TotalSize())
         {
-            // Initialize attributes for this sample
-            TempFrameData[SampleIndex].Init(0, NumAttributesPerFileSample);
-
-            // Expect array start marker
-            if (!ReadMarker(Marker) || Marker != MarkerArrayStart)
-                return false;
-
-            for (uint32 AttrIndex = 0; AttrIndex < NumAttributesPerFileSample; ++AttrIndex)
-            {
-                float& Value = TempFrameData[SampleIndex][AttrIndex];
-                // Read a value
-                if (!ReadNonContainerValue(Value, false, Header.AttributeComponentDataTypes[AttrIndex]))
-                    return false;
-
-                if (AgeAttributeIndex != INDEX_NONE && AttrIndex == AgeAttributeIndex)
-                {
-                    if (SampleIndex == 0)
-                    {
-                        PreviousAge = Value;
-                    }
-                    else if (PreviousAge < Value)
-                    {
-                        bNeedToSort = true;
-                    }
-                }
-            }
-
-            // Expect array end marker
-            if (!ReadMarker(Marker) || Marker != MarkerArrayEnd)
-                return false;
-        }
-
-        // Sort this frame's data by age
-        if (bNeedToSort)
-        {
-            TempFrameData.Sort<FHoudiniPointCacheSortPredicate>(FHoudiniPointCacheSortPredicate(INDEX_NONE, AgeAttributeIndex, IDAttributeIndex));
+            UE_LOG(LogHoudiniNiagara, Error, TEXT("Binary JSON reader reach EOF early."));
+            return false;
         }
-
-        ProcessFrame(InAsset, FrameNumber, TempFrameData, Time, FrameStartSampleIndex, NumPointsInFrame, NumAttributesPerFileSample, Header, HoudiniIDToNiagaraIDMap, NextPointID);
+        FrameDataOffsets.Add(FrameDataOffset);
+        Reader->Seek(FrameDataOffset + FrameDataSize);
 
         // Expect array end marker
         if (!ReadMarker(Marker) || Marker != MarkerArrayEnd)
@@ -227,16 +198,53 @@ bool FHoudiniPointCacheLoaderBJSON::LoadToAsset(UHoudiniPointCache *InAsset)
         // Expect object end
         if (!ReadMarker(Marker) || Marker != MarkerObjectEnd)
             return false;
-
-        FrameStartSampleIndex += NumPointsInFrame;
-        NumFramesRead++;
     }
 
-    if (NumFramesRead != Header.NumFrames)
+    if (!ValidateFrames(InAsset, Frames, Header))
+        return false;
+
+    // Second pass: decode the frames, in parallel, each frame only writes to its own samples
+    const TArray<uint8>& RawData = InAsset->RawDataCompressed;
+    FThreadSafeBool bDecodeFailed = false;
+    ParallelFor(Frames.Num(), [&](int32 FrameIndex)
     {
-        UE_LOG(LogHoudiniNiagara, Error, TEXT("Inconsistent num_frames in header vs body: %d vs %d"), Header.NumFrames, NumFramesRead);
+        const FHoudiniPointCacheJSONFrame& Frame = Frames[FrameIndex];
+        const uint8* Data = RawData.GetData() + FrameDataOffsets[FrameIndex];
+
+        TArray<TArray<float>> FrameData;
+        FrameData.SetNum(Frame.NumPoints);
+        for (uint32 SampleIndex = 0; SampleIndex < Frame.NumPoints; ++SampleIndex)
+        {
+            // Expect array start and end markers around the sample
+            if (Data[0] != MarkerArrayStart || Data[SampleSize - 1] != MarkerArrayEnd)
+            {
+                UE_LOG(LogHoudiniNiagara, Error, TEXT("Invalid sample %d in frame %d."), SampleIndex, (int32)Frame.FrameNumber);
+                bDecodeFailed = true;
+                return;
+            }
+            Data++;
+
+            TArray<float>& Sample = FrameData[SampleIndex];
+            Sample.SetNumUninitialized(NumAttributesPerFileSample);
+            for (uint32 AttrIndex = 0; AttrIndex < NumAttributesPerFileSample; ++AttrIndex)
+            {
+                const unsigned char MarkerType = Header.AttributeComponentDataTypes[AttrIndex];
+                Sample[AttrIndex] = DecodeFloatValue(Data, MarkerType);
+                Data += GetMarkerTypeSize(MarkerType, sizeof(float));
+            }
+            Data++;
+        }
+
+        if (!DecodeFrame(InAsset, FrameData, Frame, NumAttributesPerFileSample))
+            bDecodeFailed = true;
+    });
+
+    if (bDecodeFailed)
+        return false;
+
+    // Last pass: remap the point IDs in order and build the per point data
+    if (!FinalizeFrames(InAsset, Frames))
         return false;
-    }
 
     // Expect array end - frames
     if (!ReadMarker(Marker) || Marker != MarkerArrayEnd)
@@ -258,6 +266,66 @@ bool FHoudiniPointCacheLoaderBJSON::LoadToAsset(UHoudiniPointCache *InAsset)
 }
 #endif
 
+uint32 FHoudiniPointCacheLoaderBJSON::GetMarkerTypeSize(unsigned char InMarkerType, uint32 InDefaultSize)
+{
+    switch (InMarkerType)
+    {
+        case '\0':
+            return InDefaultSize;
+        case MarkerTypeChar:
+        case MarkerTypeInt8:
+        case MarkerTypeUInt8:
+        case MarkerTypeBool:
+            return 1;
+        case MarkerTypeInt16:
+        case MarkerTypeUInt16:
+            return 2;
+        case MarkerTypeInt32:
+        case MarkerTypeUInt32:
+        case MarkerTypeFloat32:
+            return 4;
+        case MarkerTypeInt64:
+        case MarkerTypeUInt64:
+        case MarkerTypeFloat64:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+float FHoudiniPointCacheLoaderBJSON::DecodeFloatValue(const uint8* InData, unsigned char InMarkerType)
+{
+    // Interpret data in the type associated with the marker and then cast to float
+    switch (InMarkerType)
+    {
+        case MarkerTypeChar:
+        case MarkerTypeUInt8:
+            return static_cast<float>(*InData);
+        case MarkerTypeInt8:
+            return static_cast<float>(*reinterpret_cast<const int8*>(InData));
+        case MarkerTypeBool:
+            return *InData != 0 ? 1.0f : 0.0f;
+        case MarkerTypeInt16:
+            { int16 Value; FMemory::Memcpy(&Value, InData, sizeof(Value)); return static_cast<float>(Value); }
+        case MarkerTypeUInt16:
+            { uint16 Value; FMemory::Memcpy(&Value, InData, sizeof(Value)); return static_cast<float>(Value); }
+        case MarkerTypeInt32:
+            { int32 Value; FMemory::Memcpy(&Value, InData, sizeof(Value)); return static_cast<float>(Value); }
+        case MarkerTypeUInt32:
+            { uint32 Value; FMemory::Memcpy(&Value, InData, sizeof(Value)); return static_cast<float>(Value); }
+        case MarkerTypeInt64:
+            { int64 Value; FMemory::Memcpy(&Value, InData, sizeof(Value)); return static_cast<float>(Value); }
+        case MarkerTypeUInt64:
+            { uint64 Value; FMemory::Memcpy(&Value, InData, sizeof(Value)); return static_cast<float>(Value); }
+        case MarkerTypeFloat64:
+            { double Value; FMemory::Memcpy(&Value, InData, sizeof(Value)); return static_cast<float>(Value); }
+        case '\0':
+        case MarkerTypeFloat32:
+        default:
+            { float Value; FMemory::Memcpy(&Value, InData, sizeof(Value)); return Value; }
+    }
+}
+
 bool FHoudiniPointCacheLoaderBJSON::ReadMarker(unsigned char &OutMarker)
 {
     if (!CheckReader())
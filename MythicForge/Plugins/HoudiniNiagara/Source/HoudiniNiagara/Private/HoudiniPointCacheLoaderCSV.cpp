@@ -26,11 +26,17 @@
 #include "HoudiniPointCache.h"
 
 #include "CoreMinimal.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
 #include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/CoreMiscDefines.h" 
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Runtime/Launch/Resources/Version.h"
 #include "ShaderCompiler.h"
+#include "UObject/Package.h"
 
 
 FHoudiniPointCacheLoaderCSV::FHoudiniPointCacheLoaderCSV(const FString& InFilePath)
@@ -40,17 +46,152 @@ FHoudiniPointCacheLoaderCSV::FHoudiniPointCacheLoaderCSV(const FString& InFilePa
 }
 
 #if WITH_EDITOR
-bool FHoudiniPointCacheLoaderCSV::LoadToAsset(UHoudiniPointCache *InAsset)
+// Read only view of a CSV file's content, memory-mapped when the platform allows it.
+// The content is converted to UTF-8 for UTF-16 files.
+struct FHoudiniCSVFileView
+{
+	~FHoudiniCSVFileView()
+	{
+		// The region must be unmapped before its file handle is closed
+		MappedRegion.Reset();
+		MappedFile.Reset();
+	}
+
+	bool Open(const FString& InFilePath)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+		FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*InFilePath);
+		if (MappedResult.HasValue())
+			MappedFile = MappedResult.StealValue();
+#else
+		MappedFile.Reset(PlatformFile.OpenMapped(*InFilePath));
+#endif
+		if (MappedFile && MappedFile->GetFileSize() > 0)
+			MappedRegion.Reset(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+
+		if (MappedRegion)
+		{
+			Begin = reinterpret_cast<const ANSICHAR*>(MappedRegion->GetMappedPtr());
+			End = Begin + MappedRegion->GetMappedSize();
+		}
+		else
+		{
+			if (!FFileHelper::LoadFileToArray(Buffer, *InFilePath))
+				return false;
+
+			Begin = reinterpret_cast<const ANSICHAR*>(Buffer.GetData());
+			End = Begin + Buffer.Num();
+		}
+
+		const int64 Size = End - Begin;
+		const uint8* Bytes = reinterpret_cast<const uint8*>(Begin);
+		if (Size >= 2 && ((Bytes[0] == 0xFF && Bytes[1] == 0xFE) || (Bytes[0] == 0xFE && Bytes[1] == 0xFF)))
+		{
+			// UTF-16 files are rare, convert them rather than parsing two encodings
+			FString FileString;
+			if (!FFileHelper::LoadFileToString(FileString, *InFilePath))
+				return false;
+
+			MappedRegion.Reset();
+			MappedFile.Reset();
+
+			FTCHARToUTF8 Converted(*FileString, FileString.Len());
+			Buffer.SetNumUninitialized(Converted.Length());
+			FMemory::Memcpy(Buffer.GetData(), Converted.Get(), Converted.Length());
+			Begin = reinterpret_cast<const ANSICHAR*>(Buffer.GetData());
+			End = Begin + Buffer.Num();
+		}
+		else if (Size >= 3 && Bytes[0] == 0xEF && Bytes[1] == 0xBB && Bytes[2] == 0xBF)
+		{
+			// Skip the UTF-8 BOM
+			Begin += 3;
+		}
+
+		return true;
+	}
+
+	const ANSICHAR* Begin = nullptr;
+	const ANSICHAR* End = nullptr;
+
+private:
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TArray<uint8> Buffer;
+};
+
+// Finds the next non empty row starting at InOutRowBegin, returns false if there are no rows left.
+// Like ParseIntoArrayLines, \r, \n and \r\n are all considered as line breaks.
+static bool FindNextCSVRow(const ANSICHAR*& InOutRowBegin, const ANSICHAR*& OutRowEnd, const ANSICHAR* InEnd)
 {
-    // Parse the file to a string array
-    TArray<FString> StringArray;
-    if (!FFileHelper::LoadFileToStringArray(StringArray, *GetFilePath()))
+	while (InOutRowBegin < InEnd && (*InOutRowBegin == '\n' || *InOutRowBegin == '\r'))
+		InOutRowBegin++;
+
+	if (InOutRowBegin >= InEnd)
 		return false;
-	
-    if (!UpdateFromStringArray(InAsset, StringArray))
-    {
-	    return false;
-    }
+
+	OutRowEnd = InOutRowBegin;
+	while (OutRowEnd < InEnd && *OutRowEnd != '\n' && *OutRowEnd != '\r')
+		OutRowEnd++;
+
+	return true;
+}
+
+static FString CSVRowToString(const ANSICHAR* InRowBegin, const ANSICHAR* InRowEnd)
+{
+	FUTF8ToTCHAR Converted(InRowBegin, (int32)(InRowEnd - InRowBegin));
+	return FString(Converted.Length(), Converted.Get());
+}
+
+// Parses the comma separated values of a row into OutValues, each value being Stride floats after the previous one.
+// Like ParseIntoArray, empty values are skipped. When bIgnorePackingChars is true, the packing characters
+// of packed vectors: ()" are ignored. Only the first MaxValues values are stored.
+// Returns the number of values found in the row.
+static int32 ParseCSVRowValues(const ANSICHAR* InRowBegin, const ANSICHAR* InRowEnd, bool bIgnorePackingChars, float* OutValues, int32 Stride, int32 MaxValues)
+{
+	ANSICHAR ValueString[64];
+	int32 NumValues = 0;
+	const ANSICHAR* Cursor = InRowBegin;
+	while (Cursor < InRowEnd)
+	{
+		int32 Length = 0;
+		for (; Cursor < InRowEnd && *Cursor != ','; Cursor++)
+		{
+			if (bIgnorePackingChars && (*Cursor == '(' || *Cursor == ')' || *Cursor == '"'))
+				continue;
+
+			if (Length < UE_ARRAY_COUNT(ValueString) - 1)
+				ValueString[Length++] = *Cursor;
+		}
+
+		// Skip the comma
+		if (Cursor < InRowEnd)
+			Cursor++;
+
+		if (Length == 0)
+			continue;
+
+		ValueString[Length] = 0;
+		if (NumValues < MaxValues)
+			OutValues[(int64)NumValues * Stride] = FCStringAnsi::Atof(ValueString);
+
+		NumValues++;
+	}
+
+	return NumValues;
+}
+
+bool FHoudiniPointCacheLoaderCSV::LoadToAsset(UHoudiniPointCache *InAsset)
+{
+	// Parse the file in place
+	{
+		FHoudiniCSVFileView FileView;
+		if (!FileView.Open(GetFilePath()))
+			return false;
+
+		if (!UpdateFromBuffer(InAsset, FileView.Begin, FileView.End))
+			return false;
+	}
 
     // Load uncompressed raw data into asset.
 	if (!LoadRawPointCacheData(InAsset, *GetFilePath()))
@@ -62,10 +203,56 @@ bool FHoudiniPointCacheLoaderCSV::LoadToAsset(UHoudiniPointCache *InAsset)
 
 	return true;
 }
+
+void FHoudiniPointCacheLoaderCSV::BenchmarkImport(const FString& InFilePath, int32 InNumIterations)
+{
+	FHoudiniPointCacheLoaderCSV Loader(InFilePath);
+	UHoudiniPointCache* Asset = NewObject<UHoudiniPointCache>(GetTransientPackage());
+
+	int64 FileSize = 0;
+	double TotalSeconds = 0.0;
+	InNumIterations = FMath::Max(InNumIterations, 1);
+	for (int32 Iteration = 0; Iteration < InNumIterations; Iteration++)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		FHoudiniCSVFileView FileView;
+		if (!FileView.Open(InFilePath) || !Loader.UpdateFromBuffer(Asset, FileView.Begin, FileView.End))
+		{
+			UE_LOG(LogHoudiniNiagara, Error, TEXT("CSV import benchmark: could not import %s."), *InFilePath);
+			return;
+		}
+
+		TotalSeconds += FPlatformTime::Seconds() - StartTime;
+		FileSize = FileView.End - FileView.Begin;
+	}
+
+	const double SecondsPerImport = TotalSeconds / InNumIterations;
+	UE_LOG(LogHoudiniNiagara, Display,
+		TEXT("CSV import benchmark: %s, %d samples x %d attributes, %.2f ms per import (%.1f MB/s) over %d iterations."),
+		*InFilePath, Asset->NumberOfSamples, Asset->NumberOfAttributes, SecondsPerImport * 1000.0,
+		SecondsPerImport > 0.0 ? (FileSize / (1024.0 * 1024.0)) / SecondsPerImport : 0.0, InNumIterations);
+}
+
+static FAutoConsoleCommand HoudiniNiagaraBenchmarkCSVImportCommand(
+	TEXT("HoudiniNiagara.BenchmarkCSVImport"),
+	TEXT("Parses a CSV point cache file to a transient asset and logs the average import time.\n")
+	TEXT("Usage: HoudiniNiagara.BenchmarkCSVImport <FilePath> [NumIterations]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogHoudiniNiagara, Warning, TEXT("Usage: HoudiniNiagara.BenchmarkCSVImport <FilePath> [NumIterations]"));
+			return;
+		}
+
+		const int32 NumIterations = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 5;
+		FHoudiniPointCacheLoaderCSV::BenchmarkImport(Args[0], NumIterations);
+	}));
 #endif
 
 #if WITH_EDITOR
-bool FHoudiniPointCacheLoaderCSV::UpdateFromStringArray(UHoudiniPointCache *InAsset, TArray<FString>& InStringArray)
+bool FHoudiniPointCacheLoaderCSV::UpdateFromBuffer(UHoudiniPointCache *InAsset, const ANSICHAR* InBegin, const ANSICHAR* InEnd)
 {
     if (!InAsset)
     {
@@ -89,23 +276,31 @@ bool FHoudiniPointCacheLoaderCSV::UpdateFromStringArray(UHoudiniPointCache *InAs
 	// Reset the column indexes of the special attributes
 	SpecialAttributeIndexes.Init( INDEX_NONE, EHoudiniAttributes::HOUDINI_ATTR_SIZE );
 
-    if ( InStringArray.Num() <= 0 )
-    {
-		UE_LOG( LogHoudiniNiagara, Error, TEXT( "Could not load the CSV file, error: not enough rows in the file." ) );
-		return false;
-    }
-
-    // Remove empty rows from the CSV
-    InStringArray.RemoveAll( [&]( const FString& InString ) { return InString.IsEmpty(); } );
+	// Count the (non empty) rows so that the values can be parsed directly to their columns
+	int32 NumRows = 0;
+	const ANSICHAR* RowBegin = InBegin;
+	const ANSICHAR* RowEnd = InBegin;
+	for ( ; FindNextCSVRow( RowBegin, RowEnd, InEnd ); RowBegin = RowEnd )
+		NumRows++;
 
     // Number of rows in the CSV (ignoring the title row)
-    InAsset->NumberOfSamples = InStringArray.Num() - 1;
+    InAsset->NumberOfSamples = NumRows - 1;
     if ( InAsset->NumberOfSamples < 1 )
     {
 		UE_LOG( LogHoudiniNiagara, Error, TEXT( "Could not load the CSV file, error: not enough rows in the file." ) );
 		return false;
     }
 
+	// The title row and the first value row are needed as strings
+	RowBegin = InBegin;
+	FindNextCSVRow( RowBegin, RowEnd, InEnd );
+	const FString FileTitleRow = CSVRowToString( RowBegin, RowEnd );
+
+	RowBegin = RowEnd;
+	FindNextCSVRow( RowBegin, RowEnd, InEnd );
+	const ANSICHAR* FirstValueRowBegin = RowBegin;
+	const FString FirstValueRow = CSVRowToString( RowBegin, RowEnd );
+
 	// See if we need to use a custom title row
 	// The custom title row will be ignored if it is empty or only composed of spaces
 	FString TitleRow = InAsset->SourceCSVTitleRow;
@@ -114,184 +309,147 @@ bool FHoudiniPointCacheLoaderCSV::UpdateFromStringArray(UHoudiniPointCache *InAs
 		InAsset->SetUseCustomCSVTitleRow(false);
 
 	if ( !InAsset->GetUseCustomCSVTitleRow() )
-		InAsset->SourceCSVTitleRow = InStringArray[0];
+		InAsset->SourceCSVTitleRow = FileTitleRow;
 
 	// Parses the CSV file's title row to update the column indexes of special values we're interested in
 	// Also look for packed vectors in the first row and update the indexes accordingly
 	bool HasPackedVectors = false;
-	if ( !ParseCSVTitleRow( InAsset, InAsset->SourceCSVTitleRow, InStringArray[1], HasPackedVectors ) )
+	if ( !ParseCSVTitleRow( InAsset, InAsset->SourceCSVTitleRow, FirstValueRow, HasPackedVectors ) )
 		return false;
-    
-    // Remove the title row now that it's been processed
-    InStringArray.RemoveAt( 0 );
 
-	// Parses each string of the csv file to a string array
-	TArray< TArray< FString > > ParsedStringArrays;
-	ParsedStringArrays.SetNum( InAsset->NumberOfSamples );
-	for ( int32 rowIdx = 0; rowIdx < InAsset->NumberOfSamples; rowIdx++ )
-	{
-		// Get the current row
-		FString CurrentRow = InStringArray[ rowIdx ];
-		if ( HasPackedVectors )
-		{
-			// Clean up the packing characters: ()" from the row so it can be parsed properly
-			CurrentRow.ReplaceInline( TEXT("("), TEXT("") );
-			CurrentRow.ReplaceInline( TEXT(")"), TEXT("") );
-			CurrentRow.ReplaceInline( TEXT("\""), TEXT("") );
-		}
+	const int32 NumSamples = InAsset->NumberOfSamples;
+	const int32 NumAttributes = InAsset->NumberOfAttributes;
 
-		// Parse the current row to an array
-		TArray<FString> CurrentParsedRow;
-		CurrentRow.ParseIntoArray( CurrentParsedRow, TEXT(",") );
+    // Parse the values straight to our buffer
+	// The data is stored transposed in the buffer, missing values are left to 0
+    FloatSampleData.Empty();
+    FloatSampleData.SetNumZeroed( NumSamples * NumAttributes );
+
+	RowBegin = FirstValueRowBegin;
+	for ( int32 rowIdx = 0; rowIdx < NumSamples && FindNextCSVRow( RowBegin, RowEnd, InEnd ); rowIdx++, RowBegin = RowEnd )
+	{
+		const int32 NumRowValues = ParseCSVRowValues( RowBegin, RowEnd, HasPackedVectors, FloatSampleData.GetData() + rowIdx, NumSamples, NumAttributes );
 
 		// Check that the parsed row and number of columns match
-		if ( InAsset->NumberOfAttributes != CurrentParsedRow.Num() )
+		if ( NumRowValues != NumAttributes )
 			UE_LOG( LogHoudiniNiagara, Warning,
 			TEXT("Error while parsing the CSV File. Row %d has %d values instead of the expected %d!"),
-			rowIdx + 1, CurrentParsedRow.Num(), InAsset->NumberOfAttributes );
-
-		// Store the parsed row
-		ParsedStringArrays[ rowIdx ] = CurrentParsedRow;
+			rowIdx + 1, NumRowValues, NumAttributes );
 	}
 
-	// If we have time and/or age values, we have to make sure the csv rows are sorted by time and/or age
+	// If we have time and/or age values, we have to make sure the samples are sorted by time and/or age
 	int32 TimeAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::TIME);
 	int32 AgeAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::AGE);
 	int32 IDAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::POINTID);
 	if ( TimeAttributeIndex != INDEX_NONE )
 	{
-		// First check if we need to sort the array
+		const float* TimeValues = FloatSampleData.GetData() + TimeAttributeIndex * NumSamples;
+		const float* AgeValues = AgeAttributeIndex != INDEX_NONE ? FloatSampleData.GetData() + AgeAttributeIndex * NumSamples : nullptr;
+		const float* IDValues = IDAttributeIndex != INDEX_NONE ? FloatSampleData.GetData() + IDAttributeIndex * NumSamples : nullptr;
+
+		// First check if we need to sort the samples
 		bool NeedToSort = false;
-		float PreviousTimeValue = 0.0f;
-		float PreviousAgeValue = 0.0f;
-		for ( int32 rowIdx = 0; rowIdx < ParsedStringArrays.Num(); rowIdx++ )
+		for ( int32 rowIdx = 1; rowIdx < NumSamples && !NeedToSort; rowIdx++ )
 		{
-			if ( !ParsedStringArrays[ rowIdx ].IsValidIndex( TimeAttributeIndex ) && 
-				 !ParsedStringArrays[ rowIdx ].IsValidIndex( AgeAttributeIndex ) )
-				continue;
+			const float PreviousAgeValue = AgeValues ? AgeValues[ rowIdx - 1 ] : 0.0f;
+			const float CurrentAgeValue = AgeValues ? AgeValues[ rowIdx ] : 0.0f;
 
-			// Get the current time value
-			float CurrentTimeValue = PreviousTimeValue;
-			if (ParsedStringArrays[rowIdx].IsValidIndex(TimeAttributeIndex))
-			{
-				CurrentTimeValue = FCString::Atof(*(ParsedStringArrays[rowIdx][TimeAttributeIndex]));
-			}
+			// Time values arent sorted properly
+			NeedToSort = TimeValues[ rowIdx - 1 ] > TimeValues[ rowIdx ]
+				|| ( TimeValues[ rowIdx - 1 ] == TimeValues[ rowIdx ] && PreviousAgeValue < CurrentAgeValue );
+		}
 
-			// Get the current age value
-			float CurrentAgeValue = PreviousAgeValue;
-			if (ParsedStringArrays[rowIdx].IsValidIndex(AgeAttributeIndex))
+		if ( NeedToSort )
+		{
+			// Sort keys of (time, age, id) instead of whole rows: by increasing time, decreasing age and increasing id.
+			// The row index breaks the remaining ties, so that the sort is stable.
+			struct FSampleSortKey
 			{
-				CurrentAgeValue = FCString::Atof(*(ParsedStringArrays[rowIdx][AgeAttributeIndex]));
-			}
-
-			if ( rowIdx == 0 )
+				float Time;
+				float Age;
+				float ID;
+				int32 Row;
+			};
+
+			TArray<FSampleSortKey> SortKeys;
+			SortKeys.SetNumUninitialized( NumSamples );
+			for ( int32 rowIdx = 0; rowIdx < NumSamples; rowIdx++ )
 			{
-				PreviousTimeValue = CurrentTimeValue;
-				PreviousAgeValue = CurrentAgeValue;
-				continue;
+				SortKeys[ rowIdx ].Time = TimeValues[ rowIdx ];
+				SortKeys[ rowIdx ].Age = AgeValues ? AgeValues[ rowIdx ] : 0.0f;
+				SortKeys[ rowIdx ].ID = IDValues ? IDValues[ rowIdx ] : 0.0f;
+				SortKeys[ rowIdx ].Row = rowIdx;
 			}
 
-			// Time values arent sorted properly
-			if ( PreviousTimeValue > CurrentTimeValue || (PreviousTimeValue == CurrentTimeValue && PreviousAgeValue < CurrentAgeValue ) )
+			SortKeys.Sort( []( const FSampleSortKey& A, const FSampleSortKey& B )
 			{
-				NeedToSort = true;
-				break;
-			}
-		}
+				if ( A.Time != B.Time )
+					return A.Time < B.Time;
+				if ( A.Age != B.Age )
+					return B.Age < A.Age;
+				if ( A.ID != B.ID )
+					return A.ID < B.ID;
+				return A.Row < B.Row;
+			});
+
+			// Apply the permutation to each column
+			TArray<float> SortedColumn;
+			SortedColumn.SetNumUninitialized( NumSamples );
+			for ( int32 colIdx = 0; colIdx < NumAttributes; colIdx++ )
+			{
+				float* Column = FloatSampleData.GetData() + colIdx * NumSamples;
+				for ( int32 rowIdx = 0; rowIdx < NumSamples; rowIdx++ )
+					SortedColumn[ rowIdx ] = Column[ SortKeys[ rowIdx ].Row ];
 
-		if ( NeedToSort )
-		{
-			// We need to sort the CSV rows by their time values
-			ParsedStringArrays.Sort<FHoudiniPointCacheSortPredicate>( FHoudiniPointCacheSortPredicate( TimeAttributeIndex, AgeAttributeIndex, IDAttributeIndex ) );
+				FMemory::Memcpy( Column, SortedColumn.GetData(), NumSamples * sizeof( float ) );
+			}
 		}
 	}
 
-    // Initialize our different buffers
-    FloatSampleData.Empty();
-    FloatSampleData.SetNumZeroed( InAsset->NumberOfSamples * InAsset->NumberOfAttributes );
-
-	/*
-    StringCSVData.Empty();
-    StringCSVData.SetNumZeroed( NumberOfSamples * NumberOfAttributes );
-	*/
 	// Due to the way that some of the DI functions work,
 	// we expect that the point IDs start at zero, and increment as the points are spawned
-	// Make sure this is the case by converting the point IDs as we read them
+	// Make sure this is the case by converting the point IDs now that the samples are sorted
 	int32 NextPointID = 0;
 	TMap<int32, int32> HoudiniIDToNiagaraIDMap;
-	
-
-	// We also keep track of the row indexes for each time values
-	//float lastTimeValue = 0.0;
-	//TimeValuesIndexes.Empty();
 
 	// And the row indexes for each point
 	PointValueIndexes.Empty();
 
-    // Extract all the values from the table to the float & string buffers
-    TArray<FString> CurrentParsedRow;
-    for ( int rowIdx = 0; rowIdx < ParsedStringArrays.Num(); rowIdx++ )
-    {
-		CurrentParsedRow = ParsedStringArrays[ rowIdx ];
-
-		// Store the CSV Data in the buffers
-		// The data is stored transposed in those buffers
-		int32 CurrentID = -1;
-		for ( int colIdx = 0; colIdx < InAsset->NumberOfAttributes; colIdx++ )
+	if ( IDAttributeIndex != INDEX_NONE )
+	{
+		float* IDValues = FloatSampleData.GetData() + IDAttributeIndex * NumSamples;
+		for ( int32 rowIdx = 0; rowIdx < NumSamples; rowIdx++ )
 		{
-			// Get the string value for the current column
-			FString CurrentVal = TEXT("0");
-			if ( CurrentParsedRow.IsValidIndex( colIdx ) )
-			{
-				CurrentVal = CurrentParsedRow[ colIdx ];
-			}
-			else
+			// If the point ID doesn't exist in the Houdini/Niagara mapping, create a new a entry.
+			// Otherwise, replace the point ID with the Niagara ID.
+			int32 PointID = FMath::FloorToInt( IDValues[ rowIdx ] );
+			int32* FoundID = HoudiniIDToNiagaraIDMap.Find( PointID );
+			if ( !FoundID )
 			{
-				UE_LOG( LogHoudiniNiagara, Warning,
-				TEXT("Error while parsing the CSV File. Row %d has an invalid value for column %d!"),
-				rowIdx + 1, colIdx + 1 );
-			}
+				// We found a new point, so we add it to the ID map
+				FoundID = &HoudiniIDToNiagaraIDMap.Add( PointID, NextPointID++ );
 
-			// Convert the string value to a float
-			float FloatValue = FCString::Atof( *CurrentVal );
-
-			// Handle point IDs here
-			if ( colIdx == IDAttributeIndex )
-			{
-				// If the point ID doesn't exist in the Houdini/Niagara mapping, create a new a entry.
-				// Otherwise, replace the point ID with the Niagara ID.
-
-				int32 PointID = FMath::FloorToInt(FloatValue);
-				// The point ID may need to be replaced
-				if ( !HoudiniIDToNiagaraIDMap.Contains( PointID ) )
-				{
-					// We found a new point, so we add it to the ID map
-					HoudiniIDToNiagaraIDMap.Add( PointID, NextPointID++ );
-
-					// Add a new array for that point's indexes
-					PointValueIndexes.Add( FPointIndexes() );
-				}
-
-				// Get the Niagara ID from the Houdini ID
-				CurrentID = HoudiniIDToNiagaraIDMap[ PointID ];
-				FloatValue = (float)CurrentID;
-
-				// Add the current row to this point's row index list
-				PointValueIndexes[ CurrentID ].SampleIndexes.Add( rowIdx );
+				// Add a new array for that point's indexes
+				PointValueIndexes.Add( FPointIndexes() );
 			}
 
-			// Store the Value in the buffer
-			FloatSampleData[ rowIdx + ( colIdx * InAsset->NumberOfSamples ) ] = FloatValue;
+			// Get the Niagara ID from the Houdini ID
+			const int32 CurrentID = *FoundID;
+			IDValues[ rowIdx ] = (float)CurrentID;
+
+			// Add the current row to this point's row index list
+			PointValueIndexes[ CurrentID ].SampleIndexes.Add( rowIdx );
 		}
+	}
 
-		// If we dont have Point ID informations, we still want to fill the PointValueIndexes array
-		if ( !InAsset->IsValidAttributeAttributeIndex( EHoudiniAttributes::POINTID ) )
-		{
-			// Each row is considered its own point
-			PointValueIndexes.Add(FPointIndexes());
+	// If we dont have Point ID informations, we still want to fill the PointValueIndexes array
+	if ( !InAsset->IsValidAttributeAttributeIndex( EHoudiniAttributes::POINTID ) )
+	{
+		// Each row is considered its own point
+		PointValueIndexes.SetNum( NumSamples );
+		for ( int32 rowIdx = 0; rowIdx < NumSamples; rowIdx++ )
 			PointValueIndexes[ rowIdx ].SampleIndexes.Add( rowIdx );
-		}
-    }
+	}
 	
 	InAsset->NumberOfPoints = HoudiniIDToNiagaraIDMap.Num();
 	if ( InAsset->NumberOfPoints <= 0 )
@@ -26,7 +26,9 @@
 #include "HoudiniPointCache.h"
 
 #include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
 #include "HAL/PlatformProcess.h"
+#include "HAL/ThreadSafeBool.h"
 #include "Misc/CoreMiscDefines.h" 
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
@@ -80,97 +82,82 @@ bool FHoudiniPointCacheLoaderJSON::LoadToAsset(UHoudiniPointCache *InAsset)
     uint32 NumAttributesPerFileSample = Header.NumAttributeComponents;
     ParseAttributesAndInitAsset(InAsset, Header);
 
-    // Get Age attribute index, we'll use this to ensure we sort point spawn time correctly
-    int32 IDAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::POINTID);
-	int32 AgeAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::AGE);
-
-	// Due to the way that some of the DI functions work,
-	// we expect that the point IDs start at zero, and increment as the points are spawned
-	// Make sure this is the case by converting the point IDs as we read them
-	int32 NextPointID = 0;
-	TMap<int32, int32> HoudiniIDToNiagaraIDMap;
-
     // Expect cache_data key, object start, frames key
     const TSharedPtr<FJsonObject> &CacheDataObject = PointCacheObject->GetObjectField(TEXT("cache_data"));
     if (!CacheDataObject.IsValid())
         return false;
 
-    const TArray<TSharedPtr<FJsonValue>> &Frames = CacheDataObject->GetArrayField(TEXT("frames"));
+    const TArray<TSharedPtr<FJsonValue>> &FrameEntries = CacheDataObject->GetArrayField(TEXT("frames"));
 
-    if (Frames.Num() != Header.NumFrames)
-    {
-        UE_LOG(LogHoudiniNiagara, Error, TEXT("Inconsistent num_frames in header vs body: %d vs %d"), Header.NumFrames, Frames.Num());
-        return false;
-    }
-    
-    uint32 FrameStartSampleIndex = 0;
-    TArray<TArray<float>> TempFrameData;
-    for (const TSharedPtr<FJsonValue> &FrameEntryAsValue : Frames)
+    // First pass: read the frame entries and keep a reference to each frame's samples
+    TArray<FHoudiniPointCacheJSONFrame> Frames;
+    TArray<const TArray<TSharedPtr<FJsonValue>>*> FrameSamples;
+    Frames.Reserve(FrameEntries.Num());
+    FrameSamples.Reserve(FrameEntries.Num());
+    for (const TSharedPtr<FJsonValue> &FrameEntryAsValue : FrameEntries)
     {
         const TSharedPtr<FJsonObject> &FrameEntryObject = FrameEntryAsValue->AsObject();
         if (!FrameEntryObject.IsValid())
             return false;
 
-        float FrameNumber = FrameEntryObject->GetNumberField(TEXT("number"));
-        float Time = FrameEntryObject->GetNumberField(TEXT("time"));
-        uint32 NumPointsInFrame = FrameEntryObject->GetNumberField(TEXT("num_points"));
+        FHoudiniPointCacheJSONFrame& Frame = Frames.AddDefaulted_GetRef();
+        Frame.FrameNumber = FrameEntryObject->GetNumberField(TEXT("number"));
+        Frame.Time = FrameEntryObject->GetNumberField(TEXT("time"));
+        Frame.NumPoints = FrameEntryObject->GetNumberField(TEXT("num_points"));
+
+        const TArray<TSharedPtr<FJsonValue>> &FrameData = FrameEntryObject->GetArrayField(TEXT("frame_data"));
+        if (FrameData.Num() > static_cast<int32>(Frame.NumPoints))
+        {
+            UE_LOG(LogHoudiniNiagara, Error, TEXT("Found more samples in frame %d as specified %d"), (int)Frame.FrameNumber, (int)Frame.NumPoints)
+            return false;
+        }
+        FrameSamples.Add(&FrameData);
+    }
+
+    if (!ValidateFrames(InAsset, Frames, Header))
+        return false;
 
-        const TArray<TSharedPtr<FJsonValue>> FrameData = FrameEntryObject->GetArrayField(TEXT("frame_data"));
+    // Second pass: convert the frames' values, in parallel, each frame only writes to its own samples.
+    // The JSON values are only accessed through references, so their reference counts are left untouched.
+    FThreadSafeBool bDecodeFailed = false;
+    ParallelFor(Frames.Num(), [&](int32 FrameIndex)
+    {
+        const FHoudiniPointCacheJSONFrame& Frame = Frames[FrameIndex];
 
-        // Ensure we have enough space in our FrameData array to read the samples for this frame
-        TempFrameData.SetNum(NumPointsInFrame);
-        float PreviousAge = 0.0f;
-        bool bNeedToSort = false;
+        TArray<TArray<float>> FrameData;
+        FrameData.SetNum(Frame.NumPoints);
         uint32 SampleIndex = 0;
-        for (const TSharedPtr<FJsonValue> &SampleAsValue : FrameData)
+        for (const TSharedPtr<FJsonValue> &SampleAsValue : *FrameSamples[FrameIndex])
         {
-            if (SampleIndex >= NumPointsInFrame)
-            {
-                UE_LOG(LogHoudiniNiagara, Error, TEXT("Found more samples in frame %d as specified %d"), (int)FrameNumber, (int)NumPointsInFrame)
-                return false;
-            }
-
             // Initialize attributes for this sample
-            TempFrameData[SampleIndex].Init(0, NumAttributesPerFileSample);
+            FrameData[SampleIndex].Init(0, NumAttributesPerFileSample);
             uint32 AttrIndex = 0;
             for (const TSharedPtr<FJsonValue> &AttrEntryAsValue : SampleAsValue->AsArray())
             {
                 if (AttrIndex >= NumAttributesPerFileSample)
                 {
-                    UE_LOG(LogHoudiniNiagara, Error, TEXT("Found more attributes in frame %d, sample %d as specified %d"), (int)FrameNumber, (int)SampleIndex, (int)NumAttributesPerFileSample)
-                    return false;
+                    UE_LOG(LogHoudiniNiagara, Error, TEXT("Found more attributes in frame %d, sample %d as specified %d"), (int)Frame.FrameNumber, (int)SampleIndex, (int)NumAttributesPerFileSample)
+                    bDecodeFailed = true;
+                    return;
                 }
 
-                float& Value = TempFrameData[SampleIndex][AttrIndex];
-                Value = AttrEntryAsValue->AsNumber();
-
-                if (AgeAttributeIndex != INDEX_NONE && AttrIndex == AgeAttributeIndex)
-                {
-                    if (SampleIndex == 0)
-                    {
-                        PreviousAge = Value;
-                    }
-                    else if (PreviousAge < Value)
-                    {
-                        bNeedToSort = true;
-                    }
-                }
+                FrameData[SampleIndex][AttrIndex] = AttrEntryAsValue->AsNumber();
                 AttrIndex++;
             }
 
             SampleIndex++;
         }
 
-        // Sort this frame's data by age
-        if (bNeedToSort)
-        {
-            TempFrameData.Sort<FHoudiniPointCacheSortPredicate>(FHoudiniPointCacheSortPredicate(INDEX_NONE, AgeAttributeIndex, IDAttributeIndex));
-        }
+        if (!DecodeFrame(InAsset, FrameData, Frame, NumAttributesPerFileSample))
+            bDecodeFailed = true;
+    });
 
-        ProcessFrame(InAsset, FrameNumber, TempFrameData, Time, FrameStartSampleIndex, NumPointsInFrame, NumAttributesPerFileSample, Header, HoudiniIDToNiagaraIDMap, NextPointID);
+    if (bDecodeFailed)
+        return false;
 
-        FrameStartSampleIndex += NumPointsInFrame;
-    }
+    // Last pass: remap the point IDs in order and build the per point data
+    if (!FinalizeFrames(InAsset, Frames))
+        return false;
 
     // Load uncompressed raw data into asset.
     // TODO: Rebuild JSON string from this buffer to avoid loading data twice. 
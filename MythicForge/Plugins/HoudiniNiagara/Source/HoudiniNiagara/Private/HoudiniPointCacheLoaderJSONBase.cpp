@@ -195,82 +195,140 @@ bool FHoudiniPointCacheLoaderJSONBase::ParseAttributesAndInitAsset(UHoudiniPoint
 }
 
 
-bool FHoudiniPointCacheLoaderJSONBase::ProcessFrame(UHoudiniPointCache *InAsset, float InFrameNumber, const TArray<TArray<float>> &InFrameData, float InFrameTime, uint32 InFrameStartSampleIndex, uint32 InNumPointsInFrame, uint32 InNumAttributesPerPoint, const FHoudiniPointCacheJSONHeader &InHeader, TMap<int32, int32>& InHoudiniIDToNiagaraIDMap, int32 &OutNextPointID) const
+bool FHoudiniPointCacheLoaderJSONBase::ValidateFrames(UHoudiniPointCache *InAsset, TArray<FHoudiniPointCacheJSONFrame> &InOutFrames, const FHoudiniPointCacheJSONHeader &InHeader) const
 {
-    // Get references to the various data arrays of the asset
-    TArray<float> &FloatSampleData = InAsset->GetFloatSampleData();
-    TArray<float> &SpawnTimes = InAsset->GetSpawnTimes();
-    TArray<float> &LifeValues = InAsset->GetLifeValues();
-    TArray<int32> &PointTypes = InAsset->GetPointTypes();
-    TArray<FPointIndexes> &PointValueIndexes = InAsset->GetPointValueIndexes();
-
-    // Set Min/Max Time seen in asset
-    if (InFrameTime < InAsset->MinSampleTime)
-    {
-        InAsset->MinSampleTime = InFrameTime;
-    }
-    if (InFrameTime > InAsset->MaxSampleTime)
+    if (InOutFrames.Num() != InHeader.NumFrames)
     {
-        InAsset->MaxSampleTime = InFrameTime;
+        UE_LOG(LogHoudiniNiagara, Error, TEXT("Inconsistent num_frames in header vs body: %d vs %d"), InHeader.NumFrames, InOutFrames.Num());
+        return false;
     }
-    if (InFrameNumber < InAsset->FirstFrame)
+
+    // Frames are stored one after the other in FloatSampleData
+    uint64 FrameStartSampleIndex = 0;
+    for (FHoudiniPointCacheJSONFrame &Frame : InOutFrames)
     {
-        InAsset->FirstFrame = InFrameNumber;
+        Frame.StartSampleIndex = static_cast<uint32>(FrameStartSampleIndex);
+        FrameStartSampleIndex += Frame.NumPoints;
     }
-    if (InFrameNumber > InAsset->LastFrame)
+
+    if (FrameStartSampleIndex > static_cast<uint64>(InAsset->NumberOfSamples))
     {
-        InAsset->LastFrame = InFrameNumber;
+        UE_LOG(LogHoudiniNiagara, Error, TEXT("Inconsistent num_samples in header vs body: %d vs %llu"), InAsset->NumberOfSamples, FrameStartSampleIndex);
+        return false;
     }
 
-    // Get Age attribute index, we'll use this to ensure we sort point spawn time correctly
+    return true;
+}
+
+
+bool FHoudiniPointCacheLoaderJSONBase::DecodeFrame(UHoudiniPointCache *InAsset, TArray<TArray<float>> &InOutFrameData, const FHoudiniPointCacheJSONFrame &InFrame, uint32 InNumAttributesPerPoint) const
+{
+    // Get a reference to the sample data, only this frame's samples are written to
+    TArray<float> &FloatSampleData = InAsset->GetFloatSampleData();
+
     int32 IDAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::POINTID);
 	int32 AgeAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::AGE);
-    int32 LifeAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::LIFE);
-    int32 TypeAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::TYPE);
     int32 TimeAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::TIME);
 
-    if (InFrameData.Num() != InNumPointsInFrame)
+    if (InOutFrameData.Num() != InFrame.NumPoints)
     {
         UE_LOG(LogHoudiniNiagara, Error, TEXT("Inconsistent InFrameData size vs specified number of points in frame."));
         return false;
     }
 
-    // Copy the frame data into the FloatSampleData array, determine unique points IDs
-    // Also calculate SpawnTimes, LifeValues (if the life attribute exists)
-    int32 CurrentID = -1;
-    for (uint32 FrameSampleIndex = 0; FrameSampleIndex < InNumPointsInFrame; ++FrameSampleIndex)
+    // Check Attribute sample array sizes
+    for (uint32 FrameSampleIndex = 0; FrameSampleIndex < InFrame.NumPoints; ++FrameSampleIndex)
     {
-        uint32 SampleIndex = InFrameStartSampleIndex + FrameSampleIndex;
-        // Check Attribute sample array size
-        if (InFrameData[FrameSampleIndex].Num() != InNumAttributesPerPoint)
+        if (InOutFrameData[FrameSampleIndex].Num() != InNumAttributesPerPoint)
         {
-            UE_LOG(LogHoudiniNiagara, Error, TEXT("Inconsistent InFrameData at SampleIndex %d: point attribute array size vs specified number of attributes per point."), SampleIndex);
+            UE_LOG(LogHoudiniNiagara, Error, TEXT("Inconsistent InFrameData at SampleIndex %d: point attribute array size vs specified number of attributes per point."), InFrame.StartSampleIndex + FrameSampleIndex);
             return false;
         }
+    }
+
+    // Sort this frame's data by age if the samples are not already ordered by decreasing age
+    if (AgeAttributeIndex != INDEX_NONE && static_cast<uint32>(AgeAttributeIndex) < InNumAttributesPerPoint)
+    {
+        bool bNeedToSort = false;
+        for (uint32 FrameSampleIndex = 1; FrameSampleIndex < InFrame.NumPoints && !bNeedToSort; ++FrameSampleIndex)
+            bNeedToSort = InOutFrameData[FrameSampleIndex - 1][AgeAttributeIndex] < InOutFrameData[FrameSampleIndex][AgeAttributeIndex];
+
+        if (bNeedToSort)
+            InOutFrameData.Sort<FHoudiniPointCacheSortPredicate>(FHoudiniPointCacheSortPredicate(INDEX_NONE, AgeAttributeIndex, IDAttributeIndex));
+    }
+
+    // Copy the frame data into the FloatSampleData array
+    for (uint32 FrameSampleIndex = 0; FrameSampleIndex < InFrame.NumPoints; ++FrameSampleIndex)
+    {
+        uint32 SampleIndex = InFrame.StartSampleIndex + FrameSampleIndex;
         for (uint32 AttrIndex = 0; AttrIndex < InNumAttributesPerPoint; ++AttrIndex)
         {
-            // Get the float value for the attribute
-            float FloatValue = InFrameData[FrameSampleIndex][AttrIndex];
+            FloatSampleData[SampleIndex + (AttrIndex * InAsset->NumberOfSamples)] = InOutFrameData[FrameSampleIndex][AttrIndex];
+        }
+
+        // Always use the frame time, in other words, ignore a 'time' attribute
+        if (TimeAttributeIndex != INDEX_NONE)
+        {
+            FloatSampleData[SampleIndex + (TimeAttributeIndex * InAsset->NumberOfSamples)] = InFrame.Time;
+        }
+    }
+
+    return true;
+}
+
 
-            // Handle point IDs here
-            if (AttrIndex == IDAttributeIndex)
+bool FHoudiniPointCacheLoaderJSONBase::FinalizeFrames(UHoudiniPointCache *InAsset, const TArray<FHoudiniPointCacheJSONFrame> &InFrames) const
+{
+    // Get references to the various data arrays of the asset
+    TArray<float> &FloatSampleData = InAsset->GetFloatSampleData();
+    TArray<float> &SpawnTimes = InAsset->GetSpawnTimes();
+    TArray<float> &LifeValues = InAsset->GetLifeValues();
+    TArray<int32> &PointTypes = InAsset->GetPointTypes();
+    TArray<FPointIndexes> &PointValueIndexes = InAsset->GetPointValueIndexes();
+
+    int32 IDAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::POINTID);
+	int32 AgeAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::AGE);
+    int32 LifeAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::LIFE);
+    int32 TypeAttributeIndex = InAsset->GetAttributeAttributeIndex(EHoudiniAttributes::TYPE);
+
+	// Due to the way that some of the DI functions work,
+	// we expect that the point IDs start at zero, and increment as the points are spawned
+	// Make sure this is the case by converting the point IDs in the order the samples appear in the file
+	int32 NextPointID = 0;
+	TMap<int32, int32> HoudiniIDToNiagaraIDMap;
+
+    for (const FHoudiniPointCacheJSONFrame &Frame : InFrames)
+    {
+        // Set Min/Max Time seen in asset
+        InAsset->MinSampleTime = FMath::Min(InAsset->MinSampleTime, Frame.Time);
+        InAsset->MaxSampleTime = FMath::Max(InAsset->MaxSampleTime, Frame.Time);
+        InAsset->FirstFrame = FMath::Min(InAsset->FirstFrame, Frame.FrameNumber);
+        InAsset->LastFrame = FMath::Max(InAsset->LastFrame, Frame.FrameNumber);
+
+        // Determine unique points IDs
+        // Also calculate SpawnTimes, LifeValues (if the life attribute exists)
+        for (uint32 FrameSampleIndex = 0; FrameSampleIndex < Frame.NumPoints; ++FrameSampleIndex)
+        {
+            uint32 SampleIndex = Frame.StartSampleIndex + FrameSampleIndex;
+
+            // Get the reconstructed point id
+            int32 CurrentID = SampleIndex;
+            if (IDAttributeIndex != INDEX_NONE)
             {
                 // If the point ID doesn't exist in the Houdini/Niagara mapping, create a new a entry.
                 // Otherwise, replace the point ID with the Niagara ID.
-                int32 PointID = FMath::FloorToInt(FloatValue);
+                float& IDValue = FloatSampleData[SampleIndex + (IDAttributeIndex * InAsset->NumberOfSamples)];
+                int32 PointID = FMath::FloorToInt(IDValue);
 
-                // The point ID may need to be replaced
-                if (!InHoudiniIDToNiagaraIDMap.Contains(PointID))
+                int32* FoundID = HoudiniIDToNiagaraIDMap.Find(PointID);
+                if (!FoundID)
                 {
                     // We found a new point, so we add it to the ID map
-                    InHoudiniIDToNiagaraIDMap.Add(PointID, OutNextPointID++);
-
-                    // // Add a new array for that point's indexes
-                    // PointValueIndexes.Add(FPointIndexes());
+                    FoundID = &HoudiniIDToNiagaraIDMap.Add(PointID, NextPointID++);
                 }
 
                 // Get the Niagara ID from the Houdini ID
-                CurrentID = InHoudiniIDToNiagaraIDMap[PointID];
+                CurrentID = *FoundID;
 
                 // Check that CurrentID is still in the expected range
                 if (CurrentID < 0 || CurrentID >= InAsset->NumberOfPoints)
@@ -280,91 +338,67 @@ bool FHoudiniPointCacheLoaderJSONBase::ProcessFrame(UHoudiniPointCache *InAsset,
                     return false;
                 }
 
-                FloatValue = static_cast<float>(CurrentID);
+                IDValue = static_cast<float>(CurrentID);
 
                 // Add the current sample index to this point's sample index list
                 PointValueIndexes[CurrentID].SampleIndexes.Add(SampleIndex);
             }
+            else
+            {
+                // If we dont have Point ID information, we still want to fill the PointValueIndexes array
+                // Each sample is considered its own point
+                PointValueIndexes[SampleIndex].SampleIndexes.Add(SampleIndex);
+            }
 
-            // Store the Value in the buffer
-            FloatSampleData[SampleIndex + (AttrIndex * InAsset->NumberOfSamples)] = FloatValue;
-        }
+            // The time value comes from the frame entry
+            const float CurrentTime = Frame.Time;
 
-        // Always use the frame time, in other words, ignore a 'time' attribute
-        if (TimeAttributeIndex != INDEX_NONE)
-        {
-            FloatSampleData[SampleIndex + (TimeAttributeIndex * InAsset->NumberOfSamples)] = InFrameTime;
-        }
-
-        // If we dont have Point ID information, we still want to fill the PointValueIndexes array
-        if (IDAttributeIndex == INDEX_NONE)
-        {
-            // Each sample is considered its own point
-            // PointValueIndexes.Add(FPointIndexes());
-            PointValueIndexes[SampleIndex].SampleIndexes.Add(SampleIndex);
-        }
+            if (FMath::IsNearlyEqual(SpawnTimes[CurrentID], -FLT_MAX))
+            {
+                // We have detected a new particle. 
 
-        // Calculate SpawnTimes, LifeValues and PointTypes
-        // Get the reconstructed point id
-        if (IDAttributeIndex != INDEX_NONE)
-        {
-            // Get remapped the external point ID to the expected Niagara particle ID.
-            CurrentID = static_cast<int32>(FloatSampleData[SampleIndex + (IDAttributeIndex * InAsset->NumberOfSamples)]);
-            // CurrentID = InHoudiniIDToNiagaraIDMap[CurrentID];
-        }
-        else
-        {
-            CurrentID = SampleIndex;
-        }
-        
-        // The time value comes from the frame entry
-        const float CurrentTime = InFrameTime;
+                // Calculate spawn and life from attributes.
+                // Spawn time is when the point is first seen
+                if (AgeAttributeIndex != INDEX_NONE)
+                {
+                    // If we have an age attribute we can more accurately calculate the particle's spawn time.
+                    SpawnTimes[CurrentID] = CurrentTime - FloatSampleData[SampleIndex + (AgeAttributeIndex * InAsset->NumberOfSamples)];
+                }
+                else 
+                {
+                    // We don't have an age attribute. Simply use the current time as the spawn time.
+                    // Note that we bias the value slightly to that the particle is already spawned at the CurrentTime.
+                    SpawnTimes[CurrentID] = CurrentTime;
+                }
 
-        if (FMath::IsNearlyEqual(SpawnTimes[CurrentID], -FLT_MAX))
-        {
-            // We have detected a new particle. 
+                if (LifeAttributeIndex != INDEX_NONE)
+                {	
+                    LifeValues[CurrentID] = FloatSampleData[SampleIndex + (LifeAttributeIndex * InAsset->NumberOfSamples)];
+                }
+            }
 
-            // Calculate spawn and life from attributes.
-            // Spawn time is when the point is first seen
-            if (AgeAttributeIndex != INDEX_NONE)
+            // If we don't have a life attribute, keep setting the life attribute for the particle
+            // so that when the particle is no longer present we have recorded its last observed time
+            if (LifeAttributeIndex == INDEX_NONE && LifeValues[CurrentID] < CurrentTime)
             {
-                // If we have an age attribute we can more accurately calculate the particle's spawn time.
-                SpawnTimes[CurrentID] = CurrentTime - FloatSampleData[SampleIndex + (AgeAttributeIndex * InAsset->NumberOfSamples)];
-            }
-            else 
+                // Life is the difference between spawn time and time of death
+                // Note that the particle should still be alive at this timestep. Since we don't 
+                // have access to a frame rate here we will workaround this for now by adding
+                // a small value such that the particle dies *after* this timestep.
+                LifeValues[CurrentID] = CurrentTime - SpawnTimes[CurrentID];
+            }		
+
+            // Keep track of the point type at spawn
+            if (PointTypes[CurrentID] < 0)
             {
-                // We don't have an age attribute. Simply use the current time as the spawn time.
-                // Note that we bias the value slightly to that the particle is already spawned at the CurrentTime.
-                SpawnTimes[CurrentID] = CurrentTime;
-            }
+                float CurrentType = 0.0f;
+                if (TypeAttributeIndex != INDEX_NONE)
+                    CurrentType = FloatSampleData[SampleIndex + (TypeAttributeIndex * InAsset->NumberOfSamples)];
 
-            if (LifeAttributeIndex != INDEX_NONE)
-            {	
-                LifeValues[CurrentID] = FloatSampleData[SampleIndex + (LifeAttributeIndex * InAsset->NumberOfSamples)];
+                PointTypes[CurrentID] = static_cast<int32>(CurrentType);
             }
         }
-
-        // If we don't have a life attribute, keep setting the life attribute for the particle
-        // so that when the particle is no longer present we have recorded its last observed time
-        if (LifeAttributeIndex == INDEX_NONE && LifeValues[CurrentID] < CurrentTime)
-        {
-            // Life is the difference between spawn time and time of death
-            // Note that the particle should still be alive at this timestep. Since we don't 
-            // have access to a frame rate here we will workaround this for now by adding
-            // a small value such that the particle dies *after* this timestep.
-            LifeValues[CurrentID] = CurrentTime - SpawnTimes[CurrentID];
-        }		
-
-        // Keep track of the point type at spawn
-        if (PointTypes[CurrentID] < 0)
-        {
-            float CurrentType = 0.0f;
-            if (TypeAttributeIndex != INDEX_NONE)
-                CurrentType = FloatSampleData[SampleIndex + (TypeAttributeIndex * InAsset->NumberOfSamples)];
-
-            PointTypes[CurrentID] = static_cast<int32>(CurrentType);
-        }
     }
 
     return true;
-}
\ No newline at end of file
+}
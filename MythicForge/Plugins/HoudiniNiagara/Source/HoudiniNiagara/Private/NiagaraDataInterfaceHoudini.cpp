@@ -29,6 +29,7 @@
 #include "HAL/PlatformProcess.h"
 #include "Misc/CoreMiscDefines.h"
 #include "Misc/EngineVersionComparison.h"
+#include "Math/VectorRegister.h"
 #include "Misc/Paths.h"
 #include "NiagaraRenderer.h"
 #include "NiagaraShader.h"
@@ -56,6 +57,8 @@ const FString UNiagaraDataInterfaceHoudini::LastSpawnedPointIdBaseName(TEXT("Las
 const FString UNiagaraDataInterfaceHoudini::LastSpawnTimeBaseName(TEXT("LastSpawnTime_"));
 const FString UNiagaraDataInterfaceHoudini::LastSpawnTimeRequestBaseName(TEXT("LastSpawnTimeRequest_"));
 const FString UNiagaraDataInterfaceHoudini::FunctionIndexToAttributeIndexBufferBaseName(TEXT("FunctionIndexToAttributeIndexBuffer_"));
+const FString UNiagaraDataInterfaceHoudini::SampleWindowStartBaseName(TEXT("SampleWindowStart_"));
+const FString UNiagaraDataInterfaceHoudini::SampleWindowStrideBaseName(TEXT("SampleWindowStride_"));
 
 #else
 #include "NiagaraShaderParametersBuilder.h"
@@ -84,6 +87,8 @@ const FString UNiagaraDataInterfaceHoudini::LastSpawnedPointIdBaseName(TEXT("_La
 const FString UNiagaraDataInterfaceHoudini::LastSpawnTimeBaseName(TEXT("_LastSpawnTime"));
 const FString UNiagaraDataInterfaceHoudini::LastSpawnTimeRequestBaseName(TEXT("_LastSpawnTimeRequest"));
 const FString UNiagaraDataInterfaceHoudini::FunctionIndexToAttributeIndexBufferBaseName(TEXT("_FunctionIndexToAttributeIndexBuffer"));
+const FString UNiagaraDataInterfaceHoudini::SampleWindowStartBaseName(TEXT("_SampleWindowStart"));
+const FString UNiagaraDataInterfaceHoudini::SampleWindowStrideBaseName(TEXT("_SampleWindowStride"));
 
 
 #endif
@@ -151,6 +156,234 @@ UNiagaraDataInterfaceHoudini::UNiagaraDataInterfaceHoudini(FObjectInitializer co
 	Proxy.Reset(new FNiagaraDataInterfaceProxyHoudini());
 }
 
+// Batched reads of point cache values for the CPU VM functions.
+// Instances are processed in blocks: the samples' values are gathered per component from the
+// point cache's float data, then blended and scaled 4 instances at a time.
+// Instances whose sample or attribute is invalid read 0, like the scalar accessors.
+class FHoudiniPointCacheBlockReader
+{
+public:
+	static constexpr int32 BlockSize = 256;
+	static constexpr int32 MaxComponents = 4;
+
+	FHoudiniPointCacheBlockReader(const UHoudiniPointCache* InPointCache, int32 InNumComponents)
+		: Data(nullptr)
+		, NumData(0)
+		, NumSamples(0)
+		, NumAttributes(0)
+		, NumComponents(FMath::Clamp(InNumComponents, 1, MaxComponents))
+		, Num(0)
+		, bLerp(false)
+	{
+		if (InPointCache)
+		{
+			const TArrayView<const float> FloatValues = InPointCache->GetFloatSampleValues();
+			Data = FloatValues.GetData();
+			NumData = FloatValues.Num();
+			NumSamples = InPointCache->GetNumberOfSamples();
+			NumAttributes = InPointCache->GetNumberOfAttributes();
+		}
+	}
+
+	// Starts a new block, returns the number of instances it contains
+	int32 BeginBlock(int32 NumRemaining)
+	{
+		Num = FMath::Min(NumRemaining, BlockSize);
+		bLerp = false;
+		return Num;
+	}
+
+	// Sets the sample read by an instance of the block.
+	// bSwap swaps Y/Z of vectors (or does the Houdini to Unreal conversion of quats), bScale converts to cm
+	void SetSample(int32 Instance, int32 SampleIndex, int32 AttrIndex, bool bSwap = false, bool bScale = false)
+	{
+		PrevElements[Instance] = GetElement(SampleIndex, AttrIndex);
+		NextElements[Instance] = PrevElements[Instance];
+		Weights[Instance] = 0.0f;
+		Scales[Instance] = bScale ? 100.0f : 1.0f;
+		Swaps[Instance] = bSwap;
+	}
+
+	// Sets the samples blended by an instance of the block
+	void SetSampleBlend(int32 Instance, const FHoudiniPointSampleBlend& Blend, int32 AttrIndex, bool bSwap = false, bool bScale = false)
+	{
+		const int32 PrevElement = GetElement(Blend.PrevSampleIndex, AttrIndex);
+		const int32 NextElement = GetElement(Blend.NextSampleIndex, AttrIndex);
+		const bool bValid = PrevElement != INDEX_NONE && NextElement != INDEX_NONE;
+
+		PrevElements[Instance] = bValid ? PrevElement : INDEX_NONE;
+		NextElements[Instance] = bValid ? NextElement : INDEX_NONE;
+		Weights[Instance] = Blend.PrevWeight;
+		Scales[Instance] = bScale ? 100.0f : 1.0f;
+		Swaps[Instance] = bSwap;
+
+		bLerp |= PrevElements[Instance] != NextElements[Instance];
+	}
+
+	// Reads the values of all the block's instances
+	void Read()
+	{
+		for (int32 Component = 0; Component < NumComponents; ++Component)
+		{
+			const int32 ComponentOffset = Component * NumSamples;
+			Gather(PrevElements, ComponentOffset, Values[Component]);
+			if (bLerp)
+			{
+				Gather(NextElements, ComponentOffset, NextValues);
+				LerpScale(Values[Component], NextValues);
+			}
+			else
+			{
+				Scale(Values[Component]);
+			}
+		}
+	}
+
+	void WriteFloat(VectorVM::FExternalFuncRegisterHandler<float>& OutValue) const
+	{
+		for (int32 Instance = 0; Instance < Num; ++Instance)
+			*OutValue.GetDestAndAdvance() = Values[0][Instance];
+	}
+
+	void WriteVector(
+		VectorVM::FExternalFuncRegisterHandler<float>& OutX,
+		VectorVM::FExternalFuncRegisterHandler<float>& OutY,
+		VectorVM::FExternalFuncRegisterHandler<float>& OutZ) const
+	{
+		for (int32 Instance = 0; Instance < Num; ++Instance)
+		{
+			*OutX.GetDestAndAdvance() = Values[0][Instance];
+			*OutY.GetDestAndAdvance() = Values[Swaps[Instance] ? 2 : 1][Instance];
+			*OutZ.GetDestAndAdvance() = Values[Swaps[Instance] ? 1 : 2][Instance];
+		}
+	}
+
+	void WriteVector4(
+		VectorVM::FExternalFuncRegisterHandler<float>& OutX,
+		VectorVM::FExternalFuncRegisterHandler<float>& OutY,
+		VectorVM::FExternalFuncRegisterHandler<float>& OutZ,
+		VectorVM::FExternalFuncRegisterHandler<float>& OutW) const
+	{
+		for (int32 Instance = 0; Instance < Num; ++Instance)
+		{
+			*OutX.GetDestAndAdvance() = Values[0][Instance];
+			*OutY.GetDestAndAdvance() = Values[1][Instance];
+			*OutZ.GetDestAndAdvance() = Values[2][Instance];
+			*OutW.GetDestAndAdvance() = Values[3][Instance];
+		}
+	}
+
+	void WriteQuat(
+		VectorVM::FExternalFuncRegisterHandler<float>& OutX,
+		VectorVM::FExternalFuncRegisterHandler<float>& OutY,
+		VectorVM::FExternalFuncRegisterHandler<float>& OutZ,
+		VectorVM::FExternalFuncRegisterHandler<float>& OutW) const
+	{
+		for (int32 Instance = 0; Instance < Num; ++Instance)
+		{
+			// Houdini Quat (y up, left handed) to unreal Quat (z up, right handed): swap y/z and negate
+			const float Sign = Swaps[Instance] ? -1.0f : 1.0f;
+			*OutX.GetDestAndAdvance() = Sign * Values[0][Instance];
+			*OutY.GetDestAndAdvance() = Sign * Values[Swaps[Instance] ? 2 : 1][Instance];
+			*OutZ.GetDestAndAdvance() = Sign * Values[Swaps[Instance] ? 1 : 2][Instance];
+			*OutW.GetDestAndAdvance() = Values[3][Instance];
+		}
+	}
+
+private:
+
+	// Returns the index in the float data of the attribute's first component for a sample,
+	// or INDEX_NONE if the sample or any of the attribute's components is out of range
+	int32 GetElement(int32 SampleIndex, int32 AttrIndex) const
+	{
+		if (SampleIndex < 0 || SampleIndex >= NumSamples)
+			return INDEX_NONE;
+
+		if (AttrIndex < 0 || AttrIndex + NumComponents > NumAttributes)
+			return INDEX_NONE;
+
+		const int32 Element = SampleIndex + AttrIndex * NumSamples;
+		if (Element + (NumComponents - 1) * NumSamples >= NumData)
+			return INDEX_NONE;
+
+		return Element;
+	}
+
+	void Gather(const int32* Elements, int32 ComponentOffset, float* Out) const
+	{
+		for (int32 Instance = 0; Instance < Num; ++Instance)
+			Out[Instance] = Elements[Instance] != INDEX_NONE ? Data[Elements[Instance] + ComponentOffset] : 0.0f;
+	}
+
+	// InOutValues = Lerp(InOutValues, NextValues, Weights) * Scales
+	void LerpScale(float* InOutValues, const float* InNextValues) const
+	{
+		int32 Instance = 0;
+		for (; Instance + 4 <= Num; Instance += 4)
+		{
+			const VectorRegister4Float Prev = VectorLoad(InOutValues + Instance);
+			const VectorRegister4Float Next = VectorLoad(InNextValues + Instance);
+			const VectorRegister4Float Blended = VectorMultiplyAdd(VectorSubtract(Next, Prev), VectorLoad(Weights + Instance), Prev);
+			VectorStore(VectorMultiply(Blended, VectorLoad(Scales + Instance)), InOutValues + Instance);
+		}
+
+		for (; Instance < Num; ++Instance)
+			InOutValues[Instance] = FMath::Lerp(InOutValues[Instance], InNextValues[Instance], Weights[Instance]) * Scales[Instance];
+	}
+
+	// InOutValues *= Scales
+	void Scale(float* InOutValues) const
+	{
+		int32 Instance = 0;
+		for (; Instance + 4 <= Num; Instance += 4)
+			VectorStore(VectorMultiply(VectorLoad(InOutValues + Instance), VectorLoad(Scales + Instance)), InOutValues + Instance);
+
+		for (; Instance < Num; ++Instance)
+			InOutValues[Instance] *= Scales[Instance];
+	}
+
+	const float* Data;
+	int32 NumData;
+	int32 NumSamples;
+	int32 NumAttributes;
+	int32 NumComponents;
+
+	int32 Num;
+	bool bLerp;
+
+	int32 PrevElements[BlockSize];
+	int32 NextElements[BlockSize];
+	float Weights[BlockSize];
+	float Scales[BlockSize];
+	bool Swaps[BlockSize];
+
+	float Values[MaxComponents][BlockSize];
+	float NextValues[BlockSize];
+};
+
+// Grabs the data interface's playback cursor for the duration of a VM call.
+// VM batches can run in parallel, a batch finding the cursor in use does its lookups without it.
+class FHoudiniScopedPlaybackCursor
+{
+public:
+	FHoudiniScopedPlaybackCursor(FCriticalSection& InLock, FHoudiniPointCacheCursor& InCursor)
+		: Lock(InLock)
+		, Cursor(InLock.TryLock() ? &InCursor : nullptr)
+	{}
+
+	~FHoudiniScopedPlaybackCursor()
+	{
+		if (Cursor)
+			Lock.Unlock();
+	}
+
+	FHoudiniPointCacheCursor* Get() const { return Cursor; }
+
+private:
+	FCriticalSection& Lock;
+	FHoudiniPointCacheCursor* Cursor;
+};
+
 void UNiagaraDataInterfaceHoudini::PostInitProperties()
 {
     Super::PostInitProperties();
@@ -1306,20 +1539,20 @@ void UNiagaraDataInterfaceHoudini::GetFloatValue(FVectorVMExternalFunctionContex
 
     VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
 
-    for ( int32 i = 0; i < Context.GetNumInstances(); ++i )
-    {
-		int32 SampleIndex = SampleIndexParam.Get();
-		int32 AttributeIndex = AttributeIndexParam.Get();
-	
-		float value = 0.0f;
-		if ( HoudiniPointCacheAsset )
-			HoudiniPointCacheAsset->GetFloatValue( SampleIndex, AttributeIndex, value );
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 1);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			const int32 SampleIndex = SampleIndexParam.GetAndAdvance();
+			const int32 AttributeIndex = AttributeIndexParam.GetAndAdvance();
+			Reader.SetSample(i, SampleIndex, AttributeIndex);
+		}
 
-		*OutValue.GetDest() = value;
-		SampleIndexParam.Advance();
-		AttributeIndexParam.Advance();
-		OutValue.Advance();
-    }
+		Reader.Read();
+		Reader.WriteFloat(OutValue);
+	}
 }
 
 void UNiagaraDataInterfaceHoudini::GetVectorValue(FVectorVMExternalFunctionContext& Context)
@@ -1331,25 +1564,20 @@ void UNiagaraDataInterfaceHoudini::GetVectorValue(FVectorVMExternalFunctionConte
 	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
 
-    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-    {
-		int32 SampleIndex = SampleIndexParam.Get();
-		int32 AttributeIndex = AttributeIndexParam.Get();
-
-		FVector V = FVector::ZeroVector;
-		if ( HoudiniPointCacheAsset )
-			HoudiniPointCacheAsset->GetVectorValue(SampleIndex, AttributeIndex, V);
-
-		*OutVectorX.GetDest() = V.X;
-		*OutVectorY.GetDest() = V.Y;
-		*OutVectorZ.GetDest() = V.Z;
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 3);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			const int32 SampleIndex = SampleIndexParam.GetAndAdvance();
+			const int32 AttributeIndex = AttributeIndexParam.GetAndAdvance();
+			Reader.SetSample(i, SampleIndex, AttributeIndex, true, true);
+		}
 
-		SampleIndexParam.Advance();
-		AttributeIndexParam.Advance();
-		OutVectorX.Advance();
-		OutVectorY.Advance();
-		OutVectorZ.Advance();
-    }
+		Reader.Read();
+		Reader.WriteVector(OutVectorX, OutVectorY, OutVectorZ);
+	}
 }
 
 void UNiagaraDataInterfaceHoudini::GetVectorValueByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute)
@@ -1360,22 +1588,22 @@ void UNiagaraDataInterfaceHoudini::GetVectorValueByString(FVectorVMExternalFunct
 	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 SampleIndex = SampleIndexParam.Get();
-
-		FVector V = FVector::ZeroVector;
-		if (HoudiniPointCacheAsset)
-			HoudiniPointCacheAsset->GetVectorValueForString(SampleIndex, Attribute, V);
+	int32 AttrIndex = INDEX_NONE;
+	if (HoudiniPointCacheAsset)
+		HoudiniPointCacheAsset->GetAttributeIndexFromString(Attribute, AttrIndex);
 
-		*OutVectorX.GetDest() = V.X;
-		*OutVectorY.GetDest() = V.Y;
-		*OutVectorZ.GetDest() = V.Z;
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 3);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			const int32 SampleIndex = SampleIndexParam.GetAndAdvance();
+			Reader.SetSample(i, SampleIndex, AttrIndex, true, true);
+		}
 
-		SampleIndexParam.Advance();
-		OutVectorX.Advance();
-		OutVectorY.Advance();
-		OutVectorZ.Advance();
+		Reader.Read();
+		Reader.WriteVector(OutVectorX, OutVectorY, OutVectorZ);
 	}
 }
 
@@ -1390,29 +1618,21 @@ void UNiagaraDataInterfaceHoudini::GetVectorValueEx(FVectorVMExternalFunctionCon
 	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 3);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
 	{
-		int32 SampleIndex = SampleIndexParam.Get();
-		int32 AttributeIndex = AttributeIndexParam.Get();
-
-		bool DoSwap = DoSwapParam.Get().GetValue();
-		bool DoScale = DoScaleParam.Get().GetValue();
-
-		FVector V = FVector::ZeroVector;
-		if (HoudiniPointCacheAsset)
-			HoudiniPointCacheAsset->GetVectorValue(SampleIndex, AttributeIndex, V, DoSwap, DoScale);
-
-		*OutVectorX.GetDest() = V.X;
-		*OutVectorY.GetDest() = V.Y;
-		*OutVectorZ.GetDest() = V.Z;
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			const int32 SampleIndex = SampleIndexParam.GetAndAdvance();
+			const int32 AttributeIndex = AttributeIndexParam.GetAndAdvance();
+			const bool DoSwap = DoSwapParam.GetAndAdvance().GetValue();
+			const bool DoScale = DoScaleParam.GetAndAdvance().GetValue();
+			Reader.SetSample(i, SampleIndex, AttributeIndex, DoSwap, DoScale);
+		}
 
-		SampleIndexParam.Advance();
-		AttributeIndexParam.Advance();
-		DoSwapParam.Advance();
-		DoScaleParam.Advance();
-		OutVectorX.Advance();
-		OutVectorY.Advance();
-		OutVectorZ.Advance();
+		Reader.Read();
+		Reader.WriteVector(OutVectorX, OutVectorY, OutVectorZ);
 	}
 }
 
@@ -1426,27 +1646,24 @@ void UNiagaraDataInterfaceHoudini::GetVectorValueExByString(FVectorVMExternalFun
 	VectorVM::FExternalFuncRegisterHandler<float> OutVectorY(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 SampleIndex = SampleIndexParam.Get();
-
-		bool DoSwap = DoSwapParam.Get().GetValue();
-		bool DoScale = DoScaleParam.Get().GetValue();
-
-		FVector V = FVector::ZeroVector;
-		if (HoudiniPointCacheAsset)
-			HoudiniPointCacheAsset->GetVectorValueForString(SampleIndex, Attribute, V, DoSwap, DoScale);
+	int32 AttrIndex = INDEX_NONE;
+	if (HoudiniPointCacheAsset)
+		HoudiniPointCacheAsset->GetAttributeIndexFromString(Attribute, AttrIndex);
 
-		*OutVectorX.GetDest() = V.X;
-		*OutVectorY.GetDest() = V.Y;
-		*OutVectorZ.GetDest() = V.Z;
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 3);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			const int32 SampleIndex = SampleIndexParam.GetAndAdvance();
+			const bool DoSwap = DoSwapParam.GetAndAdvance().GetValue();
+			const bool DoScale = DoScaleParam.GetAndAdvance().GetValue();
+			Reader.SetSample(i, SampleIndex, AttrIndex, DoSwap, DoScale);
+		}
 
-		SampleIndexParam.Advance();
-		DoSwapParam.Advance();
-		DoScaleParam.Advance();
-		OutVectorX.Advance();
-		OutVectorY.Advance();
-		OutVectorZ.Advance();
+		Reader.Read();
+		Reader.WriteVector(OutVectorX, OutVectorY, OutVectorZ);
 	}
 }
 
@@ -1460,27 +1677,20 @@ void UNiagaraDataInterfaceHoudini::GetVector4Value(FVectorVMExternalFunctionCont
 	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutVectorW(Context);
 
-    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-    {
-		int32 SampleIndex = SampleIndexParam.Get();
-		int32 AttributeIndex = AttributeIndexParam.Get();
-
-		FVector4 V(FVector::ZeroVector, 0);
-		if ( HoudiniPointCacheAsset )
-			HoudiniPointCacheAsset->GetVector4Value(SampleIndex, AttributeIndex, V);
-
-		*OutVectorX.GetDest() = V.X;
-		*OutVectorY.GetDest() = V.Y;
-		*OutVectorZ.GetDest() = V.Z;
-		*OutVectorW.GetDest() = V.W;
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 4);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			const int32 SampleIndex = SampleIndexParam.GetAndAdvance();
+			const int32 AttributeIndex = AttributeIndexParam.GetAndAdvance();
+			Reader.SetSample(i, SampleIndex, AttributeIndex);
+		}
 
-		SampleIndexParam.Advance();
-		AttributeIndexParam.Advance();
-		OutVectorX.Advance();
-		OutVectorY.Advance();
-		OutVectorZ.Advance();
-		OutVectorW.Advance();
-    }
+		Reader.Read();
+		Reader.WriteVector4(OutVectorX, OutVectorY, OutVectorZ, OutVectorW);
+	}
 }
 
 void UNiagaraDataInterfaceHoudini::GetVector4ValueByString(FVectorVMExternalFunctionContext& Context, const FString& Attribute)
@@ -1492,24 +1702,22 @@ void UNiagaraDataInterfaceHoudini::GetVector4ValueByString(FVectorVMExternalFunc
 	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutVectorW(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 SampleIndex = SampleIndexParam.Get();
-
-		FVector4 V(FVector::ZeroVector, 0);
-		if (HoudiniPointCacheAsset)
-			HoudiniPointCacheAsset->GetVector4ValueForString(SampleIndex, Attribute, V);
+	int32 AttrIndex = INDEX_NONE;
+	if (HoudiniPointCacheAsset)
+		HoudiniPointCacheAsset->GetAttributeIndexFromString(Attribute, AttrIndex);
 
-		*OutVectorX.GetDest() = V.X;
-		*OutVectorY.GetDest() = V.Y;
-		*OutVectorZ.GetDest() = V.Z;
-		*OutVectorW.GetDest() = V.W;
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 4);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			const int32 SampleIndex = SampleIndexParam.GetAndAdvance();
+			Reader.SetSample(i, SampleIndex, AttrIndex);
+		}
 
-		SampleIndexParam.Advance();
-		OutVectorX.Advance();
-		OutVectorY.Advance();
-		OutVectorZ.Advance();
-		OutVectorW.Advance();
+		Reader.Read();
+		Reader.WriteVector4(OutVectorX, OutVectorY, OutVectorZ, OutVectorW);
 	}
 }
 
@@ -1524,29 +1732,20 @@ void UNiagaraDataInterfaceHoudini::GetQuatValue(FVectorVMExternalFunctionContext
 	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutVectorW(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 4);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
 	{
-		int32 SampleIndex = SampleIndexParam.Get();
-		int32 AttributeIndex = AttributeIndexParam.Get();
-
-		bool DoHoudiniToUnrealConversion = DoHoudiniToUnrealConversionParam.Get().GetValue();
-
-		FQuat Q(0, 0, 0, 0);
-		if (HoudiniPointCacheAsset)
-			HoudiniPointCacheAsset->GetQuatValue(SampleIndex, AttributeIndex, Q, DoHoudiniToUnrealConversion);
-
-		*OutVectorX.GetDest() = Q.X;
-		*OutVectorY.GetDest() = Q.Y;
-		*OutVectorZ.GetDest() = Q.Z;
-		*OutVectorW.GetDest() = Q.W;
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			const int32 SampleIndex = SampleIndexParam.GetAndAdvance();
+			const int32 AttributeIndex = AttributeIndexParam.GetAndAdvance();
+			const bool DoHoudiniToUnrealConversion = DoHoudiniToUnrealConversionParam.GetAndAdvance().GetValue();
+			Reader.SetSample(i, SampleIndex, AttributeIndex, DoHoudiniToUnrealConversion);
+		}
 
-		SampleIndexParam.Advance();
-		AttributeIndexParam.Advance();
-		DoHoudiniToUnrealConversionParam.Advance();
-		OutVectorX.Advance();
-		OutVectorY.Advance();
-		OutVectorZ.Advance();
-		OutVectorW.Advance();
+		Reader.Read();
+		Reader.WriteQuat(OutVectorX, OutVectorY, OutVectorZ, OutVectorW);
 	}
 }
 
@@ -1560,27 +1759,23 @@ void UNiagaraDataInterfaceHoudini::GetQuatValueByString(FVectorVMExternalFunctio
 	VectorVM::FExternalFuncRegisterHandler<float> OutVectorZ(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutVectorW(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 SampleIndex = SampleIndexParam.Get();
-
-		bool DoHoudiniToUnrealConversion = DoHoudiniToUnrealConversionParam.Get().GetValue();
-
-		FQuat Q(0, 0, 0, 0);
-		if (HoudiniPointCacheAsset)
-			HoudiniPointCacheAsset->GetQuatValueForString(SampleIndex, Attribute, Q, DoHoudiniToUnrealConversion);
+	int32 AttrIndex = INDEX_NONE;
+	if (HoudiniPointCacheAsset)
+		HoudiniPointCacheAsset->GetAttributeIndexFromString(Attribute, AttrIndex);
 
-		*OutVectorX.GetDest() = Q.X;
-		*OutVectorY.GetDest() = Q.Y;
-		*OutVectorZ.GetDest() = Q.Z;
-		*OutVectorW.GetDest() = Q.W;
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 4);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			const int32 SampleIndex = SampleIndexParam.GetAndAdvance();
+			const bool DoHoudiniToUnrealConversion = DoHoudiniToUnrealConversionParam.GetAndAdvance().GetValue();
+			Reader.SetSample(i, SampleIndex, AttrIndex, DoHoudiniToUnrealConversion);
+		}
 
-		SampleIndexParam.Advance();
-		DoHoudiniToUnrealConversionParam.Advance();
-		OutVectorX.Advance();
-		OutVectorY.Advance();
-		OutVectorZ.Advance();
-		OutVectorW.Advance();
+		Reader.Read();
+		Reader.WriteQuat(OutVectorX, OutVectorY, OutVectorZ, OutVectorW);
 	}
 }
 
@@ -1590,18 +1785,23 @@ void UNiagaraDataInterfaceHoudini::GetFloatValueByString(FVectorVMExternalFuncti
 
     VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
 
-    for ( int32 i = 0; i < Context.GetNumInstances(); ++i )
-    {
-		int32 SampleIndex = SampleIndexParam.Get();
-	
-		float value = 0.0f;
-		if (HoudiniPointCacheAsset)
-			HoudiniPointCacheAsset->GetFloatValueForString(SampleIndex, Attribute, value);
+	int32 AttrIndex = INDEX_NONE;
+	if (HoudiniPointCacheAsset)
+		HoudiniPointCacheAsset->GetAttributeIndexFromString(Attribute, AttrIndex);
 
-		*OutValue.GetDest() = value;
-		SampleIndexParam.Advance();
-		OutValue.Advance();
-    }
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 1);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			const int32 SampleIndex = SampleIndexParam.GetAndAdvance();
+			Reader.SetSample(i, SampleIndex, AttrIndex);
+		}
+
+		Reader.Read();
+		Reader.WriteFloat(OutValue);
+	}
 }
 
 void UNiagaraDataInterfaceHoudini::GetPosition(FVectorVMExternalFunctionContext& Context)
@@ -1612,22 +1812,20 @@ void UNiagaraDataInterfaceHoudini::GetPosition(FVectorVMExternalFunctionContext&
     VectorVM::FExternalFuncRegisterHandler<float> OutSampleY(Context);
     VectorVM::FExternalFuncRegisterHandler<float> OutSampleZ(Context);
 
-    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-    {
-		int32 SampleIndex = SampleIndexParam.Get();
+	const int32 AttrIndex = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetAttributeAttributeIndex(EHoudiniAttributes::POSITION) : INDEX_NONE;
 
-		FVector V = FVector::ZeroVector;
-		if ( HoudiniPointCacheAsset )
-			HoudiniPointCacheAsset->GetPositionValue( SampleIndex, V );
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 3);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			Reader.SetSample(i, SampleIndexParam.GetAndAdvance(), AttrIndex, true, true);
+		}
 
-		*OutSampleX.GetDest() = V.X;
-		*OutSampleY.GetDest() = V.Y;
-		*OutSampleZ.GetDest() = V.Z;
-		SampleIndexParam.Advance();
-		OutSampleX.Advance();
-		OutSampleY.Advance();
-		OutSampleZ.Advance();
-    }
+		Reader.Read();
+		Reader.WriteVector(OutSampleX, OutSampleY, OutSampleZ);
+	}
 }
 
 void UNiagaraDataInterfaceHoudini::GetNormal(FVectorVMExternalFunctionContext& Context)
@@ -1638,22 +1836,20 @@ void UNiagaraDataInterfaceHoudini::GetNormal(FVectorVMExternalFunctionContext& C
     VectorVM::FExternalFuncRegisterHandler<float> OutSampleY(Context);
     VectorVM::FExternalFuncRegisterHandler<float> OutSampleZ(Context);
 
-    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-    {
-		int32 SampleIndex = SampleIndexParam.Get();
+	const int32 AttrIndex = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetAttributeAttributeIndex(EHoudiniAttributes::NORMAL) : INDEX_NONE;
 
-		FVector V = FVector::ZeroVector;
-		if ( HoudiniPointCacheAsset )
-			HoudiniPointCacheAsset->GetNormalValue( SampleIndex, V );
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 3);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			Reader.SetSample(i, SampleIndexParam.GetAndAdvance(), AttrIndex, true, false);
+		}
 
-		*OutSampleX.GetDest() = V.X;
-		*OutSampleY.GetDest() = V.Y;
-		*OutSampleZ.GetDest() = V.Z;
-		SampleIndexParam.Advance();
-		OutSampleX.Advance();
-		OutSampleY.Advance();
-		OutSampleZ.Advance();
-    }
+		Reader.Read();
+		Reader.WriteVector(OutSampleX, OutSampleY, OutSampleZ);
+	}
 }
 
 void UNiagaraDataInterfaceHoudini::GetTime(FVectorVMExternalFunctionContext& Context)
@@ -1662,18 +1858,20 @@ void UNiagaraDataInterfaceHoudini::GetTime(FVectorVMExternalFunctionContext& Con
 
     VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
 
-    for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-    {
-		int32 SampleIndex = SampleIndexParam.Get();
+	const int32 AttrIndex = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetAttributeAttributeIndex(EHoudiniAttributes::TIME) : INDEX_NONE;
 
-		float value = 0.0f;
-		if ( HoudiniPointCacheAsset )
-			HoudiniPointCacheAsset->GetTimeValue( SampleIndex, value );
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 1);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			Reader.SetSample(i, SampleIndexParam.GetAndAdvance(), AttrIndex);
+		}
 
-		*OutValue.GetDest() = value;
-		SampleIndexParam.Advance();
-		OutValue.Advance();
-    }
+		Reader.Read();
+		Reader.WriteFloat(OutValue);
+	}
 }
 
 void UNiagaraDataInterfaceHoudini::GetVelocity(FVectorVMExternalFunctionContext& Context)
@@ -1684,21 +1882,19 @@ void UNiagaraDataInterfaceHoudini::GetVelocity(FVectorVMExternalFunctionContext&
 	VectorVM::FExternalFuncRegisterHandler<float> OutSampleY(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutSampleZ(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 SampleIndex = SampleIndexParam.Get();
+	const int32 AttrIndex = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetAttributeAttributeIndex(EHoudiniAttributes::VELOCITY) : INDEX_NONE;
 
-		FVector V = FVector::ZeroVector;
-		if ( HoudiniPointCacheAsset )
-			HoudiniPointCacheAsset->GetVelocityValue( SampleIndex, V );
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 3);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			Reader.SetSample(i, SampleIndexParam.GetAndAdvance(), AttrIndex, true, false);
+		}
 
-		*OutSampleX.GetDest() = V.X;
-		*OutSampleY.GetDest() = V.Y;
-		*OutSampleZ.GetDest() = V.Z;
-		SampleIndexParam.Advance();
-		OutSampleX.Advance();
-		OutSampleY.Advance();
-		OutSampleZ.Advance();
+		Reader.Read();
+		Reader.WriteVector(OutSampleX, OutSampleY, OutSampleZ);
 	}
 }
 
@@ -1737,17 +1933,19 @@ void UNiagaraDataInterfaceHoudini::GetImpulse(FVectorVMExternalFunctionContext&
 
 	VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 SampleIndex = SampleIndexParam.Get();
+	const int32 AttrIndex = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetAttributeAttributeIndex(EHoudiniAttributes::IMPULSE) : INDEX_NONE;
 
-		float value = 0.0f;
-		if (HoudiniPointCacheAsset)
-			HoudiniPointCacheAsset->GetImpulseValue(SampleIndex, value);
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 1);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			Reader.SetSample(i, SampleIndexParam.GetAndAdvance(), AttrIndex);
+		}
 
-		*OutValue.GetDest() = value;
-		SampleIndexParam.Advance();
-		OutValue.Advance();
+		Reader.Read();
+		Reader.WriteFloat(OutValue);
 	}
 }
 
@@ -1788,9 +1986,11 @@ void UNiagaraDataInterfaceHoudini::GetPointIDsToSpawnAtTime(FVectorVMExternalFun
 	VectorVM::FExternalFuncRegisterHandler<float> OutLastSpawnTimeRequestValue( Context );
 	VectorVM::FExternalFuncRegisterHandler<int32> OutLastSpawnedPointIDValue( Context );
 
+	float LatestTime = -FLT_MAX;
     for (int32 i = 0; i < Context.GetNumInstances(); ++i)
     {
 		float t = TimeParam.Get();
+		LatestTime = FMath::Max(LatestTime, t);
 		float LastSpawnTime = LastSpawnTimeParam.Get();
 		float LastSpawnTimeRequest = LastSpawnTimeRequestParam.Get();
 		int32 LastSpawnedPointID = LastSpawnedPointIDParam.Get();
@@ -1831,6 +2031,11 @@ void UNiagaraDataInterfaceHoudini::GetPointIDsToSpawnAtTime(FVectorVMExternalFun
 		OutLastSpawnTimeRequestValue.Advance();
 		OutLastSpawnedPointIDValue.Advance();
     }
+
+	// Spawning is always evaluated on the CPU, even for GPU emitters:
+	// use it to move the GPU sample window of streamed point caches along with the emitter's time
+	if ( HoudiniPointCacheAsset && HoudiniPointCacheAsset->IsStreamingSamples() && Context.GetNumInstances() > 0 )
+		HoudiniPointCacheAsset->RequestStreamingWindowUpdate(LatestTime);
 }
 
 void UNiagaraDataInterfaceHoudini::GetPositionAndTime(FVectorVMExternalFunctionContext& Context)
@@ -1877,6 +2082,8 @@ void UNiagaraDataInterfaceHoudini::GetSampleIndexesForPointAtTime(FVectorVMExter
 	VectorVM::FExternalFuncRegisterHandler<int32> OutNextIndex(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutWeightValue(Context);
 
+	FHoudiniScopedPlaybackCursor PlaybackCursor(PlaybackCursorLock, PointCacheCursor);
+
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
     {
 		int32 PointID = PointIDParam.Get();
@@ -1885,9 +2092,12 @@ void UNiagaraDataInterfaceHoudini::GetSampleIndexesForPointAtTime(FVectorVMExter
 		float weight = 0.0f;
 		int32 prevIdx = 0;
 		int32 nextIdx = 0;
-		if ( HoudiniPointCacheAsset )
+		FHoudiniPointSampleBlend Blend;
+		if ( HoudiniPointCacheAsset && HoudiniPointCacheAsset->GetSampleBlendForPointAtTime( PointID, time, Blend, PlaybackCursor.Get() ) )
 		{
-			HoudiniPointCacheAsset->GetSampleIndexesForPointAtTime( PointID, time, prevIdx, nextIdx, weight );
+			prevIdx = Blend.PrevSampleIndex;
+			nextIdx = Blend.NextSampleIndex;
+			weight = Blend.PrevWeight;
 		}
 
 		*OutPrevIndex.GetDest() = prevIdx;
@@ -1911,27 +2121,29 @@ void UNiagaraDataInterfaceHoudini::GetPointPositionAtTime(FVectorVMExternalFunct
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-    {
-		int32 PointID = PointIDParam.Get();
-		float time = TimeParam.Get();
+	const int32 AttrIndex = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetAttributeAttributeIndex(EHoudiniAttributes::POSITION) : INDEX_NONE;
 
-		FVector posVector = FVector::ZeroVector;
-		if ( HoudiniPointCacheAsset )
+	FHoudiniScopedPlaybackCursor PlaybackCursor(PlaybackCursorLock, PointCacheCursor);
+
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 3);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
 		{
-			HoudiniPointCacheAsset->GetPointPositionAtTime(PointID, time, posVector);
-		}		
+			const int32 PointID = PointIDParam.GetAndAdvance();
+			const float Time = TimeParam.GetAndAdvance();
 
-		*OutPosX.GetDest() = posVector.X;
-		*OutPosY.GetDest() = posVector.Y;
-		*OutPosZ.GetDest() = posVector.Z;
+			FHoudiniPointSampleBlend Blend;
+			if (HoudiniPointCacheAsset && HoudiniPointCacheAsset->GetSampleBlendForPointAtTime(PointID, Time, Blend, PlaybackCursor.Get()))
+				Reader.SetSampleBlend(i, Blend, AttrIndex, true, true);
+			else
+				Reader.SetSample(i, INDEX_NONE, INDEX_NONE);
+		}
 
-		PointIDParam.Advance();
-		TimeParam.Advance();
-		OutPosX.Advance();
-		OutPosY.Advance();
-		OutPosZ.Advance();
-    }
+		Reader.Read();
+		Reader.WriteVector(OutPosX, OutPosY, OutPosZ);
+	}
 }
 
 void UNiagaraDataInterfaceHoudini::GetPointValueAtTime(FVectorVMExternalFunctionContext& Context)
@@ -1942,25 +2154,27 @@ void UNiagaraDataInterfaceHoudini::GetPointValueAtTime(FVectorVMExternalFunction
 
 	VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 PointID = PointIDParam.Get();
-		int32 AttrIndex = AttributeIndexParam.Get();
-		float time = TimeParam.Get();		
+	FHoudiniScopedPlaybackCursor PlaybackCursor(PlaybackCursorLock, PointCacheCursor);
 
-		float Value = 0.0f;
-		if ( HoudiniPointCacheAsset )
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 1);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
 		{
-			HoudiniPointCacheAsset->GetPointValueAtTime( PointID, AttrIndex, time, Value );
-		}
-
-		*OutValue.GetDest() = Value;
+			const int32 PointID = PointIDParam.GetAndAdvance();
+			const float Time = TimeParam.GetAndAdvance();
+			const int32 AttributeIndex = AttributeIndexParam.GetAndAdvance();
 
-		PointIDParam.Advance();
-		AttributeIndexParam.Advance();
-		TimeParam.Advance();
+			FHoudiniPointSampleBlend Blend;
+			if (HoudiniPointCacheAsset && HoudiniPointCacheAsset->GetSampleBlendForPointAtTime(PointID, Time, Blend, PlaybackCursor.Get()))
+				Reader.SetSampleBlend(i, Blend, AttributeIndex);
+			else
+				Reader.SetSample(i, INDEX_NONE, INDEX_NONE);
+		}
 
-		OutValue.Advance();
+		Reader.Read();
+		Reader.WriteFloat(OutValue);
 	}
 }
 
@@ -1971,23 +2185,30 @@ void UNiagaraDataInterfaceHoudini::GetPointValueAtTimeByString(FVectorVMExternal
 
 	VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 PointID = PointIDParam.Get();
-		float time = TimeParam.Get();
+	int32 AttrIndex = INDEX_NONE;
+	if (HoudiniPointCacheAsset)
+		HoudiniPointCacheAsset->GetAttributeIndexFromString(Attribute, AttrIndex);
 
-		float Value = 0.0f;
-		if (HoudiniPointCacheAsset)
-		{
-			HoudiniPointCacheAsset->GetPointValueAtTimeForString(PointID, Attribute, time, Value);
-		}
+	FHoudiniScopedPlaybackCursor PlaybackCursor(PlaybackCursorLock, PointCacheCursor);
 
-		*OutValue.GetDest() = Value;
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 1);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			const int32 PointID = PointIDParam.GetAndAdvance();
+			const float Time = TimeParam.GetAndAdvance();
 
-		PointIDParam.Advance();
-		TimeParam.Advance();
+			FHoudiniPointSampleBlend Blend;
+			if (HoudiniPointCacheAsset && HoudiniPointCacheAsset->GetSampleBlendForPointAtTime(PointID, Time, Blend, PlaybackCursor.Get()))
+				Reader.SetSampleBlend(i, Blend, AttrIndex);
+			else
+				Reader.SetSample(i, INDEX_NONE, INDEX_NONE);
+		}
 
-		OutValue.Advance();
+		Reader.Read();
+		Reader.WriteFloat(OutValue);
 	}
 }
 
@@ -2001,29 +2222,27 @@ void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTime(FVectorVMExternalFu
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 PointID = PointIDParam.Get();
-		int32 AttrIndex = AttributeIndexParam.Get();
-		float time = TimeParam.Get();		
+	FHoudiniScopedPlaybackCursor PlaybackCursor(PlaybackCursorLock, PointCacheCursor);
 
-		FVector posVector = FVector::ZeroVector;
-		if ( HoudiniPointCacheAsset )
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 3);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
 		{
-			HoudiniPointCacheAsset->GetPointVectorValueAtTime( PointID, AttrIndex, time, posVector, true, true);
-		}
+			const int32 PointID = PointIDParam.GetAndAdvance();
+			const int32 AttributeIndex = AttributeIndexParam.GetAndAdvance();
+			const float Time = TimeParam.GetAndAdvance();
 
-		*OutPosX.GetDest() = posVector.X;
-		*OutPosY.GetDest() = posVector.Y;
-		*OutPosZ.GetDest() = posVector.Z;
+			FHoudiniPointSampleBlend Blend;
+			if (HoudiniPointCacheAsset && HoudiniPointCacheAsset->GetSampleBlendForPointAtTime(PointID, Time, Blend, PlaybackCursor.Get()))
+				Reader.SetSampleBlend(i, Blend, AttributeIndex, true, true);
+			else
+				Reader.SetSample(i, INDEX_NONE, INDEX_NONE);
+		}
 
-		PointIDParam.Advance();
-		AttributeIndexParam.Advance();
-		TimeParam.Advance();
-		
-		OutPosX.Advance();
-		OutPosY.Advance();
-		OutPosZ.Advance();
+		Reader.Read();
+		Reader.WriteVector(OutPosX, OutPosY, OutPosZ);
 	}
 }
 
@@ -2036,27 +2255,30 @@ void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeByString(FVectorVMEx
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 PointID = PointIDParam.Get();
-		float time = TimeParam.Get();
+	int32 AttrIndex = INDEX_NONE;
+	if (HoudiniPointCacheAsset)
+		HoudiniPointCacheAsset->GetAttributeIndexFromString(Attribute, AttrIndex);
 
-		FVector posVector = FVector::ZeroVector;
-		if (HoudiniPointCacheAsset)
-		{
-			HoudiniPointCacheAsset->GetPointVectorValueAtTimeForString(PointID, Attribute, time, posVector, true, true);
-		}
+	FHoudiniScopedPlaybackCursor PlaybackCursor(PlaybackCursorLock, PointCacheCursor);
 
-		*OutPosX.GetDest() = posVector.X;
-		*OutPosY.GetDest() = posVector.Y;
-		*OutPosZ.GetDest() = posVector.Z;
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 3);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			const int32 PointID = PointIDParam.GetAndAdvance();
+			const float Time = TimeParam.GetAndAdvance();
 
-		PointIDParam.Advance();
-		TimeParam.Advance();
+			FHoudiniPointSampleBlend Blend;
+			if (HoudiniPointCacheAsset && HoudiniPointCacheAsset->GetSampleBlendForPointAtTime(PointID, Time, Blend, PlaybackCursor.Get()))
+				Reader.SetSampleBlend(i, Blend, AttrIndex, true, true);
+			else
+				Reader.SetSample(i, INDEX_NONE, INDEX_NONE);
+		}
 
-		OutPosX.Advance();
-		OutPosY.Advance();
-		OutPosZ.Advance();
+		Reader.Read();
+		Reader.WriteVector(OutPosX, OutPosY, OutPosZ);
 	}
 }
 
@@ -2072,34 +2294,29 @@ void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeEx(FVectorVMExternal
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 PointID = PointIDParam.Get();
-		int32 AttrIndex = AttributeIndexParam.Get();
-		float time = TimeParam.Get();
-
-		bool DoSwap = DoSwapParam.Get().GetValue();
-		bool DoScale = DoScaleParam.Get().GetValue();
+	FHoudiniScopedPlaybackCursor PlaybackCursor(PlaybackCursorLock, PointCacheCursor);
 
-		FVector posVector = FVector::ZeroVector;
-		if (HoudiniPointCacheAsset)
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 3);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
 		{
-			HoudiniPointCacheAsset->GetPointVectorValueAtTime(PointID, AttrIndex, time, posVector, DoSwap, DoScale);
+			const int32 PointID = PointIDParam.GetAndAdvance();
+			const int32 AttributeIndex = AttributeIndexParam.GetAndAdvance();
+			const float Time = TimeParam.GetAndAdvance();
+			const bool DoSwap = DoSwapParam.GetAndAdvance().GetValue();
+			const bool DoScale = DoScaleParam.GetAndAdvance().GetValue();
+
+			FHoudiniPointSampleBlend Blend;
+			if (HoudiniPointCacheAsset && HoudiniPointCacheAsset->GetSampleBlendForPointAtTime(PointID, Time, Blend, PlaybackCursor.Get()))
+				Reader.SetSampleBlend(i, Blend, AttributeIndex, DoSwap, DoScale);
+			else
+				Reader.SetSample(i, INDEX_NONE, INDEX_NONE);
 		}
 
-		*OutPosX.GetDest() = posVector.X;
-		*OutPosY.GetDest() = posVector.Y;
-		*OutPosZ.GetDest() = posVector.Z;
-
-		PointIDParam.Advance();
-		AttributeIndexParam.Advance();
-		TimeParam.Advance();
-		DoSwapParam.Advance();
-		DoScaleParam.Advance();
-
-		OutPosX.Advance();
-		OutPosY.Advance();
-		OutPosZ.Advance();
+		Reader.Read();
+		Reader.WriteVector(OutPosX, OutPosY, OutPosZ);
 	}
 }
 
@@ -2114,32 +2331,32 @@ void UNiagaraDataInterfaceHoudini::GetPointVectorValueAtTimeExByString(FVectorVM
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosY(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 PointID = PointIDParam.Get();
-		float time = TimeParam.Get();
+	int32 AttrIndex = INDEX_NONE;
+	if (HoudiniPointCacheAsset)
+		HoudiniPointCacheAsset->GetAttributeIndexFromString(Attribute, AttrIndex);
 
-		bool DoSwap = DoSwapParam.Get().GetValue();
-		bool DoScale = DoScaleParam.Get().GetValue();
+	FHoudiniScopedPlaybackCursor PlaybackCursor(PlaybackCursorLock, PointCacheCursor);
 
-		FVector posVector = FVector::ZeroVector;
-		if (HoudiniPointCacheAsset)
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 3);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
 		{
-			HoudiniPointCacheAsset->GetPointVectorValueAtTimeForString(PointID, Attribute, time, posVector, DoSwap, DoScale);
+			const int32 PointID = PointIDParam.GetAndAdvance();
+			const float Time = TimeParam.GetAndAdvance();
+			const bool DoSwap = DoSwapParam.GetAndAdvance().GetValue();
+			const bool DoScale = DoScaleParam.GetAndAdvance().GetValue();
+
+			FHoudiniPointSampleBlend Blend;
+			if (HoudiniPointCacheAsset && HoudiniPointCacheAsset->GetSampleBlendForPointAtTime(PointID, Time, Blend, PlaybackCursor.Get()))
+				Reader.SetSampleBlend(i, Blend, AttrIndex, DoSwap, DoScale);
+			else
+				Reader.SetSample(i, INDEX_NONE, INDEX_NONE);
 		}
 
-		*OutPosX.GetDest() = posVector.X;
-		*OutPosY.GetDest() = posVector.Y;
-		*OutPosZ.GetDest() = posVector.Z;
-
-		PointIDParam.Advance();
-		TimeParam.Advance();
-		DoSwapParam.Advance();
-		DoScaleParam.Advance();
-
-		OutPosX.Advance();
-		OutPosY.Advance();
-		OutPosZ.Advance();
+		Reader.Read();
+		Reader.WriteVector(OutPosX, OutPosY, OutPosZ);
 	}
 }
 
@@ -2154,31 +2371,27 @@ void UNiagaraDataInterfaceHoudini::GetPointVector4ValueAtTime(FVectorVMExternalF
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosW(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 PointID = PointIDParam.Get();
-		int32 AttrIndex = AttributeIndexParam.Get();
-		float time = TimeParam.Get();		
+	FHoudiniScopedPlaybackCursor PlaybackCursor(PlaybackCursorLock, PointCacheCursor);
 
-		FVector4 posVector(FVector::ZeroVector, 0);
-		if ( HoudiniPointCacheAsset )
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 4);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
 		{
-			HoudiniPointCacheAsset->GetPointVector4ValueAtTime( PointID, AttrIndex, time, posVector);
-		}
+			const int32 PointID = PointIDParam.GetAndAdvance();
+			const int32 AttributeIndex = AttributeIndexParam.GetAndAdvance();
+			const float Time = TimeParam.GetAndAdvance();
 
-		*OutPosX.GetDest() = posVector.X;
-		*OutPosY.GetDest() = posVector.Y;
-		*OutPosZ.GetDest() = posVector.Z;
-		*OutPosW.GetDest() = posVector.W;
+			FHoudiniPointSampleBlend Blend;
+			if (HoudiniPointCacheAsset && HoudiniPointCacheAsset->GetSampleBlendForPointAtTime(PointID, Time, Blend, PlaybackCursor.Get()))
+				Reader.SetSampleBlend(i, Blend, AttributeIndex);
+			else
+				Reader.SetSample(i, INDEX_NONE, INDEX_NONE);
+		}
 
-		PointIDParam.Advance();
-		AttributeIndexParam.Advance();
-		TimeParam.Advance();
-		
-		OutPosX.Advance();
-		OutPosY.Advance();
-		OutPosZ.Advance();
-		OutPosW.Advance();
+		Reader.Read();
+		Reader.WriteVector4(OutPosX, OutPosY, OutPosZ, OutPosW);
 	}
 }
 
@@ -2192,29 +2405,30 @@ void UNiagaraDataInterfaceHoudini::GetPointVector4ValueAtTimeByString(FVectorVME
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosW(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 PointID = PointIDParam.Get();
-		float time = TimeParam.Get();
+	int32 AttrIndex = INDEX_NONE;
+	if (HoudiniPointCacheAsset)
+		HoudiniPointCacheAsset->GetAttributeIndexFromString(Attribute, AttrIndex);
 
-		FVector4 posVector(FVector::ZeroVector, 0);
-		if (HoudiniPointCacheAsset)
-		{
-			HoudiniPointCacheAsset->GetPointVector4ValueAtTimeForString(PointID, Attribute, time, posVector);
-		}
+	FHoudiniScopedPlaybackCursor PlaybackCursor(PlaybackCursorLock, PointCacheCursor);
 
-		*OutPosX.GetDest() = posVector.X;
-		*OutPosY.GetDest() = posVector.Y;
-		*OutPosZ.GetDest() = posVector.Z;
-		*OutPosW.GetDest() = posVector.W;
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 4);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
+		{
+			const int32 PointID = PointIDParam.GetAndAdvance();
+			const float Time = TimeParam.GetAndAdvance();
 
-		PointIDParam.Advance();
-		TimeParam.Advance();
+			FHoudiniPointSampleBlend Blend;
+			if (HoudiniPointCacheAsset && HoudiniPointCacheAsset->GetSampleBlendForPointAtTime(PointID, Time, Blend, PlaybackCursor.Get()))
+				Reader.SetSampleBlend(i, Blend, AttrIndex);
+			else
+				Reader.SetSample(i, INDEX_NONE, INDEX_NONE);
+		}
 
-		OutPosX.Advance();
-		OutPosY.Advance();
-		OutPosZ.Advance();
-		OutPosW.Advance();
+		Reader.Read();
+		Reader.WriteVector4(OutPosX, OutPosY, OutPosZ, OutPosW);
 	}
 }
 
@@ -2230,6 +2444,8 @@ void UNiagaraDataInterfaceHoudini::GetPointQuatValueAtTime(FVectorVMExternalFunc
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosW(Context);
 
+	FHoudiniScopedPlaybackCursor PlaybackCursor(PlaybackCursorLock, PointCacheCursor);
+
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
 		int32 PointID = PointIDParam.Get();
@@ -2239,9 +2455,10 @@ void UNiagaraDataInterfaceHoudini::GetPointQuatValueAtTime(FVectorVMExternalFunc
 		bool DoHoudiniToUnrealConversion = DoHoudiniToUnrealConversionParam.Get().GetValue();
 
 		FQuat Q(0, 0, 0, 0);
-		if (HoudiniPointCacheAsset)
+		FHoudiniPointSampleBlend Blend;
+		if (HoudiniPointCacheAsset && HoudiniPointCacheAsset->GetSampleBlendForPointAtTime(PointID, time, Blend, PlaybackCursor.Get()))
 		{
-			HoudiniPointCacheAsset->GetPointQuatValueAtTime(PointID, AttrIndex, time, Q, DoHoudiniToUnrealConversion);
+			HoudiniPointCacheAsset->GetQuatValueForBlend(Blend, AttrIndex, Q, DoHoudiniToUnrealConversion);
 		}
 
 		*OutPosX.GetDest() = Q.X;
@@ -2272,6 +2489,12 @@ void UNiagaraDataInterfaceHoudini::GetPointQuatValueAtTimeByString(FVectorVMExte
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosZ(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutPosW(Context);
 
+	int32 AttrIndex = INDEX_NONE;
+	if (HoudiniPointCacheAsset)
+		HoudiniPointCacheAsset->GetAttributeIndexFromString(Attribute, AttrIndex);
+
+	FHoudiniScopedPlaybackCursor PlaybackCursor(PlaybackCursorLock, PointCacheCursor);
+
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
 		int32 PointID = PointIDParam.Get();
@@ -2280,9 +2503,10 @@ void UNiagaraDataInterfaceHoudini::GetPointQuatValueAtTimeByString(FVectorVMExte
 		bool DoHoudiniToUnrealConversion = DoHoudiniToUnrealConversionParam.Get().GetValue();
 
 		FQuat Q(0, 0, 0, 0);
-		if (HoudiniPointCacheAsset)
+		FHoudiniPointSampleBlend Blend;
+		if (HoudiniPointCacheAsset && HoudiniPointCacheAsset->GetSampleBlendForPointAtTime(PointID, time, Blend, PlaybackCursor.Get()))
 		{
-			HoudiniPointCacheAsset->GetPointQuatValueAtTimeForString(PointID, Attribute, time, Q, DoHoudiniToUnrealConversion);
+			HoudiniPointCacheAsset->GetQuatValueForBlend(Blend, AttrIndex, Q, DoHoudiniToUnrealConversion);
 		}
 
 		*OutPosX.GetDest() = Q.X;
@@ -2386,27 +2610,28 @@ void UNiagaraDataInterfaceHoudini::GetPointGenericVectorAttributeAtTime(EHoudini
 	VectorVM::FExternalFuncRegisterHandler<float> OutVecY(Context);
 	VectorVM::FExternalFuncRegisterHandler<float> OutVecZ(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 PointID = PointIDParam.Get();
-		float Time = TimeParam.Get();
+	const int32 AttrIndex = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetAttributeAttributeIndex(Attribute) : INDEX_NONE;
 
-		FVector VectorValue = FVector::ZeroVector;
-		if ( HoudiniPointCacheAsset )
+	FHoudiniScopedPlaybackCursor PlaybackCursor(PlaybackCursorLock, PointCacheCursor);
+
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 3);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
 		{
-			int32 AttrIndex = HoudiniPointCacheAsset->GetAttributeAttributeIndex(Attribute);
-			HoudiniPointCacheAsset->GetPointVectorValueAtTime(PointID, AttrIndex, Time, VectorValue, DoSwap, DoScale);
-		}
+			const int32 PointID = PointIDParam.GetAndAdvance();
+			const float Time = TimeParam.GetAndAdvance();
 
-		*OutVecX.GetDest() = VectorValue.X;
-		*OutVecY.GetDest() = VectorValue.Y;
-		*OutVecZ.GetDest() = VectorValue.Z;
+			FHoudiniPointSampleBlend Blend;
+			if (HoudiniPointCacheAsset && HoudiniPointCacheAsset->GetSampleBlendForPointAtTime(PointID, Time, Blend, PlaybackCursor.Get()))
+				Reader.SetSampleBlend(i, Blend, AttrIndex, DoSwap, DoScale);
+			else
+				Reader.SetSample(i, INDEX_NONE, INDEX_NONE);
+		}
 
-		PointIDParam.Advance();
-		TimeParam.Advance();
-		OutVecX.Advance();
-		OutVecY.Advance();
-		OutVecZ.Advance();
+		Reader.Read();
+		Reader.WriteVector(OutVecX, OutVecY, OutVecZ);
 	}
 }
 
@@ -2417,23 +2642,28 @@ void UNiagaraDataInterfaceHoudini::GetPointGenericFloatAttributeAtTime(EHoudiniA
 
 	VectorVM::FExternalFuncRegisterHandler<float> OutValue(Context);
 
-	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
-	{
-		int32 PointID = PointIDParam.Get();
-		float Time = TimeParam.Get();
+	const int32 AttrIndex = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetAttributeAttributeIndex(Attribute) : INDEX_NONE;
 
-		float Value = 0.0f;
-		if ( HoudiniPointCacheAsset )
+	FHoudiniScopedPlaybackCursor PlaybackCursor(PlaybackCursorLock, PointCacheCursor);
+
+	FHoudiniPointCacheBlockReader Reader(HoudiniPointCacheAsset, 1);
+	for (int32 BlockStart = 0; BlockStart < Context.GetNumInstances(); BlockStart += FHoudiniPointCacheBlockReader::BlockSize)
+	{
+		const int32 NumInBlock = Reader.BeginBlock(Context.GetNumInstances() - BlockStart);
+		for (int32 i = 0; i < NumInBlock; ++i)
 		{
-			int32 AttrIndex = HoudiniPointCacheAsset->GetAttributeAttributeIndex(Attribute);
-			HoudiniPointCacheAsset->GetPointFloatValueAtTime(PointID, AttrIndex, Time, Value);
-		}
+			const int32 PointID = PointIDParam.GetAndAdvance();
+			const float Time = TimeParam.GetAndAdvance();
 
-		*OutValue.GetDest() = Value;
+			FHoudiniPointSampleBlend Blend;
+			if (HoudiniPointCacheAsset && HoudiniPointCacheAsset->GetSampleBlendForPointAtTime(PointID, Time, Blend, PlaybackCursor.Get()))
+				Reader.SetSampleBlend(i, Blend, AttrIndex);
+			else
+				Reader.SetSample(i, INDEX_NONE, INDEX_NONE);
+		}
 
-		PointIDParam.Advance();
-		TimeParam.Advance();
-		OutValue.Advance();
+		Reader.Read();
+		Reader.WriteFloat(OutValue);
 	}
 }
 
@@ -2444,16 +2674,20 @@ void UNiagaraDataInterfaceHoudini::GetPointGenericInt32AttributeAtTime(EHoudiniA
 
 	VectorVM::FExternalFuncRegisterHandler<int32> OutValue(Context);
 
+	const int32 AttrIndex = HoudiniPointCacheAsset ? HoudiniPointCacheAsset->GetAttributeAttributeIndex(Attribute) : INDEX_NONE;
+
+	FHoudiniScopedPlaybackCursor PlaybackCursor(PlaybackCursorLock, PointCacheCursor);
+
 	for (int32 i = 0; i < Context.GetNumInstances(); ++i)
 	{
 		int32 PointID = PointIDParam.Get();
 		float Time = TimeParam.Get();
 
 		int32 Value = 0.0f;
-		if ( HoudiniPointCacheAsset )
+		FHoudiniPointSampleBlend Blend;
+		if (HoudiniPointCacheAsset && HoudiniPointCacheAsset->GetSampleBlendForPointAtTime(PointID, Time, Blend, PlaybackCursor.Get()))
 		{
-			int32 AttrIndex = HoudiniPointCacheAsset->GetAttributeAttributeIndex(Attribute);
-			HoudiniPointCacheAsset->GetPointInt32ValueAtTime(PointID, AttrIndex, Time, Value);
+			HoudiniPointCacheAsset->GetInt32ValueForBlend(Blend, AttrIndex, Value);
 		}
 
 		*OutValue.GetDest() = Value;
@@ -2652,6 +2886,8 @@ void UNiagaraDataInterfaceHoudini::SetShaderParameters(const FNiagaraDataInterfa
 	if (FHoudiniPointCacheResource* Resource = DIProxy.Resource)
 	{
 		ShaderParameters->NumberOfSamples = Resource->NumSamples;
+		ShaderParameters->SampleWindowStart = Resource->SampleWindowStart;
+		ShaderParameters->SampleWindowStride = Resource->SampleWindowStride;
 		ShaderParameters->NumberOfAttributes = Resource->NumAttributes;
 		ShaderParameters->NumberOfPoints = Resource->NumPoints;
 		ShaderParameters->MaxNumberOfIndexesPerPoint = Resource->MaxNumberOfIndexesPerPoint;
@@ -2680,6 +2916,8 @@ void UNiagaraDataInterfaceHoudini::SetShaderParameters(const FNiagaraDataInterfa
 	else
 	{
 		ShaderParameters->NumberOfSamples = 0;
+		ShaderParameters->SampleWindowStart = 0;
+		ShaderParameters->SampleWindowStride = 0;
 		ShaderParameters->NumberOfAttributes = 0;
 		ShaderParameters->NumberOfPoints = 0;
 		ShaderParameters->MaxNumberOfIndexesPerPoint = 0;
@@ -2743,6 +2981,8 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 		FString MaxNumberOfIndexesPerPointVar = MaxNumberOfIndexesPerPointBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 		FString PointValueIndexesBuffer = PointValueIndexesBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 		FString FunctionIndexToAttributeIndexBuffer = FunctionIndexToAttributeIndexBufferBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString SampleWindowStartVar = SampleWindowStartBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+		FString SampleWindowStrideVar = SampleWindowStrideBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 #else
 		FString NumberOfSamplesVar = ParamInfo.DataInterfaceHLSLSymbol + NumberOfSamplesBaseName;
 		FString NumberOfAttributesVar = ParamInfo.DataInterfaceHLSLSymbol + NumberOfAttributesBaseName;
@@ -2755,16 +2995,21 @@ const FTypeLayoutDesc* UNiagaraDataInterfaceHoudini::GetShaderStorageType() cons
 		FString MaxNumberOfIndexesPerPointVar = ParamInfo.DataInterfaceHLSLSymbol + MaxNumberOfIndexesPerPointBaseName;
 		FString PointValueIndexesBuffer = ParamInfo.DataInterfaceHLSLSymbol + PointValueIndexesBufferBaseName;
 		FString FunctionIndexToAttributeIndexBuffer = ParamInfo.DataInterfaceHLSLSymbol + FunctionIndexToAttributeIndexBufferBaseName;
+		FString SampleWindowStartVar = ParamInfo.DataInterfaceHLSLSymbol + SampleWindowStartBaseName;
+		FString SampleWindowStrideVar = ParamInfo.DataInterfaceHLSLSymbol + SampleWindowStrideBaseName;
 #endif
 
 
 // Build the shader function HLSL Code.
 
 	// Lambda returning the HLSL code used for reading a Float value in the FloatBuffer
+	// The buffer holds the samples [SampleWindowStart, SampleWindowStart + SampleWindowStride) of each attribute,
+	// which is the whole point cache unless it is streamed. Samples outside of the window read the closest sample in the window.
 	auto ReadFloatInBuffer = [&](const FString& OutFloatValue, const FString& FloatSampleIndex, const FString& FloatAttrIndex)
 	{
-		// \t OutValue = FloatBufferName[ (SampleIndex) + ( (AttrIndex) * (NumberOfSamplesName) ) ];\n
-		return TEXT("\t ") + OutFloatValue + TEXT(" = ") + FloatBufferVar + TEXT("[ (") + FloatSampleIndex + TEXT(") + ( (") + FloatAttrIndex + TEXT(") * (") + NumberOfSamplesVar + TEXT(") ) ];\n");
+		// \t OutValue = FloatBufferName[ clamp( (SampleIndex) - SampleWindowStartName, 0, SampleWindowStrideName - 1 ) + ( (AttrIndex) * SampleWindowStrideName ) ];\n
+		return TEXT("\t ") + OutFloatValue + TEXT(" = ") + FloatBufferVar + TEXT("[ clamp( (") + FloatSampleIndex + TEXT(") - ") + SampleWindowStartVar + TEXT(", 0, ") + SampleWindowStrideVar
+			+ TEXT(" - 1 ) + ( (") + FloatAttrIndex + TEXT(") * ") + SampleWindowStrideVar + TEXT(" ) ];\n");
 	};
 
 	// Lambda returning the HLSL code for reading a Vector value in the FloatBuffer
@@ -3780,6 +4025,14 @@ void UNiagaraDataInterfaceHoudini::GetParameterDefinitionHLSL(const FNiagaraData
 	FString BufferName = UNiagaraDataInterfaceHoudini::NumberOfSamplesBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
 
+	// int SampleWindowStart_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::SampleWindowStartBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// int SampleWindowStride_XX;
+	BufferName = UNiagaraDataInterfaceHoudini::SampleWindowStrideBaseName + ParamInfo.DataInterfaceHLSLSymbol;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
 	// int NumberOfAttributes_XX;
 	BufferName = UNiagaraDataInterfaceHoudini::NumberOfAttributesBaseName + ParamInfo.DataInterfaceHLSLSymbol;
 	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
@@ -3854,6 +4107,14 @@ void UNiagaraDataInterfaceHoudini::GetParameterDefinitionHLSL(const FNiagaraData
 	FString BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::NumberOfSamplesBaseName;
 	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
 
+	// int SampleWindowStart_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::SampleWindowStartBaseName;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
+	// int SampleWindowStride_XX;
+	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::SampleWindowStrideBaseName;
+	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
+
 	// int NumberOfAttributes_XX;
 	BufferName = ParamInfo.DataInterfaceHLSLSymbol + UNiagaraDataInterfaceHoudini::NumberOfAttributesBaseName;
 	OutHLSL += TEXT("int ") + BufferName + TEXT(";\n");
@@ -4179,6 +4440,8 @@ public:
 	void Bind(const FNiagaraDataInterfaceGPUParamInfo& ParameterInfo, const class FShaderParameterMap& ParameterMap)
 	{
 		NumberOfSamples.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::NumberOfSamplesBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		SampleWindowStart.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::SampleWindowStartBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
+		SampleWindowStride.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::SampleWindowStrideBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
 		NumberOfAttributes.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::NumberOfAttributesBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
 		NumberOfPoints.Bind(ParameterMap, *(UNiagaraDataInterfaceHoudini::NumberOfPointsBaseName + ParameterInfo.DataInterfaceHLSLSymbol));
 		
@@ -4232,6 +4495,8 @@ public:
 		}
 
 		SetShaderValue(RHICmdList, ComputeShaderRHI, NumberOfSamples, Resource->NumSamples);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, SampleWindowStart, Resource->SampleWindowStart);
+		SetShaderValue(RHICmdList, ComputeShaderRHI, SampleWindowStride, Resource->SampleWindowStride);
 		SetShaderValue(RHICmdList, ComputeShaderRHI, NumberOfAttributes, Resource->NumAttributes);
 		SetShaderValue(RHICmdList, ComputeShaderRHI, NumberOfPoints, Resource->NumPoints);
 
@@ -4266,6 +4531,8 @@ public:
 
 private:
 	LAYOUT_FIELD(FShaderParameter, NumberOfSamples);
+	LAYOUT_FIELD(FShaderParameter, SampleWindowStart);
+	LAYOUT_FIELD(FShaderParameter, SampleWindowStride);
 	LAYOUT_FIELD(FShaderParameter, NumberOfAttributes);
 	LAYOUT_FIELD(FShaderParameter, NumberOfPoints);
 
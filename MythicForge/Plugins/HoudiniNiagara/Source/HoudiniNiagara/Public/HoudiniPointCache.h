@@ -26,6 +26,7 @@
 #include "DataDrivenShaderPlatformInfo.h"
 #include "RHI.h"
 #include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
 #include "HAL/PlatformProcess.h"
 #include "Misc/CoreMiscDefines.h" 
 #include "Misc/FileHelper.h"
@@ -40,6 +41,8 @@
 #include "UObject/ObjectMacros.h"
 #include "UObject/UObjectGlobals.h"
 
+#include "HoudiniPointCacheBinaryFile.h"
+
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
 #include "UObject/AssetRegistryTagsContext.h"
 #endif
@@ -80,6 +83,31 @@ struct FPointIndexes
 	TArray<int32> SampleIndexes;
 };
 
+// Samples used to read a point's values at a given time:
+// values are read as Lerp(PrevSampleIndex's value, NextSampleIndex's value, PrevWeight)
+struct FHoudiniPointSampleBlend
+{
+	int32 PrevSampleIndex = -1;
+	int32 NextSampleIndex = -1;
+	float PrevWeight = 1.0f;
+};
+
+// Sequential playback cursor for reading a point cache's values at increasing times.
+// Remembers the sample last used for each point, so that the next lookup only has to
+// step forward from there instead of searching through all of the point's samples.
+struct HOUDININIAGARA_API FHoudiniPointCacheCursor
+{
+	// Forgets all the remembered sample positions
+	void Reset();
+
+	// The point cache and sample time index the positions were recorded for
+	const class UHoudiniPointCache* PointCache = nullptr;
+	uint32 SampleTimeIndexSerial = 0;
+
+	// For each point, position (in the point's samples) of the last sample at or before the last requested time
+	TArray<int32> PointSamplePositions;
+};
+
 UENUM()
 enum class EHoudiniPointCacheFileType : uint8
 {
@@ -108,6 +136,12 @@ struct FNiagaraDIHoudini_StaticDataPassToRT
 	int32 NumAttributes;
 	int32 NumPoints;
 	int32 MaxNumIndexesPerPoint;
+
+	// For streamed point caches, FloatData only holds a window of samples, starting at
+	// SampleWindowStart, with a column stride of SampleWindowStride floats
+	bool bStreamedFloatData = false;
+	int32 SampleWindowStart = 0;
+	int32 SampleWindowStride = 0;
 };
 
 /**
@@ -130,12 +164,17 @@ public:
 	int32 NumAttributes;
 	int32 NumPoints;
 
+	// First sample and column stride of the samples held by FloatValuesGPUBuffer.
+	// The whole point cache is uploaded (0, NumSamples) unless it is streamed.
+	int32 SampleWindowStart;
+	int32 SampleWindowStride;
+
 	TArray<FString> Attributes;
 
 	TUniquePtr<struct FNiagaraDIHoudini_StaticDataPassToRT> CachedData;
 
 	/** Default constructor. */
-	FHoudiniPointCacheResource() : CachedData(nullptr){}
+	FHoudiniPointCacheResource() : SampleWindowStart(0), SampleWindowStride(0), CachedData(nullptr){}
 
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
 	virtual void InitRHI(FRHICommandListBase& RHICmdList) override;
@@ -148,6 +187,9 @@ public:
 
 	void AcceptStaticDataUpdate(TUniquePtr<struct FNiagaraDIHoudini_StaticDataPassToRT>& Update);
 
+	// Replaces the window of samples held by a streamed point cache's FloatValuesGPUBuffer
+	void UpdateSampleWindow(FRHICommandListImmediate& RHICmdList, int32 InSampleWindowStart, const TArray<float>& InFloatData);
+
 	virtual ~FHoudiniPointCacheResource() {}
 };
 
@@ -276,6 +318,27 @@ class HOUDININIAGARA_API UHoudiniPointCache : public UObject
 	// Returns the previous and next sample indexes for reading the values of a specified point at a given time
 	UFUNCTION(BlueprintCallable, Category = "Houdini Attributes Data")
 	bool GetSampleIndexesForPointAtTime(const int32& PointID, const float& desiredTime, int32& PrevSampleIndex, int32& NextSampleIndex, float& PrevWeight) const;
+
+	// Returns the samples to blend for reading the values of a specified point at a given time.
+	// When a cursor is given, the lookup starts from the cursor's position for that point and updates it:
+	// lookups at increasing times are then resolved in amortized constant time.
+	bool GetSampleBlendForPointAtTime(int32 PointID, float DesiredTime, FHoudiniPointSampleBlend& OutBlend, FHoudiniPointCacheCursor* InOutCursor = nullptr) const;
+
+	// Returns values from an already resolved sample blend, so that all the attributes
+	// read for a point at a given time share a single time lookup
+	bool GetFloatValueForBlend(const FHoudiniPointSampleBlend& Blend, int32 AttributeIndex, float& Value) const;
+	bool GetVectorValueForBlend(const FHoudiniPointSampleBlend& Blend, int32 AttributeIndex, FVector& Vector, bool DoSwap = true, bool DoScale = true) const;
+	bool GetVector4ValueForBlend(const FHoudiniPointSampleBlend& Blend, int32 AttributeIndex, FVector4& Vector) const;
+	bool GetQuatValueForBlend(const FHoudiniPointSampleBlend& Blend, int32 AttributeIndex, FQuat& Quat, bool DoHoudiniToUnrealConversion = true) const;
+	// Returns the integer value of the blend's previous sample, no value interpolation will take place
+	bool GetInt32ValueForBlend(const FHoudiniPointSampleBlend& Blend, int32 AttributeIndex, int32& Value) const;
+
+	// Builds the contiguous per-point sample time index used for the point lookups at a given time.
+	// This is done after loading or importing the point cache, and must be done again if its samples are modified.
+	void BuildSampleTimeIndex();
+
+	// Returns true if the per-point sample time index has been built
+	bool HasSampleTimeIndex() const { return PointSampleOffsets.Num() > 1; }
 	// Returns the value for a point at a given time value (linearly interpolated)
 	UFUNCTION(BlueprintCallable, Category = "Houdini Attributes Data")
 	bool GetPointValueAtTime(const int32& PointID, const int32& AttributeIndex, const float& desiredTime, float& Value) const;
@@ -334,6 +397,24 @@ class HOUDININIAGARA_API UHoudiniPointCache : public UObject
 	// Returns the maximum number of indexes per point, used for flattening the buffer for HLSL conversion
 	int32 GetMaxNumberOfPointValueIndexes() const;
 
+	// Returns true if the sample values are read from the streaming binary file instead of the asset
+	bool IsStreamingSamples() const { return StreamingFile.IsValid(); }
+
+	// Moves the window of samples uploaded to the GPU for a streamed point cache so that it covers the given time.
+	// This is done automatically by the data interface's spawn functions, but can be called to drive GPU only emitters.
+	// Must be called on the game thread.
+	UFUNCTION(BlueprintCallable, Category = "Houdini Point Cache Streaming")
+	void UpdateStreamingWindow(float Time);
+
+	// Thread safe version of UpdateStreamingWindow(): when called from another thread, the window
+	// is moved on the game thread to the last requested time.
+	void RequestStreamingWindowUpdate(float Time);
+
+#if WITH_EDITOR
+	// Releases and removes the streaming binary file, called when the asset is deleted
+	void DeleteStreamingFile();
+#endif
+
 	//-----------------------------------------------------------------------------------------
 	//  MEMBER VARIABLES
 	//-----------------------------------------------------------------------------------------
@@ -384,6 +465,21 @@ class HOUDININIAGARA_API UHoudiniPointCache : public UObject
 	UPROPERTY( VisibleAnywhere, Category = "Houdini Point Cache Properties" )
 	TArray<FString> AttributeArray;
 
+	// When enabled, the sample values are stored in a columnar binary file instead of the asset.
+	// The file is memory-mapped at runtime, and only a window of frames around the current time is uploaded to the GPU.
+	// The binary files are written to the project's Content/HoudiniNiagara directory, which must be added
+	// to the "Additional Non-Asset Directories to Package" project setting.
+	UPROPERTY( EditAnywhere, Category = "Houdini Point Cache Streaming" )
+	bool bStreamSamples;
+
+	// The number of frames of samples uploaded to the GPU when streaming
+	UPROPERTY( EditAnywhere, Category = "Houdini Point Cache Streaming", meta = (EditCondition = "bStreamSamples", ClampMin = "2", UIMin = "2") )
+	int32 StreamingWindowFrames;
+
+	// The streaming binary file, relative to the project's content directory
+	UPROPERTY( VisibleAnywhere, Category = "Houdini Point Cache Streaming" )
+	FString StreamingFileName;
+
 #if WITH_EDITORONLY_DATA
 	/** Importing data and options used for this asset */
 	UPROPERTY( EditAnywhere, Instanced, Category = ImportSettings )
@@ -419,14 +515,22 @@ class HOUDININIAGARA_API UHoudiniPointCache : public UObject
 
 	virtual void GetAssetRegistryTags(TArray< FAssetRegistryTag > & OutTags) const override;
 	
+	virtual void PostLoad() override;
+
+	virtual void PostDuplicate(bool bDuplicateForPIE) override;
+
 	void BeginDestroy() override;
 
 	// Data Accessors, const and non-const versions
+	// Note that the float sample data is empty when streaming samples, use GetFloatSampleValues() to read them.
 	TArray<float>& GetFloatSampleData() { return FloatSampleData; }
 
 	UFUNCTION(BlueprintCallable, Category = "Houdini Point Cache Data")
 	const TArray<float>& GetFloatSampleData() const { return FloatSampleData; }
 
+	// Returns the float sample values, either from the asset or from the streaming binary file
+	TArrayView<const float> GetFloatSampleValues() const { return StreamingFile.IsValid() ? StreamingFile->GetFloatData() : TArrayView<const float>(FloatSampleData); }
+
 	TArray<float>& GetSpawnTimes() { return SpawnTimes; }
 
 	UFUNCTION(BlueprintCallable, Category = "Houdini Point Cache Data")
@@ -508,4 +612,44 @@ class HOUDININIAGARA_API UHoudiniPointCache : public UObject
 	// The type of source file, such as CSV or JSON.
 	UPROPERTY()
 	EHoudiniPointCacheFileType FileType;
+
+	// Binary search of a point's samples, used when the sample time index hasn't been built
+	bool SearchSampleBlendForPointAtTime(int32 PointID, float DesiredTime, FHoudiniPointSampleBlend& OutBlend) const;
+
+	// Per-point sample time index, built from PointValueIndexes and the samples' time values.
+	// The samples of point N are stored, sorted by time, in [PointSampleOffsets[N], PointSampleOffsets[N + 1])
+	// of PointSampleIndexes and PointSampleTimes.
+	TArray<int32> PointSampleOffsets;
+	TArray<int32> PointSampleIndexes;
+	TArray<float> PointSampleTimes;
+
+	// Incremented every time the sample time index is rebuilt, used to invalidate cursors
+	uint32 SampleTimeIndexSerial;
+
+	// Returns the absolute path of the streaming binary file
+	FString GetStreamingFilePath() const;
+
+#if WITH_EDITOR
+	// Writes (or removes) the streaming binary file to match bStreamSamples
+	void UpdateStreamingFile();
+
+	// Returns a new, unique, streaming file name for this asset
+	FString MakeStreamingFileName() const;
+#endif
+
+	// Reads the samples of the GPU window starting at the given frame, column major with a stride of StreamingWindowCapacity
+	void ReadStreamingWindow(int32 FirstFrame, int32& OutFirstSample, TArray<float>& OutFloatData) const;
+
+	// The mapped streaming binary file, valid when streaming samples
+	TUniquePtr<FHoudiniPointCacheBinaryFile> StreamingFile;
+
+	// The first frame and the capacity in samples of the GPU window, guarded by StreamingWindowLock
+	int32 StreamingWindowFirstFrame;
+	int32 StreamingWindowCapacity;
+	FCriticalSection StreamingWindowLock;
+
+	// Last time requested from another thread, and whether its update is already queued on the game thread.
+	// Guarded by StreamingWindowLock
+	float RequestedStreamingWindowTime;
+	bool bStreamingWindowUpdatePending;
 };
\ No newline at end of file
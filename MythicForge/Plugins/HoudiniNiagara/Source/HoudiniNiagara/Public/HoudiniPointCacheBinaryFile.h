@@ -0,0 +1,110 @@
+/*
+* Copyright (c) <2018> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+// Columnar binary file storing the float sample values of a streamed point cache.
+// The file is written when importing the point cache, and memory-mapped at runtime so that
+// only the pages holding the samples that are actually read need to be resident.
+//
+// Layout (native endianness, sections aligned on 16 bytes):
+//   FHeader
+//   Frame table: NumFrames x FFrame
+//   Float values: NumAttributes columns of NumSamples floats (same layout as the point cache's FloatSampleData)
+//
+// Samples are stored in the point cache's order, sorted by time, so each frame is a contiguous range of samples.
+class HOUDININIAGARA_API FHoudiniPointCacheBinaryFile
+{
+public:
+
+	// A range of samples sharing the same time value
+	struct FFrame
+	{
+		int32 FirstSample;
+		int32 NumSamples;
+		float Time;
+	};
+
+	~FHoudiniPointCacheBinaryFile();
+
+	// Writes the float sample values of a point cache to a binary file.
+	// TimeAttributeIndex is used to split the samples in frames, pass INDEX_NONE if the samples have no time values.
+	static bool Write(const FString& InFilePath, const TArray<float>& InFloatData, int32 InNumSamples, int32 InNumAttributes, int32 InTimeAttributeIndex);
+
+	// Opens and maps a binary file, returns null if the file is missing or invalid.
+	// If the platform doesn't support mapping files, the float values are loaded in memory instead.
+	static TUniquePtr<FHoudiniPointCacheBinaryFile> Open(const FString& InFilePath);
+
+	int32 GetNumSamples() const { return NumSamples; }
+	int32 GetNumAttributes() const { return NumAttributes; }
+	const TArray<FFrame>& GetFrames() const { return Frames; }
+
+	// Returns all the float values, column major
+	TArrayView<const float> GetFloatData() const { return TArrayView<const float>(FloatData, NumSamples * NumAttributes); }
+
+	// Returns the index of the last frame starting at or before Time (0 if Time is before the first frame)
+	int32 GetFrameIndexAtTime(float Time) const;
+
+	// Returns the largest number of samples found in NumFramesInWindow consecutive frames
+	int32 GetMaxNumSamplesInFrames(int32 NumFramesInWindow) const;
+
+	// Copies the values of the samples [FirstSample, FirstSample + NumSamplesToRead) for all attributes.
+	// The columns are written at Stride floats from each other in OutData, which must hold NumAttributes * Stride floats.
+	bool ReadSamples(int32 FirstSample, int32 NumSamplesToRead, int32 Stride, float* OutData) const;
+
+private:
+
+	FHoudiniPointCacheBinaryFile();
+
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		int32 NumSamples;
+		int32 NumAttributes;
+		int32 NumFrames;
+		int32 Reserved;
+		int64 FramesOffset;
+		int64 FloatDataOffset;
+	};
+
+	static const uint32 FileMagic;
+	static const uint32 FileVersion;
+
+	int32 NumSamples;
+	int32 NumAttributes;
+	TArray<FFrame> Frames;
+
+	// Points either in the mapped region or in FallbackFloatData
+	const float* FloatData;
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TArray<float> FallbackFloatData;
+};
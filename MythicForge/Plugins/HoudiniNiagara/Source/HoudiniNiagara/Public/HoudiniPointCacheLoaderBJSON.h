@@ -87,6 +87,13 @@ class FHoudiniPointCacheLoaderBJSON : public FHoudiniPointCacheLoaderJSONBase
             return bResult;
         }
 
+        /** Returns the size, in bytes, of a value of type InMarkerType, InDefaultSize for untyped values, or 0 if the type is unknown. */
+        static uint32 GetMarkerTypeSize(unsigned char InMarkerType, uint32 InDefaultSize);
+
+        /** Interpret the value at InData as InMarkerType (which must be a known type) and cast it to float.
+         * Does not use `Reader`, so it can be called from multiple threads on the raw buffer. */
+        static float DecodeFloatValue(const uint8* InData, unsigned char InMarkerType);
+
         /** Read a type marker from `Reader`. */
         bool ReadMarker(unsigned char &OutMarker);
 
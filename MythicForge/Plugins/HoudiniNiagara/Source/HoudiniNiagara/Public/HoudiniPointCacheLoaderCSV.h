@@ -37,12 +37,17 @@ class FHoudiniPointCacheLoaderCSV : public FHoudiniPointCacheLoader
         virtual bool LoadToAsset(UHoudiniPointCache *InAsset) override;
 
 		virtual FName GetFormatID() const override { return "HCSV"; };
+
+		// Parses a CSV file to a transient asset NumIterations times and logs the average time,
+		// used by the HoudiniNiagara.BenchmarkCSVImport console command
+		static void BenchmarkImport(const FString& InFilePath, int32 InNumIterations);
 #endif
 
     protected:
 	
 #if WITH_EDITOR
-    	virtual bool UpdateFromStringArray(UHoudiniPointCache *InAsset, TArray<FString>& InStringArray);
+    	// Parses the CSV content in [InBegin, InEnd) directly to the asset's numeric columns
+    	virtual bool UpdateFromBuffer(UHoudiniPointCache *InAsset, const ANSICHAR* InBegin, const ANSICHAR* InEnd);
 
     	// Parses the CSV title row to update the column indexes of special values we're interested in
     	// Also look for packed vectors in the first row and update the indexes accordingly
@@ -44,6 +44,19 @@ struct FHoudiniPointCacheJSONHeader
     FString DataType;
 };
 
+/** A frame entry found while scanning a JSON-based point cache file. */
+struct FHoudiniPointCacheJSONFrame
+{
+    // The frame number
+    float FrameNumber = 0.0f;
+    // The time, in seconds, of the frame
+    float Time = 0.0f;
+    // The sample index of the first sample in the frame
+    uint32 StartSampleIndex = 0;
+    // The number of points in this frame
+    uint32 NumPoints = 0;
+};
+
 
 /**
  * Base class for JSON-based Houdini Point Cache loaders.
@@ -62,19 +75,28 @@ class FHoudiniPointCacheLoaderJSONBase : public FHoudiniPointCacheLoader
          */
         virtual bool ParseAttributesAndInitAsset(UHoudiniPointCache *InAsset, const struct FHoudiniPointCacheJSONHeader &InHeader);
 
-        /** Process one frame's data (InFrameData).
+        /** Decode one frame's data (InOutFrameData) into the frame's slice of the asset's FloatSampleData.
+         * The frame's samples are sorted by age if needed, and their time is set to the frame's time.
+         * Point IDs are left as found in the file, they are remapped by FinalizeFrames.
+         * Only the samples of InFrame are written to, so different frames can be decoded concurrently.
          * @param InAsset The point cache asset to populate.
-         * @param InFrameNumber The frame number
-         * @param InFrameData The frame's data, an array of arrays (point and attribute values for the point).
-         * @param InFrameTime The time, in seconds, of the frame.
-         * @param InFrameStartSampleIndex The sample index of the first sample in the frame.
-         * @param InNumPointsInFrame The number of points in this frame.
+         * @param InOutFrameData The frame's data, an array of arrays (point and attribute values for the point).
+         * @param InFrame The frame entry, with its time and sample range.
          * @param InNumAttributesPerPoint The number of attributes in a point's sample.
-         * @param InHeader The header data of the point cache file.
-         * @param InHoudiniIDToNiagaraIDMap A map of point ids from the file, to our internal id
-         * @param OutNextPointID The next point id (incremented everytime a new point is detected).
-         * @return false if processing the frame failed.
+         * @return false if decoding the frame failed.
+         */
+        virtual bool DecodeFrame(UHoudiniPointCache *InAsset, TArray<TArray<float>> &InOutFrameData, const FHoudiniPointCacheJSONFrame &InFrame, uint32 InNumAttributesPerPoint) const;
+
+        /** Once all the frames are decoded, remap the point IDs from the file so that they start at zero and
+         * increment as points are spawned, and build the per point data (sample indexes, spawn times, life and types).
+         * This is a sequential pass over the frames, in order.
+         * @param InAsset The point cache asset to populate.
+         * @param InFrames The frame entries, in the order they appear in the file.
+         * @return false if processing the frames failed.
          */
-        virtual bool ProcessFrame(UHoudiniPointCache *InAsset, float InFrameNumber, const TArray<TArray<float>> &InFrameData, float InFrameTime, uint32 InFrameStartSampleIndex, uint32 InNumPointsInFrame, uint32 InNumAttributesPerPoint, const FHoudiniPointCacheJSONHeader &InHeader, TMap<int32, int32>& InHoudiniIDToNiagaraIDMap, int32 &OutNextPointID) const;
+        virtual bool FinalizeFrames(UHoudiniPointCache *InAsset, const TArray<FHoudiniPointCacheJSONFrame> &InFrames) const;
 
+        /** Checks that the frames found in the file fit in the number of samples and frames declared in the header
+         * and compute their start sample index. */
+        bool ValidateFrames(UHoudiniPointCache *InAsset, TArray<FHoudiniPointCacheJSONFrame> &InOutFrames, const FHoudiniPointCacheJSONHeader &InHeader) const;
 };
@@ -23,8 +23,10 @@
 
 #include "HoudiniNiagaraEditor.h"
 #include "HoudiniPointCacheAssetActions.h"
+#include "HoudiniPointCache.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Editor.h"
 #include "Interfaces/IPluginManager.h"
 #include "Styling/SlateStyleRegistry.h"
 #include "Styling/SlateStyle.h"
@@ -40,6 +42,9 @@ void FHoudiniNiagaraEditorModule::StartupModule()
 	AssetTools.RegisterAssetTypeActions( HCSVAction );
 	AssetTypeActions.Add( HCSVAction );
 
+	// Remove the streaming files of the point caches that are deleted
+	AssetsPreDeleteHandle = FEditorDelegates::OnAssetsPreDelete.AddStatic(&FHoudiniNiagaraEditorModule::OnAssetsPreDelete);
+
 	// Create Slate style set.
 	if (!StyleSet.IsValid())
 	{
@@ -78,6 +83,8 @@ void FHoudiniNiagaraEditorModule::StartupModule()
 
 void FHoudiniNiagaraEditorModule::ShutdownModule()
 {
+	FEditorDelegates::OnAssetsPreDelete.Remove(AssetsPreDeleteHandle);
+
 	// Unregister asset type actions we have previously registered.
 	if ( FModuleManager::Get().IsModuleLoaded("AssetTools") )
 	{
@@ -100,6 +107,15 @@ void FHoudiniNiagaraEditorModule::ShutdownModule()
 	}
 }
 
+void FHoudiniNiagaraEditorModule::OnAssetsPreDelete(const TArray<UObject*>& Objects)
+{
+	for (UObject* Object : Objects)
+	{
+		if (UHoudiniPointCache* PointCache = Cast<UHoudiniPointCache>(Object))
+			PointCache->DeleteStreamingFile();
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
 	
 IMPLEMENT_MODULE(FHoudiniNiagaraEditorModule, HoudiniNiagaraEditor)
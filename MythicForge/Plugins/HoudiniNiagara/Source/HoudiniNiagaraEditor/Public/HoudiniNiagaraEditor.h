@@ -39,6 +39,12 @@ class FHoudiniNiagaraEditorModule : public IModuleInterface
 
     private:
 
+	/** Deletes the streaming files of the point caches about to be deleted. **/
+	static void OnAssetsPreDelete(const TArray<UObject*>& Objects);
+
+	/** Handle of the OnAssetsPreDelete delegate. **/
+	FDelegateHandle AssetsPreDeleteHandle;
+
 	/** AssetType actions associated with Houdini CSV assets. **/
 	TArray< TSharedPtr< IAssetTypeActions > > AssetTypeActions;
 